@@ -0,0 +1,45 @@
+# Name:     score_ckpt1.pl
+# Date:     10/18/2026
+# Purpose:  Verifies that writing -checkpoint files does not change the scored CDD and that a score run resumed
+#           from the last checkpoint creates the same CDD as an uninterrupted score run.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "score_ckpt1", 0, @ARGV );
+
+# Simulate and get coverage information
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP score_ckpt1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP score_ckpt1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP score_ckpt1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP score_ckpt1.v" ) && die;
+}
+
+# Score the dumpfile without checkpoints
+&runScoreCommand( "-t main -vcd score_ckpt1.vcd -v score_ckpt1.v -o score_ckpt1.cdd -D DUMP" );
+system( "mv score_ckpt1.cdd score_ckpt1a.cdd" ) && die;
+
+# Score the dumpfile again, saving a checkpoint every 8 timesteps
+system( "rm -f score_ckpt1.ckpt" ) && die;
+&runScoreCommand( "-t main -vcd score_ckpt1.vcd -v score_ckpt1.v -o score_ckpt1.cdd -D DUMP -checkpoint score_ckpt1.ckpt -checkpoint-steps 8" );
+&runCommand( "./cdd_diff score_ckpt1.cdd score_ckpt1a.cdd" );
+system( "mv score_ckpt1.cdd score_ckpt1b.cdd" ) && die;
+
+# Resume scoring from the last checkpoint that was saved
+if( !(-f "score_ckpt1.ckpt") ) {
+  die "  Checkpoint file score_ckpt1.ckpt was not written!\n";
+}
+&runScoreCommand( "-t main -vcd score_ckpt1.vcd -v score_ckpt1.v -o score_ckpt1.cdd -D DUMP -checkpoint score_ckpt1.ckpt -resume" );
+&runCommand( "./cdd_diff score_ckpt1.cdd score_ckpt1a.cdd" );
+
+# Remove the checkpoint file
+system( "rm -f score_ckpt1.ckpt" ) && die;
+
+# Perform the file comparison checks
+&checkTest( "score_ckpt1", 3, 0 );
+
+exit 0;
@@ -0,0 +1,48 @@
+# Name:     score_ppcache1.pl
+# Date:     10/18/2026
+# Purpose:  Verifies that scoring with a -ppcache directory creates the same CDD as scoring without it, both when
+#           the cache is filled and when the cached preprocessor output is used.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "score_ppcache1", 0, @ARGV );
+
+# Simulate and get coverage information
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP score_ppcache1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP score_ppcache1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP score_ppcache1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP score_ppcache1.v" ) && die;
+}
+
+# Score the dumpfile without the preprocessor cache
+&runScoreCommand( "-t main -vcd score_ppcache1.vcd -v score_ppcache1.v -o score_ppcache1.cdd -D DUMP" );
+system( "mv score_ppcache1.cdd score_ppcache1a.cdd" ) && die;
+
+# Score the dumpfile with an empty preprocessor cache, which fills it
+system( "rm -rf score_ppcache1.cache; mkdir score_ppcache1.cache" ) && die;
+&runScoreCommand( "-t main -vcd score_ppcache1.vcd -v score_ppcache1.v -o score_ppcache1.cdd -D DUMP -ppcache score_ppcache1.cache" );
+&runCommand( "./cdd_diff score_ppcache1.cdd score_ppcache1a.cdd" );
+system( "mv score_ppcache1.cdd score_ppcache1b.cdd" ) && die;
+
+my( $entries ) = `ls score_ppcache1.cache`;
+chomp( $entries );
+if( $entries eq "" ) {
+  die "  Preprocessor cache entry was not written!\n";
+}
+
+# Score the dumpfile again, using the cached preprocessor output
+&runScoreCommand( "-t main -vcd score_ppcache1.vcd -v score_ppcache1.v -o score_ppcache1.cdd -D DUMP -ppcache score_ppcache1.cache" );
+&runCommand( "./cdd_diff score_ppcache1.cdd score_ppcache1a.cdd" );
+
+# Remove the preprocessor cache directory
+system( "rm -rf score_ppcache1.cache" ) && die;
+
+# Perform the file comparison checks
+&checkTest( "score_ppcache1", 3, 0 );
+
+exit 0;
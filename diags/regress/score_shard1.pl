@@ -0,0 +1,40 @@
+# Name:     score_shard1.pl
+# Date:     10/18/2026
+# Purpose:  Verifies that scoring a VCD dumpfile in -vcd-shards time windows merges to the same CDD as scoring
+#           it in one pass and that the shard CDD files are removed afterwards.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "score_shard1", 0, @ARGV );
+
+# Simulate and get coverage information
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP score_shard1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP score_shard1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP score_shard1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP score_shard1.v" ) && die;
+}
+
+# Score the dumpfile in one pass
+&runScoreCommand( "-t depth1 -i main.inst0 -vcd score_shard1.vcd -o score_shard1.cdd -v score_shard1.v -D DUMP" );
+system( "mv score_shard1.cdd score_shard1a.cdd" ) && die;
+
+# Score the dumpfile in three shards
+&runScoreCommand( "-t depth1 -i main.inst0 -vcd score_shard1.vcd -o score_shard1.cdd -v score_shard1.v -D DUMP -vcd-shards 3" );
+&runCommand( "./cdd_diff score_shard1.cdd score_shard1a.cdd" );
+
+# Make sure that the shard CDD files were removed
+my( $shards ) = `ls | grep ^score_shard1.cdd.shard`;
+chomp( $shards );
+if( $shards ne "" ) {
+  die "  Shard CDD file was not removed!\n";
+}
+
+# Perform the file comparison checks
+&checkTest( "score_shard1", 2, 0 );
+
+exit 0;
@@ -0,0 +1,30 @@
+# Name:     score_window1.pl
+# Date:     10/18/2026
+# Purpose:  Verifies the coverage that is scored for a -start-time/-end-time window of the dumpfile.  Only the
+#           timesteps 10 and 15 are in the window.  Timestep 5 is simulated to assign the signal values at the start
+#           of the window, so the a=1/b=0 input combination that is only held before the window is still covered,
+#           while the a=0/b=0 combination of timestep 0 and the 0->1 toggle of a at timestep 5 are not.
+
+require "../verilog/regress_subs.pl";
+
+# Initialize the diagnostic environment
+&initialize( "score_window1", 0, @ARGV );
+
+# Simulate and get coverage information
+if( $SIMULATOR eq "IV" ) {
+  system( "iverilog -DDUMP score_window1.v; ./a.out" ) && die;
+} elsif( $SIMULATOR eq "CVER" ) {
+  system( "cver -q +define+DUMP score_window1.v" ) && die;
+} elsif( $SIMULATOR eq "VCS" ) {
+  system( "vcs +define+DUMP score_window1.v; ./simv" ) && die;
+} elsif( $SIMULATOR eq "VERIWELL" ) {
+  system( "veriwell +define+DUMP score_window1.v" ) && die;
+}
+
+# Perform diagnostic running code here
+&runScoreCommand( "-t depth1 -i main.inst0 -vcd score_window1.vcd -o score_window1.cdd -v score_window1.v -start-time 10 -end-time 15 -D DUMP" );
+
+# Perform the file comparison checks
+&checkTest( "score_window1", 1, 0 );
+
+exit 0;
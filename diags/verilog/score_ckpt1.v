@@ -0,0 +1,27 @@
+/*
+ Name:        score_ckpt1.v
+ Date:        10/18/2026
+ Purpose:     Verifies that a score run resumed from a -checkpoint file creates the same CDD.
+*/
+
+module main;
+
+reg clock;
+
+initial begin
+	clock = 1'b0;
+	repeat( 20 ) begin
+	  #5;
+	  clock = ~clock;
+	end
+	$finish;
+end
+
+initial begin
+`ifdef DUMP
+        $dumpfile( "score_ckpt1.vcd" );
+        $dumpvars( 0, main );
+`endif
+end
+
+endmodule
@@ -143,6 +143,126 @@
 int curr_arc_id = 1;
 
 
+/*!
+ \return Returns the bucket in the given state hash table that either contains the index of the given
+         state or is empty (if the state does not exist in the table).
+
+ Performs a linear probe of the given open-addressed state hash table.  The table must contain at least
+ one empty bucket.
+*/
+static unsigned int arc_state_hash_probe(
+  const unsigned int* hash,       /*!< Pointer to state hash table to search */
+  unsigned int        hash_size,  /*!< Number of buckets in the state hash table */
+  vector**            states,     /*!< Array of states that the hash table indexes */
+  const vector*       st          /*!< State to search for */
+) { PROFILE(ARC_STATE_HASH_PROBE);
+
+  unsigned int bucket = vector_hash_ulong( st ) & (hash_size - 1);
+
+  while( (hash[bucket] != 0) && !vector_ceq_ulong( st, states[hash[bucket] - 1] ) ) {
+    bucket = (bucket + 1) & (hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ \return Returns the bucket in the arc hash table of the given FSM table that either contains the index of
+         the given state transition or is empty (if the transition does not exist in the table).
+*/
+static unsigned int arc_arc_hash_probe(
+  const fsm_table* table,     /*!< Pointer to FSM table to search */
+  unsigned int     fr_index,  /*!< Index of from state to find */
+  unsigned int     to_index   /*!< Index of to state to find */
+) { PROFILE(ARC_ARC_HASH_PROBE);
+
+  unsigned int bucket = ((fr_index * 0x9e3779b1) ^ to_index) & (table->arc_hash_size - 1);
+
+  while( (table->arc_hash[bucket] != 0) &&
+         ((table->arcs[table->arc_hash[bucket] - 1]->from != fr_index) || (table->arcs[table->arc_hash[bucket] - 1]->to != to_index)) ) {
+    bucket = (bucket + 1) & (table->arc_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ Adds the last num_states - start states of the given state array to the given state hash table.  If the
+ table would become more than half full, it is reallocated to a larger size and all states are rehashed.
+*/
+static void arc_state_hash_add(
+  unsigned int** hash,        /*!< Pointer to state hash table to add to */
+  unsigned int*  hash_size,   /*!< Pointer to number of buckets in the state hash table */
+  vector**       states,      /*!< Array of states that the hash table indexes */
+  unsigned int   start,       /*!< Index of first state in the states array to add */
+  unsigned int   num_states   /*!< Number of elements in the states array */
+) { PROFILE(ARC_STATE_HASH_ADD);
+
+  unsigned int i;
+
+  /* If the table needs to grow, reallocate it and rehash all of the states */
+  if( (num_states * 2) > *hash_size ) {
+    unsigned int new_size = (*hash_size == 0) ? 16 : *hash_size;
+    while( (num_states * 2) > new_size ) {
+      new_size <<= 1;
+    }
+    free_safe( *hash, (sizeof( unsigned int ) * (*hash_size)) );
+    *hash      = (unsigned int*)calloc_safe( new_size, sizeof( unsigned int ) );
+    *hash_size = new_size;
+    start = 0;
+  }
+
+  for( i=start; i<num_states; i++ ) {
+    unsigned int bucket = arc_state_hash_probe( *hash, *hash_size, states, states[i] );
+    if( (*hash)[bucket] == 0 ) {
+      (*hash)[bucket] = (i + 1);
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Adds the last num_arcs - start state transitions of the given FSM table to its arc hash table, growing
+ the hash table (and rehashing all state transitions) if it would become more than half full.
+*/
+static void arc_arc_hash_add(
+  fsm_table*   table,  /*!< Pointer to FSM table to update */
+  unsigned int start   /*!< Index of first arc in the arcs array to add */
+) { PROFILE(ARC_ARC_HASH_ADD);
+
+  unsigned int i;
+
+  /* If the table needs to grow, reallocate it and rehash all of the arcs */
+  if( (table->num_arcs * 2) > table->arc_hash_size ) {
+    unsigned int new_size = (table->arc_hash_size == 0) ? 16 : table->arc_hash_size;
+    while( (table->num_arcs * 2) > new_size ) {
+      new_size <<= 1;
+    }
+    free_safe( table->arc_hash, (sizeof( unsigned int ) * table->arc_hash_size) );
+    table->arc_hash      = (unsigned int*)calloc_safe( new_size, sizeof( unsigned int ) );
+    table->arc_hash_size = new_size;
+    start = 0;
+  }
+
+  for( i=start; i<table->num_arcs; i++ ) {
+    unsigned int bucket = arc_arc_hash_probe( table, table->arcs[i]->from, table->arcs[i]->to );
+    if( table->arc_hash[bucket] == 0 ) {
+      table->arc_hash[bucket] = (i + 1);
+    }
+  }
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
 /*!
  Displays the given state transition arcs in a human-readable format.
@@ -187,21 +307,19 @@ int curr_arc_id = 1;
  \return Returns the index of the found from_state in the fr_states array if one is found; otherwise,
          returns -1 to indicate that a match could not be found.
 
- Searches the list of FROM states for a match to the given vector value.
+ Looks up the given vector value in the FROM state hash table.
 */
 int arc_find_from_state(
   const fsm_table* table,  /*!< Pointer to FSM table to search in */
   const vector*    st      /*!< State to search for */
 ) { PROFILE(ARC_FIND_FROM_STATE);
 
-  int          index = -1;  /* Return value for this function */
-  unsigned int i     = 0;   /* Loop iterator */
+  int index = -1;  /* Return value for this function */
 
   assert( table != NULL );
 
-  while( (i < table->num_fr_states) && !vector_ceq_ulong( st, table->fr_states[i] ) ) i++;
-  if( i < table->num_fr_states ) {
-    index = i;
+  if( table->fr_hash_size > 0 ) {
+    index = (int)table->fr_hash[arc_state_hash_probe( table->fr_hash, table->fr_hash_size, table->fr_states, st )] - 1;
   }
 
   PROFILE_END;
@@ -215,21 +333,19 @@ int arc_find_from_state(
          returns -1 to indicate that a match could not be found.
          that no match occurred.
 
- Searches the list of TO states for a match to the given vector value.
+ Looks up the given vector value in the TO state hash table.
 */
 int arc_find_to_state(
   const fsm_table* table,  /*!< Pointer to FSM table to search in */
   const vector*    st      /*!< State to search for */
 ) { PROFILE(ARC_FIND_TO_STATE);
 
-  int          index = -1;  /* Return value for this function */
-  unsigned int i     = 0;   /* Loop iterator */
+  int index = -1;  /* Return value for this function */
 
   assert( table != NULL );
 
-  while( (i < table->num_to_states) && !vector_ceq_ulong( st, table->to_states[i] ) ) i++;
-  if( i < table->num_to_states ) {
-    index = i;
+  if( table->to_hash_size > 0 ) {
+    index = (int)table->to_hash[arc_state_hash_probe( table->to_hash, table->to_hash_size, table->to_states, st )] - 1;
   }
 
   PROFILE_END;
@@ -241,7 +357,7 @@ int arc_find_to_state(
 /*!
  \return Returns the index of the found arc in the arcs array if it is found; otherwise, returns -1.
 
- Searches for the arc in the arcs array of the given FSM table specified by the given state indices.
+ Looks up the arc specified by the given state indices in the arc hash table of the given FSM table.
 */
 int arc_find_arc(
   const fsm_table* table,     /*!< Pointer to FSM table to search in */
@@ -249,14 +365,10 @@ int arc_find_arc(
   unsigned int     to_index   /*!< Index of to state to find */
 ) { PROFILE(ARC_FIND_ARC);
 
-  int          index = -1;
-  unsigned int i     = 0;
+  int index = -1;
 
-  while( (i < table->num_arcs) && (index == -1) ) {
-    if( (table->arcs[i]->from == fr_index) && (table->arcs[i]->to == to_index) ) {
-      index = i;
-    }
-    i++;
+  if( table->arc_hash_size > 0 ) {
+    index = (int)table->arc_hash[arc_arc_hash_probe( table, fr_index, to_index )] - 1;
   }
 
   PROFILE_END;
@@ -308,6 +420,12 @@ fsm_table* arc_create() { PROFILE(ARC_CREATE);
   table->num_to_states = 0;
   table->arcs          = NULL;
   table->num_arcs      = 0;
+  table->fr_hash       = NULL;
+  table->fr_hash_size  = 0;
+  table->to_hash       = NULL;
+  table->to_hash_size  = 0;
+  table->arc_hash      = NULL;
+  table->arc_hash_size = 0;
 
   PROFILE_END;
 
@@ -348,6 +466,7 @@ void arc_add(
       table->fr_states[from_index] = vector_create( fr_st->width, VTYPE_VAL, fr_st->suppl.part.data_type, TRUE );
       vector_copy( fr_st, table->fr_states[from_index] );
       table->num_fr_states++;
+      arc_state_hash_add( &(table->fr_hash), &(table->fr_hash_size), table->fr_states, from_index, table->num_fr_states );
     }
 
     /* Search for the to_state vector in the states array */
@@ -357,6 +476,7 @@ void arc_add(
       table->to_states[to_index] = vector_create( to_st->width, VTYPE_VAL, to_st->suppl.part.data_type, TRUE );
       vector_copy( to_st, table->to_states[to_index] );
       table->num_to_states++;
+      arc_state_hash_add( &(table->to_hash), &(table->to_hash_size), table->to_states, to_index, table->num_to_states );
     }
 
     /* If we need to add a new arc, do so now */
@@ -371,6 +491,7 @@ void arc_add(
       table->arcs[table->num_arcs]->to                  = to_index;
       arcs_index = table->num_arcs;
       table->num_arcs++;
+      arc_arc_hash_add( table, arcs_index );
 
     /* Otherwise, adjust hit and exclude information */
     } else {
@@ -642,6 +763,11 @@ void arc_db_read(
 
         }
 
+        /* Build the state and state transition hash tables */
+        arc_state_hash_add( &((*table)->fr_hash), &((*table)->fr_hash_size), (*table)->fr_states, 0, (*table)->num_fr_states );
+        arc_state_hash_add( &((*table)->to_hash), &((*table)->to_hash_size), (*table)->to_states, 0, (*table)->num_to_states );
+        arc_arc_hash_add( *table, 0 );
+
       } else {
         print_output( "Unable to parse FSM table information from database.  Unable to read.", FATAL, __FILE__, __LINE__ );
         Throw 0;
@@ -896,6 +1022,11 @@ void arc_dealloc(
     }
     free_safe( table->arcs, (sizeof( fsm_table_arc* ) * table->num_arcs) );
 
+    /* Deallocate hash tables */
+    free_safe( table->fr_hash,  (sizeof( unsigned int ) * table->fr_hash_size) );
+    free_safe( table->to_hash,  (sizeof( unsigned int ) * table->to_hash_size) );
+    free_safe( table->arc_hash, (sizeof( unsigned int ) * table->arc_hash_size) );
+
     /* Now deallocate ourself */
     free_safe( table, sizeof( fsm_table ) );
 
@@ -748,7 +748,7 @@ static bool bind_task_function_namedblock(
         if( type == FUNIT_FUNCTION ) {
 
           scope_extract_back( found_funit->name, back, rest );
-          sig = sig_link_find( back, found_funit->sigs, found_funit->sig_size );
+          sig = funit_lookup_signal( back, found_funit );
 
           assert( sig != NULL );
 
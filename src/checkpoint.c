@@ -0,0 +1,868 @@
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     checkpoint.c
+ \date     10/18/2026
+
+ \par
+ A checkpoint holds everything that the simulator needs to continue scoring a dumpfile from the end of a
+ timestep:  the value and coverage planes of every signal and expression vector, the runtime supplemental
+ information of each expression, the FSM state transition tables, the reentrant frame stack, the threads and
+ the active and delayed thread queues.  Checkpoints are only taken between timesteps, when the symbol table
+ and the non-blocking assignment queue are empty.
+
+ \par
+ The dumpfile position to resume from is stored with the state.  For VCD dumpfiles this is the byte offset of
+ the value changes that follow the checkpointed timestep.  For LXT and FST dumpfiles it is the checkpointed
+ timestep itself; the reader skips the blocks that end before it and ignores the value changes up to it.
+
+ \par
+ Checkpoints are written to a temporary file which is renamed over the checkpoint file once it is complete,
+ so an interrupted score run always leaves the last complete checkpoint behind.  The file is written in the
+ native byte order and is only meant to be read back by the same Covered build for the same CDD file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+#include "checkpoint.h"
+#include "defines.h"
+#include "reentrant.h"
+#include "sim.h"
+#include "sys_tasks.h"
+#include "arc.h"
+#include "util.h"
+#include "vector.h"
+
+
+/*!
+ Identifies a Covered simulation checkpoint file (and the version of its contents).
+*/
+#define CHECKPOINT_MAGIC  "CVDCKPT1"
+
+
+extern char           user_msg[USER_MSG_LENGTH];
+extern db**           db_list;
+extern unsigned int   curr_db;
+extern uint64         num_timesteps;
+extern const exp_info exp_op_info[EXP_OP_NUM];
+extern char*          checkpoint_file;
+extern uint64         checkpoint_steps;
+extern unsigned int   checkpoint_minutes;
+extern bool           checkpoint_resume;
+
+/*!
+ Set to TRUE when the simulation state has been restored from a checkpoint file.
+*/
+bool checkpoint_resumed = FALSE;
+
+/*!
+ Last timestep that was simulated before the restored checkpoint was taken.
+*/
+uint64 checkpoint_resume_time = 0;
+
+/*!
+ Timestep of the dumpfile value changes that follow the restored checkpoint.
+*/
+uint64 checkpoint_resume_next_time = 0;
+
+/*!
+ Byte offset in a VCD dumpfile of the value changes that follow the restored checkpoint.
+*/
+uint64 checkpoint_resume_offset = 0;
+
+/*!
+ Name of the dumpfile being scored.
+*/
+static const char* ckpt_dump_file = NULL;
+
+/*!
+ Format of the dumpfile being scored (see \ref dumpfile_fmt for legal values).
+*/
+static int ckpt_dump_mode = 0;
+
+/*!
+ Array of functional units of the design in the order that they are stored in the checkpoint.
+*/
+static func_unit** ckpt_funits = NULL;
+
+/*!
+ Number of elements in the ckpt_funits array.
+*/
+static unsigned int ckpt_funit_num = 0;
+
+/*!
+ Sorted pointer table of the ckpt_funits array.
+*/
+static ckpt_ptr* ckpt_funit_map = NULL;
+
+/*!
+ Number of timesteps simulated since the last checkpoint was taken.
+*/
+static uint64 ckpt_steps_done = 0;
+
+/*!
+ Time at which the last checkpoint was taken (or at which the first timestep was simulated).
+*/
+static time_t ckpt_last_time = 0;
+
+
+/*!
+ \throws anonymous Throw
+
+ Writes the given bytes to a checkpoint file.
+*/
+void checkpoint_write_data(
+  FILE*        file,  /*!< Pointer to checkpoint file to write to */
+  const void*  data,  /*!< Pointer to bytes to write */
+  unsigned int size   /*!< Number of bytes to write */
+) { PROFILE(CHECKPOINT_WRITE_DATA);
+
+  if( (size > 0) && (fwrite( data, 1, size, file ) != size) ) {
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Reads the given number of bytes from a checkpoint file.
+*/
+void checkpoint_read_data(
+  FILE*        file,  /*!< Pointer to checkpoint file to read from */
+  void*        data,  /*!< Pointer to storage for the read bytes */
+  unsigned int size   /*!< Number of bytes to read */
+) { PROFILE(CHECKPOINT_READ_DATA);
+
+  if( (size > 0) && (fread( data, 1, size, file ) != size) ) {
+    print_output( "Checkpoint file is truncated", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a negative value if the first pointer is less than the second pointer; a positive value if it
+         is greater; otherwise, returns 0.
+*/
+static int checkpoint_ptr_compare(
+  const void* a,  /*!< Pointer to first pointer table entry to compare */
+  const void* b   /*!< Pointer to second pointer table entry to compare */
+) {
+
+  ulong pa = (ulong)((const ckpt_ptr*)a)->ptr;
+  ulong pb = (ulong)((const ckpt_ptr*)b)->ptr;
+
+  return( (pa < pb) ? -1 : ((pa > pb) ? 1 : 0) );
+
+}
+
+/*!
+ \return Returns a newly allocated table of the given pointers and their indices, sorted by pointer (or NULL if
+         num is 0).
+*/
+ckpt_ptr* checkpoint_ptr_map_create(
+  void* const* ptrs,  /*!< Array of pointers */
+  unsigned int num    /*!< Number of elements in the ptrs array */
+) { PROFILE(CHECKPOINT_PTR_MAP_CREATE);
+
+  ckpt_ptr*    map = NULL;
+  unsigned int i;
+
+  if( num > 0 ) {
+    map = (ckpt_ptr*)malloc_safe_nolimit( sizeof( ckpt_ptr ) * num );
+    for( i=0; i<num; i++ ) {
+      map[i].ptr   = ptrs[i];
+      map[i].index = i;
+    }
+    qsort( map, num, sizeof( ckpt_ptr ), checkpoint_ptr_compare );
+  }
+
+  PROFILE_END;
+
+  return( map );
+
+}
+
+/*!
+ \return Returns the index of the given pointer in the array that the given table was created from (or -1 if
+         the pointer is not in the array).
+*/
+int checkpoint_ptr_map_find(
+  const ckpt_ptr* map,  /*!< Sorted pointer table */
+  unsigned int    num,  /*!< Number of entries in the table */
+  const void*     ptr   /*!< Pointer to find */
+) { PROFILE(CHECKPOINT_PTR_MAP_FIND);
+
+  int       index = -1;
+  ckpt_ptr  key;
+  ckpt_ptr* found;
+
+  if( (map != NULL) && (ptr != NULL) ) {
+    key.ptr = ptr;
+    if( (found = (ckpt_ptr*)bsearch( &key, map, num, sizeof( ckpt_ptr ), checkpoint_ptr_compare )) != NULL ) {
+      index = (int)found->index;
+    }
+  }
+
+  PROFILE_END;
+
+  return( index );
+
+}
+
+/*!
+ Creates the array and pointer table of the functional units of the design.
+*/
+static void checkpoint_funits_create() { PROFILE(CHECKPOINT_FUNITS_CREATE);
+
+  funit_link*  funitl;
+  unsigned int i = 0;
+
+  ckpt_funit_num = 0;
+  for( funitl=db_list[curr_db]->funit_head; funitl!=NULL; funitl=funitl->next ) {
+    ckpt_funit_num++;
+  }
+
+  if( ckpt_funit_num > 0 ) {
+    ckpt_funits = (func_unit**)malloc_safe_nolimit( sizeof( func_unit* ) * ckpt_funit_num );
+    for( funitl=db_list[curr_db]->funit_head; funitl!=NULL; funitl=funitl->next ) {
+      ckpt_funits[i++] = funitl->funit;
+    }
+  }
+
+  ckpt_funit_map = checkpoint_ptr_map_create( (void* const*)ckpt_funits, ckpt_funit_num );
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates the array and pointer table of the functional units of the design.
+*/
+static void checkpoint_funits_dealloc() { PROFILE(CHECKPOINT_FUNITS_DEALLOC);
+
+  free_safe( ckpt_funit_map, (sizeof( ckpt_ptr ) * ckpt_funit_num) );
+  free_safe( ckpt_funits, (sizeof( func_unit* ) * ckpt_funit_num) );
+
+  ckpt_funit_map = NULL;
+  ckpt_funits    = NULL;
+  ckpt_funit_num = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data
+
+ Writes a reference to the given functional unit to a checkpoint file.
+*/
+void checkpoint_write_funit(
+  FILE*            file,  /*!< Pointer to checkpoint file to write to */
+  const func_unit* funit  /*!< Pointer to functional unit to write (may be NULL) */
+) { PROFILE(CHECKPOINT_WRITE_FUNIT);
+
+  int index = checkpoint_ptr_map_find( ckpt_funit_map, ckpt_funit_num, funit );
+
+  assert( (funit == NULL) || (index >= 0) );
+
+  checkpoint_write_data( file, &index, sizeof( index ) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the functional unit referenced in the checkpoint file (or NULL if the reference
+         was NULL).
+
+ \throws anonymous checkpoint_read_data Throw
+*/
+func_unit* checkpoint_read_funit(
+  FILE* file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(CHECKPOINT_READ_FUNIT);
+
+  int index;
+
+  checkpoint_read_data( file, &index, sizeof( index ) );
+
+  if( (index < -1) || (index >= (int)ckpt_funit_num) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+  return( (index == -1) ? NULL : ckpt_funits[index] );
+
+}
+
+/*!
+ \return Returns a pointer to the current dimension of the given expression (or NULL if it has none).
+*/
+static exp_dim* checkpoint_expression_dim(
+  const expression* exp  /*!< Pointer to expression */
+) { PROFILE(CHECKPOINT_EXPRESSION_DIM);
+
+  exp_dim* dim = NULL;
+
+  if( EXPR_OP_HAS_DIM( exp->op ) ) {
+    if( exp->suppl.part.nba == 0 ) {
+      dim = exp->elem.dim;
+    } else if( exp->elem.dim_nba != NULL ) {
+      dim = exp->elem.dim_nba->dim;
+    }
+  }
+
+  PROFILE_END;
+
+  return( dim );
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data vector_checkpoint_write
+
+ Writes the runtime information of the given expression to a checkpoint file:  its supplemental field, its
+ execution count, its value, the temporary vectors that hold the previous values of edge expressions and
+ its current dimension.
+*/
+static void checkpoint_write_expression(
+  FILE*             file,  /*!< Pointer to checkpoint file to write to */
+  const expression* exp    /*!< Pointer to expression to write */
+) { PROFILE(CHECKPOINT_WRITE_EXPRESSION);
+
+  exp_dim* dim = checkpoint_expression_dim( exp );
+  char     has_tvecs;
+  char     has_dim;
+
+  checkpoint_write_data( file, &(exp->suppl.all), sizeof( exp->suppl.all ) );
+  checkpoint_write_data( file, &(exp->exec_num), sizeof( exp->exec_num ) );
+
+  if( ESUPPL_OWNS_VEC( exp->suppl ) ) {
+    vector_checkpoint_write( exp->value, file );
+  }
+
+  has_tvecs = ((EXPR_TMP_VECS( exp->op ) > 0) && (exp->elem.tvecs != NULL)) ? 1 : 0;
+  checkpoint_write_data( file, &has_tvecs, 1 );
+  if( has_tvecs ) {
+    unsigned int i;
+    checkpoint_write_data( file, &(exp->elem.tvecs->index), sizeof( exp->elem.tvecs->index ) );
+    for( i=0; i<EXPR_TMP_VECS( exp->op ); i++ ) {
+      vector_checkpoint_write( &(exp->elem.tvecs->vec[i]), file );
+    }
+  }
+
+  has_dim = (dim != NULL) ? 1 : 0;
+  checkpoint_write_data( file, &has_dim, 1 );
+  if( has_dim ) {
+    checkpoint_write_data( file, &(dim->curr_lsb), sizeof( dim->curr_lsb ) );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data vector_checkpoint_read Throw
+
+ Restores the runtime information of the given expression from a checkpoint file.
+*/
+static void checkpoint_read_expression(
+  FILE*       file,  /*!< Pointer to checkpoint file to read from */
+  expression* exp    /*!< Pointer to expression to restore */
+) { PROFILE(CHECKPOINT_READ_EXPRESSION);
+
+  exp_dim* dim = checkpoint_expression_dim( exp );
+  char     has_tvecs;
+  char     has_dim;
+  esuppl   suppl;
+
+  checkpoint_read_data( file, &(suppl.all), sizeof( suppl.all ) );
+  checkpoint_read_data( file, &(exp->exec_num), sizeof( exp->exec_num ) );
+
+  if( ESUPPL_OWNS_VEC( suppl ) != ESUPPL_OWNS_VEC( exp->suppl ) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  exp->suppl.all = suppl.all;
+
+  if( ESUPPL_OWNS_VEC( exp->suppl ) ) {
+    vector_checkpoint_read( exp->value, file );
+  }
+
+  checkpoint_read_data( file, &has_tvecs, 1 );
+  if( has_tvecs != (((EXPR_TMP_VECS( exp->op ) > 0) && (exp->elem.tvecs != NULL)) ? 1 : 0) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+  if( has_tvecs ) {
+    unsigned int i;
+    checkpoint_read_data( file, &(exp->elem.tvecs->index), sizeof( exp->elem.tvecs->index ) );
+    for( i=0; i<EXPR_TMP_VECS( exp->op ); i++ ) {
+      vector_checkpoint_read( &(exp->elem.tvecs->vec[i]), file );
+    }
+  }
+
+  checkpoint_read_data( file, &has_dim, 1 );
+  if( has_dim != ((dim != NULL) ? 1 : 0) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+  if( has_dim ) {
+    checkpoint_read_data( file, &(dim->curr_lsb), sizeof( dim->curr_lsb ) );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data vector_checkpoint_write
+
+ Writes the state transition table of the given FSM to a checkpoint file.  Each state transition is written
+ with its from and to state values in the order that the transitions were added to the table.
+*/
+static void checkpoint_write_fsm(
+  FILE*      file,  /*!< Pointer to checkpoint file to write to */
+  const fsm* table  /*!< Pointer to FSM to write */
+) { PROFILE(CHECKPOINT_WRITE_FSM);
+
+  unsigned int num = (table->table != NULL) ? table->table->num_arcs : 0;
+  unsigned int i;
+
+  checkpoint_write_data( file, &num, sizeof( num ) );
+
+  if( table->table != NULL ) {
+    checkpoint_write_data( file, &(table->table->suppl.all), sizeof( table->table->suppl.all ) );
+    for( i=0; i<num; i++ ) {
+      const fsm_table_arc* arc = table->table->arcs[i];
+      checkpoint_write_data( file, &(arc->suppl.all), sizeof( arc->suppl.all ) );
+      vector_checkpoint_write( table->table->fr_states[arc->from], file );
+      vector_checkpoint_write( table->table->to_states[arc->to], file );
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data vector_checkpoint_read Throw
+
+ Restores the state transition table of the given FSM from a checkpoint file.  The table read from the CDD
+ file contains the first transitions of the checkpointed table, so adding the stored transitions in order
+ recreates the same states and transitions at the same indices.
+*/
+static void checkpoint_read_fsm(
+  FILE* file,  /*!< Pointer to checkpoint file to read from */
+  fsm*  table  /*!< Pointer to FSM to restore */
+) { PROFILE(CHECKPOINT_READ_FSM);
+
+  unsigned int num;
+  unsigned int i;
+
+  checkpoint_read_data( file, &num, sizeof( num ) );
+
+  if( (table->table == NULL) ? (num > 0) : (num < table->table->num_arcs) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  if( table->table != NULL ) {
+
+    fsuppl  suppl;
+    vector* fr_st = vector_create( table->from_state->value->width, VTYPE_VAL, table->from_state->value->suppl.part.data_type, TRUE );
+    vector* to_st = vector_create( table->to_state->value->width, VTYPE_VAL, table->to_state->value->suppl.part.data_type, TRUE );
+
+    Try {
+
+      checkpoint_read_data( file, &(suppl.all), sizeof( suppl.all ) );
+
+      for( i=0; i<num; i++ ) {
+        asuppl arc_suppl;
+        checkpoint_read_data( file, &(arc_suppl.all), sizeof( arc_suppl.all ) );
+        vector_checkpoint_read( fr_st, file );
+        vector_checkpoint_read( to_st, file );
+        arc_add( table->table, fr_st, to_st, 1, arc_suppl.part.excluded );
+        if( table->table->num_arcs <= i ) {
+          print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+        table->table->arcs[i]->suppl.all = arc_suppl.all;
+      }
+
+    } Catch_anonymous {
+      vector_dealloc( fr_st );
+      vector_dealloc( to_st );
+      Throw 0;
+    }
+
+    table->table->suppl.all = suppl.all;
+
+    vector_dealloc( fr_st );
+    vector_dealloc( to_st );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data vector_checkpoint_write checkpoint_write_expression checkpoint_write_fsm
+
+ Writes the signals, expressions and FSMs of all functional units to a checkpoint file, preceded by the
+ sizes of each functional unit so that the reader can make sure that the checkpoint matches the design.
+*/
+static void checkpoint_write_design(
+  FILE* file  /*!< Pointer to checkpoint file to write to */
+) { PROFILE(CHECKPOINT_WRITE_DESIGN);
+
+  unsigned int i, j;
+
+  checkpoint_write_data( file, &ckpt_funit_num, sizeof( ckpt_funit_num ) );
+
+  for( i=0; i<ckpt_funit_num; i++ ) {
+    checkpoint_write_data( file, &(ckpt_funits[i]->id), sizeof( ckpt_funits[i]->id ) );
+    checkpoint_write_data( file, &(ckpt_funits[i]->sig_size), sizeof( ckpt_funits[i]->sig_size ) );
+    checkpoint_write_data( file, &(ckpt_funits[i]->exp_size), sizeof( ckpt_funits[i]->exp_size ) );
+    checkpoint_write_data( file, &(ckpt_funits[i]->fsm_size), sizeof( ckpt_funits[i]->fsm_size ) );
+  }
+
+  for( i=0; i<ckpt_funit_num; i++ ) {
+    func_unit* funit = ckpt_funits[i];
+    for( j=0; j<funit->sig_size; j++ ) {
+      if( funit->sigs[j]->value != NULL ) {
+        vector_checkpoint_write( funit->sigs[j]->value, file );
+      }
+    }
+    for( j=0; j<funit->exp_size; j++ ) {
+      checkpoint_write_expression( file, funit->exps[j] );
+    }
+    for( j=0; j<funit->fsm_size; j++ ) {
+      checkpoint_write_fsm( file, funit->fsms[j] );
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data vector_checkpoint_read checkpoint_read_expression checkpoint_read_fsm Throw
+
+ Restores the signals, expressions and FSMs of all functional units from a checkpoint file.
+*/
+static void checkpoint_read_design(
+  FILE* file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(CHECKPOINT_READ_DESIGN);
+
+  unsigned int i, j;
+  unsigned int num;
+
+  checkpoint_read_data( file, &num, sizeof( num ) );
+
+  if( num != ckpt_funit_num ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  for( i=0; i<ckpt_funit_num; i++ ) {
+    int          id;
+    unsigned int sizes[3];
+    checkpoint_read_data( file, &id, sizeof( id ) );
+    checkpoint_read_data( file, sizes, sizeof( sizes ) );
+    if( (id != ckpt_funits[i]->id) || (sizes[0] != ckpt_funits[i]->sig_size) ||
+        (sizes[1] != ckpt_funits[i]->exp_size) || (sizes[2] != ckpt_funits[i]->fsm_size) ) {
+      print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+  }
+
+  for( i=0; i<ckpt_funit_num; i++ ) {
+    func_unit* funit = ckpt_funits[i];
+    for( j=0; j<funit->sig_size; j++ ) {
+      if( funit->sigs[j]->value != NULL ) {
+        vector_checkpoint_read( funit->sigs[j]->value, file );
+      }
+    }
+    for( j=0; j<funit->exp_size; j++ ) {
+      checkpoint_read_expression( file, funit->exps[j] );
+    }
+    for( j=0; j<funit->fsm_size; j++ ) {
+      checkpoint_read_fsm( file, funit->fsms[j] );
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if a checkpoint should be taken after the timestep that was just simulated; otherwise,
+         returns FALSE.
+
+ Called by the dumpfile readers after each simulated timestep.  A checkpoint is due once the number of
+ timesteps given by the -checkpoint-steps option has been simulated or the number of minutes given by the
+ -checkpoint-minutes option has passed since the last checkpoint.
+*/
+bool checkpoint_due() { PROFILE(CHECKPOINT_DUE);
+
+  bool retval = FALSE;
+
+  if( checkpoint_file != NULL ) {
+
+    ckpt_steps_done++;
+
+    if( (checkpoint_steps > 0) && (ckpt_steps_done >= checkpoint_steps) ) {
+      retval = TRUE;
+    } else if( checkpoint_minutes > 0 ) {
+      time_t now = time( NULL );
+      if( ckpt_last_time == 0 ) {
+        ckpt_last_time = now;
+      } else if( difftime( now, ckpt_last_time ) >= (checkpoint_minutes * 60.0) ) {
+        retval = TRUE;
+      }
+    }
+
+    if( retval ) {
+      ckpt_steps_done = 0;
+      ckpt_last_time  = time( NULL );
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ Writes the current simulation state to the checkpoint file specified with the -checkpoint option.  Called
+ at the end of timestep time, before any value changes of timestep next_time have been applied.  If the
+ checkpoint cannot be written, a warning is output and scoring continues with the previous checkpoint left
+ in place.
+*/
+void checkpoint_write(
+  uint64 time,       /*!< Last timestep that was simulated */
+  uint64 next_time,  /*!< Timestep of the dumpfile value changes that follow */
+  uint64 offset      /*!< Byte offset of the value changes that follow in a VCD dumpfile */
+) { PROFILE(CHECKPOINT_WRITE);
+
+  unsigned int tmp_size = strlen( checkpoint_file ) + 5;
+  char*        tmp_name = (char*)malloc_safe( tmp_size );
+  FILE*        file;
+  unsigned int rv;
+
+  rv = snprintf( tmp_name, tmp_size, "%s.tmp", checkpoint_file );
+  assert( rv < tmp_size );
+
+  if( (file = fopen( tmp_name, "wb" )) != NULL ) {
+
+    volatile bool ok = TRUE;
+
+    checkpoint_funits_create();
+
+    Try {
+
+      unsigned int ul_size  = sizeof( ulong );
+      unsigned int name_len = strlen( ckpt_dump_file );
+      long         seed     = sys_task_get_random_seed();
+
+      checkpoint_write_data( file, CHECKPOINT_MAGIC, strlen( CHECKPOINT_MAGIC ) );
+      checkpoint_write_data( file, &ul_size, sizeof( ul_size ) );
+      checkpoint_write_data( file, &ckpt_dump_mode, sizeof( ckpt_dump_mode ) );
+      checkpoint_write_data( file, &name_len, sizeof( name_len ) );
+      checkpoint_write_data( file, ckpt_dump_file, name_len );
+      checkpoint_write_data( file, &time, sizeof( time ) );
+      checkpoint_write_data( file, &next_time, sizeof( next_time ) );
+      checkpoint_write_data( file, &offset, sizeof( offset ) );
+      checkpoint_write_data( file, &num_timesteps, sizeof( num_timesteps ) );
+      checkpoint_write_data( file, &seed, sizeof( seed ) );
+
+      checkpoint_write_design( file );
+      reentrant_checkpoint_write( file );
+      sim_checkpoint_write( file );
+
+    } Catch_anonymous {
+      ok = FALSE;
+    }
+
+    checkpoint_funits_dealloc();
+
+    if( fclose( file ) != 0 ) {
+      ok = FALSE;
+    }
+
+    /* Replace the previous checkpoint only once the new one is complete */
+    if( !ok || (rename( tmp_name, checkpoint_file ) != 0) ) {
+      (void)remove( tmp_name );
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to write checkpoint file %s", checkpoint_file );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, WARNING, __FILE__, __LINE__ );
+    }
+
+  } else {
+
+    rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to open checkpoint file %s for writing", tmp_name );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, WARNING, __FILE__, __LINE__ );
+
+  }
+
+  free_safe( tmp_name, tmp_size );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data Throw Throw Throw
+
+ Reads and checks the header of a checkpoint file, storing the dumpfile position to resume from and restoring
+ the global simulation counters.
+*/
+static void checkpoint_read_header(
+  FILE* file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(CHECKPOINT_READ_HEADER);
+
+  char         magic[sizeof( CHECKPOINT_MAGIC )];
+  unsigned int ul_size;
+  int          dump_mode;
+  unsigned int name_len;
+  long         seed;
+  char*        name;
+  bool         same;
+
+  checkpoint_read_data( file, magic, strlen( CHECKPOINT_MAGIC ) );
+  magic[strlen( CHECKPOINT_MAGIC )] = '\0';
+  if( strcmp( magic, CHECKPOINT_MAGIC ) != 0 ) {
+    print_output( "Specified checkpoint file is not a Covered checkpoint file", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  checkpoint_read_data( file, &ul_size, sizeof( ul_size ) );
+  checkpoint_read_data( file, &dump_mode, sizeof( dump_mode ) );
+  checkpoint_read_data( file, &name_len, sizeof( name_len ) );
+  if( (ul_size != sizeof( ulong )) || (dump_mode != ckpt_dump_mode) || (name_len != strlen( ckpt_dump_file )) ) {
+    print_output( "Checkpoint file was not written while scoring the specified dumpfile", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  name = (char*)malloc_safe( name_len + 1 );
+  Try {
+    checkpoint_read_data( file, name, name_len );
+  } Catch_anonymous {
+    free_safe( name, (name_len + 1) );
+    Throw 0;
+  }
+  name[name_len] = '\0';
+  same = (strcmp( name, ckpt_dump_file ) == 0);
+  free_safe( name, (name_len + 1) );
+
+  if( !same ) {
+    print_output( "Checkpoint file was not written while scoring the specified dumpfile", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  checkpoint_read_data( file, &checkpoint_resume_time, sizeof( checkpoint_resume_time ) );
+  checkpoint_read_data( file, &checkpoint_resume_next_time, sizeof( checkpoint_resume_next_time ) );
+  checkpoint_read_data( file, &checkpoint_resume_offset, sizeof( checkpoint_resume_offset ) );
+  checkpoint_read_data( file, &num_timesteps, sizeof( num_timesteps ) );
+  checkpoint_read_data( file, &seed, sizeof( seed ) );
+
+  sys_task_srandom( seed );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_header checkpoint_read_design reentrant_checkpoint_read sim_checkpoint_read
+
+ Prepares for taking checkpoints of the scoring of the given dumpfile.  If the -resume option was specified
+ and the checkpoint file exists, the simulation state is restored from it and the dumpfile readers continue
+ from the stored dumpfile position.  This must be called after the design has been read and the simulator
+ has been initialized.
+*/
+void checkpoint_initialize(
+  const char* dump_file,  /*!< Name of dumpfile being scored */
+  int         dump_mode   /*!< Type of dumpfile being scored (see \ref dumpfile_fmt for legal values) */
+) { PROFILE(CHECKPOINT_INITIALIZE);
+
+  FILE*        file;
+  unsigned int rv;
+
+  ckpt_dump_file     = dump_file;
+  ckpt_dump_mode     = dump_mode;
+  ckpt_steps_done    = 0;
+  ckpt_last_time     = 0;
+  checkpoint_resumed = FALSE;
+
+  if( checkpoint_resume ) {
+
+    if( (file = fopen( checkpoint_file, "rb" )) != NULL ) {
+
+      checkpoint_funits_create();
+
+      Try {
+        checkpoint_read_header( file );
+        checkpoint_read_design( file );
+        reentrant_checkpoint_read( file );
+        sim_checkpoint_read( file );
+      } Catch_anonymous {
+        checkpoint_funits_dealloc();
+        rv = fclose( file );
+        assert( rv == 0 );
+        Throw 0;
+      }
+
+      checkpoint_funits_dealloc();
+      rv = fclose( file );
+      assert( rv == 0 );
+
+      checkpoint_resumed = TRUE;
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Resuming from checkpoint file %s after timestep %" FMT64 "u", checkpoint_file, checkpoint_resume_time );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+    } else {
+
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Checkpoint file %s does not exist, scoring from the start of the dumpfile", checkpoint_file );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, WARNING, __FILE__, __LINE__ );
+
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
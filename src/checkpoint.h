@@ -0,0 +1,85 @@
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     checkpoint.h
+ \date     10/18/2026
+ \brief    Contains functions for saving and restoring the simulation state of a score run.
+*/
+
+#include <stdio.h>
+
+#include "defines.h"
+
+
+/*! \brief Writes the given bytes to a checkpoint file. */
+void checkpoint_write_data(
+  FILE*        file,
+  const void*  data,
+  unsigned int size
+);
+
+/*! \brief Reads the given number of bytes from a checkpoint file. */
+void checkpoint_read_data(
+  FILE*        file,
+  void*        data,
+  unsigned int size
+);
+
+/*! \brief Writes a reference to the given functional unit to a checkpoint file. */
+void checkpoint_write_funit(
+  FILE*            file,
+  const func_unit* funit
+);
+
+/*! \brief Reads a functional unit reference from a checkpoint file. */
+func_unit* checkpoint_read_funit(
+  FILE* file
+);
+
+/*! \brief Creates a sorted pointer table for the given pointer array. */
+ckpt_ptr* checkpoint_ptr_map_create(
+  void* const* ptrs,
+  unsigned int num
+);
+
+/*! \brief Finds the index of the given pointer in a sorted pointer table. */
+int checkpoint_ptr_map_find(
+  const ckpt_ptr* map,
+  unsigned int    num,
+  const void*     ptr
+);
+
+/*! \brief Returns TRUE if a checkpoint should be taken after the current timestep. */
+bool checkpoint_due();
+
+/*! \brief Writes the current simulation state to the checkpoint file. */
+void checkpoint_write(
+  uint64 time,
+  uint64 next_time,
+  uint64 offset
+);
+
+/*! \brief Prepares for taking checkpoints, restoring the simulation state from the checkpoint file if resuming. */
+void checkpoint_initialize(
+  const char* dump_file,
+  int         dump_mode
+);
+
+#endif
+
@@ -408,7 +408,7 @@ static bool cli_display_expression(
     expression*  exp;                /* Pointer to found expression */
 
     /* Find the expression */
-    exp = exp_link_find( id, funit->exps, funit->exp_size );
+    exp = funit_lookup_expression( id, funit );
     assert( exp != NULL );
 
     /* Output the expression */
@@ -601,7 +601,7 @@ static bool cli_parse_input(
               }
             } else if( sscanf( line, "%d%n", &id, &chars_read ) == 1 ) {
               if( (funit = funit_find_by_id( id )) != NULL ) {
-                expression* exp = exp_link_find( id, funit->exps, funit->exp_size );
+                expression* exp = funit_lookup_expression( id, funit );
                 assert( exp != NULL );
                 cli_goto_vec1 = exp->value;
               } else {
@@ -2942,7 +2942,7 @@ void combination_get_expression(
   assert( funit != NULL );
 
   /* Find the expression itself */
-  exp = exp_link_find( expr_id, funit->exps, funit->exp_size );
+  exp = funit_lookup_expression( expr_id, funit );
   assert( exp != NULL );
 
   /* Generate line of code that missed combinational coverage */
@@ -3042,7 +3042,7 @@ void combination_get_coverage(
   assert( funit != NULL );
 
   /* Find statement containing this expression */
-  exp = exp_link_find( exp_id, funit->exps, funit->exp_size );
+  exp = funit_lookup_expression( exp_id, funit );
   assert( exp != NULL );
 
   /* Now find the subexpression that matches the given underline ID */
@@ -32,8 +32,10 @@
 
 #include "attr.h"
 #include "binding.h"
+#include "checkpoint.h"
 #include "db.h"
 #include "defines.h"
+#include "dumppipe.h"
 #include "enumerate.h"
 #include "expr.h"
 #include "fsm.h"
@@ -63,6 +65,10 @@ extern str_link*   no_score_head;
 extern char        user_msg[USER_MSG_LENGTH];
 extern isuppl      info_suppl;
 extern uint64      timestep_update;
+#ifndef VPI_ONLY
+extern uint64      score_start_time;
+extern uint64      score_end_time;
+#endif
 extern bool        debug_mode;
 extern int*        fork_block_depth;
 extern int         fork_depth;
@@ -76,6 +82,9 @@ extern int         curr_sig_id;
 extern int         curr_arc_id;
 extern int         vcd_symtab_size;
 extern bool        instance_specified;
+#ifdef DUMPPIPE_SUPPORTED
+extern THREAD_LOCAL bool dumppipe_in_decoder;
+#endif
 extern char*       top_instance;
 
 
@@ -110,6 +119,44 @@ int curr_inst_scope_size = 0;
 */
 /*@null@*/ funit_inst* curr_instance = NULL;
 
+/*!
+ List of the 2-state signals that were parsed (str is the functional unit name, str2 is the signal name and suppl is the
+ functional unit type).  The 2-state attribute is not stored in the CDD file, so this list is used by
+ db_mark_2state_signals to mark the signal vectors when the CDD file that was just created is read back in for scoring.
+*/
+/*@null@*/ str_link* two_state_head = NULL;
+
+/*!
+ Pointer to the tail of the two_state_head list.
+*/
+/*@null@*/ str_link* two_state_tail = NULL;
+
+/*!
+ Minimum number of children that an instance must have before a hash table of its children is built when
+ looking up dumpfile scopes (smaller instances are searched linearly).
+*/
+#define VCD_SCOPE_HASH_MIN_CHILDREN  8
+
+struct vcd_scope_s;
+typedef struct vcd_scope_s vcd_scope;
+struct vcd_scope_s {
+  funit_inst*  inst;             /*!< Pointer to instance that this dumpfile scope matches (NULL if not in the design) */
+  funit_inst** child_hash;       /*!< Hash table of the named children of inst keyed on instance name (NULL if not built) */
+  unsigned int child_hash_size;  /*!< Number of buckets in child_hash (always a power of two) */
+  bool         has_unnamed;      /*!< Set to TRUE if inst has unnamed children (which are not stored in child_hash) */
+};
+
+/*!
+ Stack of scopes entered by db_set_vcd_scope.  Element i matches curr_inst_scope[i] so that entering or leaving a
+ dumpfile scope only needs to look at the children of the enclosing scope instead of searching the whole design.
+*/
+/*@null@*/ static vcd_scope* vcd_scope_stack = NULL;
+
+/*!
+ Allocated number of elements in the vcd_scope_stack array.
+*/
+static int vcd_scope_stack_size = 0;
+
 /*!
  Pointer to head of list of module names that need to be parsed yet.  These names
  are added in the db_add_instance function and removed in the db_end_module function.
@@ -218,6 +265,7 @@ db* db_create() { PROFILE(DB_CREATE);
   new_db->funit_tail           = NULL;
   new_db->fver_head            = NULL;
   new_db->fver_tail            = NULL;
+  new_db->excl_index           = NULL;
   new_db->leading_hierarchies  = NULL;
   new_db->leading_hier_num     = 0;
   new_db->leading_hiers_differ = FALSE;
@@ -271,6 +319,12 @@ void db_close() { PROFILE(DB_CLOSE);
     db_list[i]->fver_head = NULL;
     db_list[i]->fver_tail = NULL;
 
+#ifndef RUNLIB
+    /* Deallocate the exclusion ID index */
+    instance_exclusion_index_dealloc( db_list[i]->excl_index );
+    db_list[i]->excl_index = NULL;
+#endif /* RUNLIB */
+
     /* Deallocate database structure */
     free_safe( db_list[i], sizeof( db ) );
 
@@ -291,6 +345,12 @@ void db_close() { PROFILE(DB_CLOSE);
 
   /* Free memory associated with current instance scope */
   assert( curr_inst_scope_size == 0 );
+  for( i=0; i<(unsigned int)vcd_scope_stack_size; i++ ) {
+    free_safe( vcd_scope_stack[i].child_hash, (sizeof( funit_inst* ) * vcd_scope_stack[i].child_hash_size) );
+  }
+  free_safe( vcd_scope_stack, (sizeof( vcd_scope ) * vcd_scope_stack_size) );
+  vcd_scope_stack      = NULL;
+  vcd_scope_stack_size = 0;
 
   /* Deallocate the exclusion identifier container, if it exists */
   free_safe( exclusion_id, db_get_exclusion_id_size() );
@@ -760,6 +820,14 @@ bool db_read(
 
   }
 
+#ifndef RUNLIB
+  /* The instance trees may have changed so any exclusion ID index built for them is stale */
+  if( db_list != NULL ) {
+    instance_exclusion_index_dealloc( db_list[curr_db]->excl_index );
+    db_list[curr_db]->excl_index = NULL;
+  }
+#endif /* RUNLIB */
+
 #ifdef DEBUG_MODE
   /* Display the instance trees, if we are debugging */
   if( debug_mode && (db_list != NULL) ) {
@@ -787,6 +855,34 @@ bool db_read(
 }
 
 #ifndef RUNLIB
+/*!
+ Marks the vectors of the 2-state signals that were parsed in this run so that they are simulated with the 2-state
+ assignment kernel and deallocates the list of parsed 2-state signals.  This must be called after the CDD file that
+ was just written by the parser has been read back in.  Since the 2-state attribute is not stored in the CDD file,
+ scoring a CDD file that was created by an earlier run simulates all signals as 4-state values.
+*/
+void db_mark_2state_signals() { PROFILE(DB_MARK_2STATE_SIGNALS);
+
+  str_link* strl = two_state_head;
+
+  while( strl != NULL ) {
+    funit_link* funitl = funit_link_find( strl->str, strl->suppl, db_list[curr_db]->funit_head );
+    if( funitl != NULL ) {
+      vsignal* sig = funit_find_signal( strl->str2, funitl->funit );
+      if( (sig != NULL) && (sig->value->suppl.part.type == VTYPE_SIG) && (sig->value->suppl.part.data_type == VDATA_UL) ) {
+        sig->value->two_state = 1;
+      }
+    }
+    strl = strl->next;
+  }
+
+  str_link_delete_list( two_state_head );
+  two_state_head = two_state_tail = NULL;
+
+  PROFILE_END;
+
+}
+
 /*! \brief Assigns instance IDs to all instances. */
 void db_assign_ids() { PROFILE(DB_ASSIGN_IDS);
 
@@ -1521,7 +1617,7 @@ void db_add_declared_param(
     }
 #endif
 
-    if( mod_parm_find( name, curr_funit->param_head ) == NULL ) {
+    if( funit_lookup_param( name, curr_funit ) == NULL ) {
 
       /* Add parameter to module parameter list */
       mparm = mod_parm_add( name, msb, lsb, is_signed, expr, (local ? PARAM_TYPE_DECLARED_LOCAL : PARAM_TYPE_DECLARED), curr_funit, NULL );
@@ -1647,6 +1743,7 @@ void db_add_signal(
   sig_range* prange,     /*!< Specifies packed signal range information */
   sig_range* urange,     /*!< Specifies unpacked signal range information */
   bool       is_signed,  /*!< Specifies that this signal is signed (TRUE) or not (FALSE) */
+  bool       is_2state,  /*!< Specifies that this signal can only hold 0 and 1 values (TRUE) or not (FALSE) */
   bool       mba,        /*!< Set to TRUE if specified signal must be assigned by simulated results */
   int        line,       /*!< Line number where signal was declared */
   int        col,        /*!< Starting column where signal was declared */
@@ -1667,7 +1764,7 @@ void db_add_signal(
 #endif
 
   /* Add signal to current module's signal list if it does not already exist */
-  if( (sig = sig_link_find( name, curr_funit->sigs, curr_funit->sig_size )) == NULL ) {
+  if( (sig = funit_lookup_signal( name, curr_funit )) == NULL ) {
 
     /* Create the signal */
     if( (type == SSUPPL_TYPE_GENVAR) || (type == SSUPPL_TYPE_DECL_SREAL) ) {
@@ -1773,6 +1870,13 @@ void db_add_signal(
     /* Indicate signed attribute */
     sig->value->suppl.part.is_signed = is_signed;
 
+    /* Remember 2-state signals so that they can be marked when the CDD file is read back in for scoring */
+    if( is_2state ) {
+      str_link* strl = str_link_add( strdup_safe( curr_funit->name ), &two_state_head, &two_state_tail );
+      strl->str2  = strdup_safe( name );
+      strl->suppl = curr_funit->suppl.part.type;
+    }
+
     /* Indicate handled attribute */
     sig->suppl.part.not_handled = handled ? 0 : 1;
 
@@ -2664,6 +2768,7 @@ void db_remove_statement_from_current_funit(
 
     /* Remove expression from current module expression list and delete expressions */
     exp_link_remove( stmt->exp, &(curr_funit->exps), &(curr_funit->exp_size), TRUE );
+    funit_index_clear( curr_funit );
 
     /* Remove this statement link from the current module's stmt_link list */
     stmt_link_unlink( stmt, &(curr_funit->stmt_head), &(curr_funit->stmt_tail) );
@@ -3073,14 +3178,141 @@ void db_sync_curr_instance() { PROFILE(DB_SYNC_CURR_INSTANCE);
 } 
 
 /*!
- Sets the curr_inst_scope global variable to the specified scope.
+ Builds the hash table of the named children of the instance of the given dumpfile scope.
+*/
+static void db_vcd_scope_build_hash(
+  vcd_scope* vscope  /*!< Pointer to dumpfile scope to build child hash table for */
+) { PROFILE(DB_VCD_SCOPE_BUILD_HASH);
+
+  funit_inst*  child;
+  unsigned int num = 0;
+
+  for( child=vscope->inst->child_head; child!=NULL; child=child->next ) {
+    num++;
+  }
+
+  vscope->child_hash_size = 16;
+  while( (num * 2) > vscope->child_hash_size ) {
+    vscope->child_hash_size <<= 1;
+  }
+  vscope->child_hash = (funit_inst**)calloc_safe( vscope->child_hash_size, sizeof( funit_inst* ) );
+
+  /* Unnamed scopes are searched through, so they are not stored in the table */
+  for( child=vscope->inst->child_head; child!=NULL; child=child->next ) {
+    if( funit_is_unnamed( child->funit ) ) {
+      vscope->has_unnamed = TRUE;
+    } else {
+      unsigned int bucket = scope_hash( child->name ) & (vscope->child_hash_size - 1);
+      while( vscope->child_hash[bucket] != NULL ) {
+        bucket = (bucket + 1) & (vscope->child_hash_size - 1);
+      }
+      vscope->child_hash[bucket] = child;
+    }
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the child instance with the given key name that matches the given dumpfile
+         scope name if one exists in the child hash table; otherwise, returns NULL.
+*/
+static funit_inst* db_vcd_scope_probe_hash(
+  const vcd_scope* vscope,  /*!< Pointer to dumpfile scope containing the child hash table */
+  const char*      key,     /*!< Instance name to search for */
+  char*            scope    /*!< Dumpfile scope name to match (may contain an instance array index) */
+) { PROFILE(DB_VCD_SCOPE_PROBE_HASH);
+
+  funit_inst*  inst   = NULL;
+  unsigned int bucket = scope_hash( key ) & (vscope->child_hash_size - 1);
+
+  while( (vscope->child_hash[bucket] != NULL) && (inst == NULL) ) {
+    if( scope_compare( vscope->child_hash[bucket]->name, key ) ) {
+      inst = instance_find_scope( vscope->child_hash[bucket], scope, TRUE );
+    }
+    bucket = (bucket + 1) & (vscope->child_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( inst );
+
+}
+
+/*!
+ \return Returns a pointer to the child instance of the given dumpfile scope's instance that matches the
+         given dumpfile scope name if one exists; otherwise, returns NULL.
+
+ Finds the child instance that instance_find_scope would find when searching for the given scope name
+ below the instance of the given dumpfile scope.  Instances with many children are searched with a
+ hash table that is built the first time that one of their children is searched for.
+*/
+static funit_inst* db_vcd_scope_find_child(
+  vcd_scope* vscope,  /*!< Pointer to enclosing dumpfile scope */
+  char*      scope    /*!< Name of dumpfile scope to find */
+) { PROFILE(DB_VCD_SCOPE_FIND_CHILD);
+
+  funit_inst* inst = NULL;
+  funit_inst* child;
+  int         num  = 0;
+
+  /* Search small instances linearly */
+  child = vscope->inst->child_head;
+  while( (child != NULL) && (num < VCD_SCOPE_HASH_MIN_CHILDREN) && (vscope->child_hash == NULL) ) {
+    child = child->next;
+    num++;
+  }
+
+  if( (child == NULL) && (vscope->child_hash == NULL) ) {
+
+    child = vscope->inst->child_head;
+    while( (child != NULL) && ((inst = instance_find_scope( child, scope, TRUE )) == NULL) ) {
+      child = child->next;
+    }
+
+  } else {
+
+    char bname[4096];
+    int  index;
+
+    if( vscope->child_hash == NULL ) {
+      db_vcd_scope_build_hash( vscope );
+    }
+
+    /* Instance arrays are stored under their base name */
+    if( ((inst = db_vcd_scope_probe_hash( vscope, scope, scope )) == NULL) &&
+        (sscanf( scope, "%[a-zA-Z0-9_][%d]", bname, &index ) == 2) ) {
+      inst = db_vcd_scope_probe_hash( vscope, bname, scope );
+    }
+
+    /* If the scope was not found, it may be beneath an unnamed scope */
+    if( (inst == NULL) && vscope->has_unnamed ) {
+      child = vscope->inst->child_head;
+      while( (child != NULL) && ((inst = instance_find_scope( child, scope, TRUE )) == NULL) ) {
+        child = child->next;
+      }
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( inst );
+
+}
+
+/*!
+ Sets the curr_inst_scope global variable to the specified scope.  If the enclosing scope is in the design,
+ the current instance is found among its children; otherwise, the whole design is searched.
 */
 void db_set_vcd_scope(
   const char* scope  /*!< Current VCD scope */
 ) { PROFILE(DB_SET_VCD_SCOPE);
 
-  char tmp_scope[4096];
-  int  tmp_index;
+  char       tmp_scope[4096];
+  int        tmp_index;
+  vcd_scope* vscope;
 
 #ifdef DEBUG_MODE
   if( debug_mode ) {
@@ -3096,7 +3328,7 @@ void db_set_vcd_scope(
   curr_inst_scope = (char**)realloc_safe( curr_inst_scope, (sizeof( char* ) * curr_inst_scope_size), (sizeof( char* ) * (curr_inst_scope_size + 1)) );
 
   /* If this is a Verilator run and the scope refers to a generated scope, we need to switch the parenthesis to brackets */
-  if( sscanf( scope, "%[^(](%d)", tmp_scope, &tmp_index ) == 2 ) {
+  if( (strchr( scope, '(' ) != NULL) && (sscanf( scope, "%[^(](%d)", tmp_scope, &tmp_index ) == 2) ) {
     char         index_str[30];
     unsigned int rv;
     strcat( tmp_scope, "[" );
@@ -3110,8 +3342,32 @@ void db_set_vcd_scope(
   }
   curr_inst_scope_size++;
 
-  /* Synchronize the current instance to the value of curr_inst_scope */
-  db_sync_curr_instance();
+  /* Grow the scope stack, if needed */
+  if( curr_inst_scope_size > vcd_scope_stack_size ) {
+    int i;
+    int new_size = (vcd_scope_stack_size == 0) ? 16 : (vcd_scope_stack_size * 2);
+    vcd_scope_stack = (vcd_scope*)realloc_safe( vcd_scope_stack, (sizeof( vcd_scope ) * vcd_scope_stack_size), (sizeof( vcd_scope ) * new_size) );
+    for( i=vcd_scope_stack_size; i<new_size; i++ ) {
+      vcd_scope_stack[i].child_hash      = NULL;
+      vcd_scope_stack[i].child_hash_size = 0;
+    }
+    vcd_scope_stack_size = new_size;
+  }
+
+  /* Initialize the new scope (its hash table may have been left from a scope stack that was abandoned) */
+  vscope = &(vcd_scope_stack[curr_inst_scope_size - 1]);
+  free_safe( vscope->child_hash, (sizeof( funit_inst* ) * vscope->child_hash_size) );
+  vscope->child_hash      = NULL;
+  vscope->child_hash_size = 0;
+  vscope->has_unnamed     = FALSE;
+
+  /* Find the current instance from the enclosing scope if possible; otherwise, search the entire design */
+  if( (curr_inst_scope_size > 1) && (vcd_scope_stack[curr_inst_scope_size - 2].inst != NULL) ) {
+    curr_instance = db_vcd_scope_find_child( &(vcd_scope_stack[curr_inst_scope_size - 2]), curr_inst_scope[curr_inst_scope_size - 1] );
+  } else {
+    db_sync_curr_instance();
+  }
+  vscope->inst = curr_instance;
 
   PROFILE_END;
 
@@ -3136,11 +3392,18 @@ void db_vcd_upscope() { PROFILE(DB_VCD_UPSCOPE);
   /* Deallocate the last scope item */
   if( curr_inst_scope_size > 0 ) {
 
+    vcd_scope* vscope = &(vcd_scope_stack[curr_inst_scope_size - 1]);
+
+    free_safe( vscope->child_hash, (sizeof( funit_inst* ) * vscope->child_hash_size) );
+    vscope->child_hash      = NULL;
+    vscope->child_hash_size = 0;
+
     curr_inst_scope_size--;
     free_safe( curr_inst_scope[curr_inst_scope_size], (strlen( curr_inst_scope[curr_inst_scope_size] ) + 1) );
     curr_inst_scope = (char**)realloc_safe( curr_inst_scope, (sizeof( char* ) * (curr_inst_scope_size + 1)), (sizeof( char* ) * curr_inst_scope_size) );
 
-    db_sync_curr_instance();
+    /* The enclosing scope has already been found */
+    curr_instance = (curr_inst_scope_size > 0) ? vcd_scope_stack[curr_inst_scope_size - 1].inst : NULL;
 
   }
 
@@ -3149,15 +3412,20 @@ void db_vcd_upscope() { PROFILE(DB_VCD_UPSCOPE);
 }
 
 /*!
+ \return Returns TRUE if the symbol was bound to a signal/expression in the design; otherwise, returns FALSE
+         to indicate that value changes of this symbol are not needed.
+
  Creates a new entry in the symbol table for the specified signal and symbol.
 */
-void db_assign_symbol(
+bool db_assign_symbol(
   char*       name,    /*!< Name of signal/expression to set value to */
   const char* symbol,  /*!< Symbol of the associated signal/expression symbol */
   int         msb,     /*!< Most significant bit of symbol to set */
   int         lsb      /*!< Least significant bit of symbol to set */
 ) { PROFILE(DB_ASSIGN_SYMBOL);
 
+  int orig_symtab_size = vcd_symtab_size;  /* Number of symbol table entries before this symbol is added */
+
 #ifdef DEBUG_MODE
   if( debug_mode ) {
     char*        scope = db_gen_curr_inst_scope();
@@ -3398,7 +3666,7 @@ void db_assign_symbol(
       }
 
       /* Find the signal that matches the specified signal name */
-      if( ((sig = sig_link_find( name, curr_instance->funit->sigs, curr_instance->funit->sig_size )) != NULL) ||
+      if( ((sig = funit_lookup_signal( name, curr_instance->funit )) != NULL) ||
           scope_find_signal( name, curr_instance->funit, &sig, &found_funit, 0 ) ) {
 
         /* Only add the symbol if we are not going to generate this value ourselves */
@@ -3417,6 +3685,8 @@ void db_assign_symbol(
 
   PROFILE_END;
 
+  return( vcd_symtab_size != orig_symtab_size );
+
 }
 
 /*!
@@ -3444,8 +3714,17 @@ void db_set_symbol_char(
   val[0] = value;
   val[1] = '\0';
 
+#ifdef DUMPPIPE_SUPPORTED
+  /* If we are running in the dumpfile decoding thread, pass the value to the main thread */
+  if( dumppipe_in_decoder ) {
+    dumppipe_add_value( sym, val );
+  } else {
+    symtable_set_value( sym, val );
+  }
+#else
   /* Set value of all matching occurrences in current timestep. */
   symtable_set_value( sym, val );
+#endif
 
   PROFILE_END;
 
@@ -3470,8 +3749,52 @@ void db_set_symbol_string(
   }
 #endif
 
+#ifdef DUMPPIPE_SUPPORTED
+  /* If we are running in the dumpfile decoding thread, pass the value to the main thread */
+  if( dumppipe_in_decoder ) {
+    dumppipe_add_value( sym, value );
+  } else {
+    symtable_set_value( sym, value );
+  }
+#else
   /* Set value of all matching occurrences in current timestep. */
   symtable_set_value( sym, value );
+#endif
+
+  PROFILE_END;
+
+}
+
+/*!
+ Searches the timestep symtable followed by the VCD symbol table searching for
+ the symbol that matches the specified argument.  Once a symbol is found, its value
+ parameter is set to the specified real value, which is kept in binary form so that
+ dumpfile readers and simulators that produce binary reals do not need to format them.
+*/
+void db_set_symbol_real(
+  const char* sym,   /*!< Name of symbol to set real value to */
+  double      value  /*!< Real value to set symbol table entry to */
+) { PROFILE(DB_SET_SYMBOL_REAL);
+
+#ifdef DEBUG_MODE
+  if( debug_mode ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In db_set_symbol_real, sym: %s, value: %.17g", sym, value );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+  }
+#endif
+
+#ifdef DUMPPIPE_SUPPORTED
+  /* If we are running in the dumpfile decoding thread, pass the value to the main thread */
+  if( dumppipe_in_decoder ) {
+    dumppipe_add_real( sym, value );
+  } else {
+    symtable_set_real( sym, value );
+  }
+#else
+  /* Set value of all matching occurrences in current timestep. */
+  symtable_set_real( sym, value );
+#endif
 
   PROFILE_END;
 
@@ -3488,10 +3811,10 @@ void db_set_symbol_string(
  expression queue after that expression has completed its evaluation.  When the
  expression queue is empty, we are finished for this clock period.
 */
-bool db_do_timestep(
+static bool db_simulate_timestep(
   uint64 time,  /*!< Current time step value being performed */
   bool   final  /*!< Specifies that this is the final timestep */
-) { PROFILE(DB_DO_TIMESTEP);
+) { PROFILE(DB_SIMULATE_TIMESTEP);
 
   bool            retval          = TRUE;
   static sim_time curr_time;
@@ -3564,6 +3887,92 @@ bool db_do_timestep(
 
 }
 
+/*!
+ \return Returns TRUE if simulation should continue to advance; otherwise, returns FALSE
+         to indicate that simulation should stop immediately.
+
+ \throws anonymous db_simulate_timestep
+
+ Simulates the current timestep.  If we are running in the dumpfile decoding thread, the end of the
+ timestep is passed to the main thread which will simulate it.
+*/
+bool db_do_timestep(
+  uint64 time,  /*!< Current time step value being performed */
+  bool   final  /*!< Specifies that this is the final timestep */
+) { PROFILE(DB_DO_TIMESTEP);
+
+  bool retval;
+
+#ifdef DUMPPIPE_SUPPORTED
+  if( dumppipe_in_decoder ) {
+    retval = dumppipe_add_timestep( time, final );
+  } else {
+    retval = db_simulate_timestep( time, final );
+  }
+#else
+  retval = db_simulate_timestep( time, final );
+#endif
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+#ifndef VPI_ONLY
+/*!
+ \return Returns TRUE if the dumpfile reader should continue to read value changes; otherwise, returns FALSE.
+
+ \throws anonymous db_do_timestep
+
+ Called by the dumpfile readers when they reach the value changes of timestep next_time, ending timestep time.
+ Timesteps that end before the -start-time window are not simulated.  Their value changes are left in the symbol
+ table, where later values replace earlier ones, so that the last timestep before the window assigns the value
+ that every signal has at the start of the window.  That timestep is simulated with coverage recording enabled, so
+ the values held just before the window (and the edges from unknown values that assigning them causes) can add
+ line, combinational logic, event and FSM coverage.  Once next_time is past the -end-time, the reader is told
+ to stop.  Readers pass a next_time of all ones at the end of the dumpfile.  If a checkpoint is due after a
+ simulated timestep, the simulation state is saved along with the given dumpfile position.
+*/
+bool db_do_dump_timestep(
+  uint64 time,       /*!< Timestep that has ended */
+  uint64 next_time,  /*!< Timestep of the value changes that follow */
+  uint64 offset      /*!< Byte offset of the value changes that follow in a VCD dumpfile (0 for other formats) */
+) { PROFILE(DB_DO_DUMP_TIMESTEP);
+
+  bool retval = TRUE;
+
+  if( time > score_end_time ) {
+    retval = FALSE;
+  } else if( (time >= score_start_time) || (next_time >= score_start_time) ) {
+    retval = db_do_timestep( time, FALSE );
+#ifndef RUNLIB
+    /* Save the simulation state if a checkpoint is due (in the main thread if we are decoding in another thread) */
+    if( retval && (next_time <= score_end_time) && checkpoint_due() ) {
+#ifdef DUMPPIPE_SUPPORTED
+      if( dumppipe_in_decoder ) {
+        dumppipe_add_checkpoint( time, next_time, offset );
+      } else {
+        checkpoint_write( time, next_time, offset );
+      }
+#else
+      checkpoint_write( time, next_time, offset );
+#endif
+    }
+#endif
+  }
+
+  if( next_time > score_end_time ) {
+    retval = FALSE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+#endif
+
 /*!
  Checks to make sure that if the current design has any signals that need to be assigned
  from the dumpfile that at least one of these signals was satisfied for this need.
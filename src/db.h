@@ -49,6 +49,9 @@ bool db_read(
   int         read_mode
 );
 
+/*! \brief Marks the vectors of the 2-state signals parsed in this run after the CDD file has been read back in. */
+void db_mark_2state_signals();
+
 /*! \brief Assigns instance/functional unit IDs to all non-generated instances. */
 void db_assign_ids();
 
@@ -177,6 +180,7 @@ void db_add_signal(
   sig_range* prange,
   sig_range* urange,
   bool       is_signed,
+  bool       is_2state,
   bool       mba,
   int        line,
   int        col,
@@ -373,7 +377,7 @@ void db_set_vcd_scope(
 void db_vcd_upscope();
 
 /*! \brief Adds symbol to signal specified by name. */
-void db_assign_symbol(
+bool db_assign_symbol(
   char*       name,
   const char* symbol,
   int         msb,
@@ -392,12 +396,27 @@ void db_set_symbol_string(
   const char* value
 );
 
+/*! \brief Sets the found symbol value to specified real value. */
+void db_set_symbol_real(
+  const char* sym,
+  double      value
+);
+
 /*! \brief Performs a timestep for all signal changes during this timestep. */
 bool db_do_timestep(
   uint64 time,
   bool   final
 ); 
 
+#ifndef VPI_ONLY
+/*! \brief Ends a timestep read from the dumpfile, only simulating the timesteps in the scored time window. */
+bool db_do_dump_timestep(
+  uint64 time,
+  uint64 next_time,
+  uint64 offset
+);
+#endif
+
 /*! \brief Called after all signals are parsed from dumpfile.  Checks to see if dumpfile results were
            correct for the covered design. */
 void db_check_dumpfile_scopes();
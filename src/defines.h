@@ -1692,6 +1692,8 @@ union ssuppl_u {
     uint32 mba            :1;  /*!< Specifies that this signal MUST be assigned from simulated results because this information
                                      is NOT provided in the dumpfile */
     uint32 implicit_size  :1;  /*!< Specifies that this signal has not been given a specified size by the user at the current time */
+    uint32 vcd_changed    :1;  /*!< Specifies that this signal was changed by the dumpfile in the current timestep but has not been
+                                     propagated yet (only used while assigning dumpfile values) */
   } part;
 };
 
@@ -1853,6 +1855,7 @@ union usuppl_u {
 union  expr_stmt_u;
 struct exp_info_s;
 struct str_link_s;
+struct vfile_index_s;
 struct rv64_s;
 struct rv32_s;
 struct vector_s;
@@ -1874,6 +1877,7 @@ struct inst_parm_s;
 struct fsm_arc_s;
 struct race_blk_s;
 struct func_unit_s;
+struct funit_index_s;
 struct funit_link_s;
 struct inst_link_s;
 struct sym_sig_s;
@@ -1914,6 +1918,8 @@ struct struct_union_s;
 struct su_member_s;
 struct profiler_s;
 struct db_s;
+struct excl_id_s;
+struct excl_index_s;
 struct sim_time_s;
 struct comp_cdd_cov_s;
 struct exclude_reason_s;
@@ -1922,6 +1928,9 @@ struct gitem_pair_s;
 struct dim_and_nba_s;
 struct nonblock_assign_s;
 struct str_cov_s;
+struct ckpt_ptr_s;
+struct exp_path_s;
+struct exp_fanout_s;
 
 /*------------------------------------------------------------------------------*/
 /*  STRUCTURE/UNION TYPEDEFS  */
@@ -1936,6 +1945,11 @@ typedef struct exp_info_s exp_info;
 */
 typedef struct str_link_s str_link;
 
+/*!
+ Renaming Verilog file index structure for convenience.
+*/
+typedef struct vfile_index_s vfile_index;
+
 /*!
  Renaming rv64 structure for convenience.
 */
@@ -2046,6 +2060,11 @@ typedef struct race_blk_s race_blk;
 */
 typedef struct func_unit_s func_unit;
 
+/*!
+ Renaming functional unit lookup index structure for convenience.
+*/
+typedef struct funit_index_s funit_index;
+
 /*!
  Renaming functional unit link structure for convenience.
 */
@@ -2228,6 +2247,16 @@ typedef struct profiler_s profiler;
 */
 typedef struct db_s db;
 
+/*!
+ Renaming excl_id_s structure for convenience.
+*/
+typedef struct excl_id_s excl_id;
+
+/*!
+ Renaming excl_index_s structure for convenience.
+*/
+typedef struct excl_index_s excl_index;
+
 /*!
  Renaming sim_time_s structure for convenience.
 */
@@ -2268,6 +2297,21 @@ typedef struct nonblock_assign_s nonblock_assign;
 */
 typedef struct str_cov_s str_cov;
 
+/*!
+ Renaming ckpt_ptr_s structure for convenience.
+*/
+typedef struct ckpt_ptr_s ckpt_ptr;
+
+/*!
+ Renaming exp_path_s structure for convenience.
+*/
+typedef struct exp_path_s exp_path;
+
+/*!
+ Renaming exp_fanout_s structure for convenience.
+*/
+typedef struct exp_fanout_s exp_fanout;
+
 /*------------------------------------------------------------------------------*/
 /*  STRUCTURE/UNION DEFINITIONS  */
 
@@ -2316,6 +2360,21 @@ struct str_link_s {
   str_link*     next;                /*!< Pointer to next str_link element */
 };
 
+/*!
+ Index of a list of Verilog files (see get_next_vfile) that allows the next file to parse for a given module
+ to be found without scanning the list.  Positions refer to the order of the files in the indexed list.
+*/
+struct vfile_index_s {
+  str_link**    files;               /*!< Array of the indexed files in list order */
+  unsigned int  num;                 /*!< Number of elements in the files array */
+  unsigned int* next_src;            /*!< For each position, position of the first non-library file at or after it (num if none) */
+  char**        mods;                /*!< For each position, module name derived from the library file name (NULL for other files) */
+  unsigned int* next_mod;            /*!< For each position, position plus one of the next library file with the same module name */
+  unsigned int* mod_hash;            /*!< Hash table of the position plus one of the first library file for each module name */
+  unsigned int* pos_hash;            /*!< Hash table of the position plus one of each file keyed on its list element address */
+  unsigned int  hash_size;           /*!< Number of buckets in mod_hash and pos_hash (always a power of two) */
+};
+
 /*!
  This structure contains the contents needed to store and display the floating point value used
  within the design.
@@ -2342,6 +2401,8 @@ struct rv32_s {
 struct vector_s {
   unsigned int width;                /*!< Bit width of this vector */
   vsuppl       suppl;                /*!< Supplemental field */
+  uint8        two_state;            /*!< Set to 1 if this signal vector is declared 2-state (bit, byte, int, etc.).
+                                          This is not stored in the CDD file (see db_mark_2state_signals) */
   union {
     ulong** ul;                      /*!< Machine sized unsigned integer array for value, signal, expression and memory types */
     rv64*   r64;                     /*!< 64-bit floating point value */
@@ -2442,6 +2503,12 @@ struct vsignal_s {
   dim_range*   dim;                  /*!< Unpacked/packed dimension array */
   expression** exps;                 /*!< Expression array */
   unsigned int exp_size;             /*!< Number of elements in the expression array */
+  exp_fanout*  fanouts;              /*!< Fan-out of a value change to each expression of the expression array */
+  unsigned int fanout_size;          /*!< Number of elements in the fanouts array */
+  exp_path*    paths;                /*!< Path steps of all elements of the fanouts array */
+  unsigned int path_size;            /*!< Number of elements in the paths array */
+  unsigned int changed_lsb;          /*!< Lowest bit changed by the dumpfile in the current timestep (valid if vcd_changed is set) */
+  unsigned int changed_msb;          /*!< Highest bit changed by the dumpfile in the current timestep (valid if vcd_changed is set) */
 };
 
 /*!
@@ -2478,6 +2545,12 @@ struct fsm_table_s {
   unsigned int    num_to_states;     /*!< Contains the number of to states stored in this table */
   fsm_table_arc** arcs;              /*!< List of FSM state transitions */
   unsigned int    num_arcs;          /*!< Contains the number of arcs stored in this table */
+  unsigned int*   fr_hash;           /*!< Open-addressed hash table of fr_states indices (plus one) keyed on state value */
+  unsigned int    fr_hash_size;      /*!< Number of buckets in the fr_hash table (always a power of two) */
+  unsigned int*   to_hash;           /*!< Open-addressed hash table of to_states indices (plus one) keyed on state value */
+  unsigned int    to_hash_size;      /*!< Number of buckets in the to_hash table (always a power of two) */
+  unsigned int*   arc_hash;          /*!< Open-addressed hash table of arcs indices (plus one) keyed on the from/to state index pair */
+  unsigned int    arc_hash_size;     /*!< Number of buckets in the arc_hash table (always a power of two) */
 };
 
 /*!
@@ -2691,12 +2764,35 @@ struct func_unit_s {
   struct_union*   su_tail;           /*!< Tail pointer to list of struct/unions for this functional unit */
   exclude_reason* er_head;           /*!< Head pointer to list of exclusion reason structures for this functional unit */
   exclude_reason* er_tail;           /*!< Tail pointer to list of exclusion reason structures for this functional unit */
+  funit_index*    index;             /*!< Pointer to lazily built lookup indexes for this functional unit (NULL if not built) */
   union {
     thread*   thr;                   /*!< Pointer to a single thread that this statement is associated with */
     thr_list* tlist;                 /*!< Pointer to a list of threads that this statement is currently associated with */
   } elem;                            /*!< Pointer element */
 };
 
+/*!
+ Hash indexes used to look up the signals, expressions, FSMs and parameters of a functional unit.  The
+ signal, expression and FSM tables are open-addressed and store the index (plus one) of the element in the
+ functional unit array.  Each table is built the first time it is searched and is brought up-to-date
+ with any elements appended to the functional unit since the last search.
+*/
+struct funit_index_s {
+  unsigned int*   sig_hash;          /*!< Hash table of signal indices keyed on signal name */
+  unsigned int    sig_hash_size;     /*!< Number of buckets in sig_hash (always a power of two) */
+  unsigned int    sig_num;           /*!< Number of signals in the functional unit sigs array that are in sig_hash */
+  unsigned int*   exp_hash;          /*!< Hash table of expression indices keyed on expression ID */
+  unsigned int    exp_hash_size;     /*!< Number of buckets in exp_hash (always a power of two) */
+  unsigned int    exp_num;           /*!< Number of expressions in the functional unit exps array that are in exp_hash */
+  unsigned int*   fsm_hash;          /*!< Hash table of FSM indices keyed on FSM name */
+  unsigned int    fsm_hash_size;     /*!< Number of buckets in fsm_hash (always a power of two) */
+  unsigned int    fsm_num;           /*!< Number of FSMs in the functional unit fsms array that are in fsm_hash */
+  mod_parm**      parm_hash;         /*!< Hash table of declared module parameters keyed on parameter name */
+  unsigned int    parm_hash_size;    /*!< Number of buckets in parm_hash (always a power of two) */
+  unsigned int    parm_num;          /*!< Number of module parameters stored in parm_hash */
+  mod_parm*       parm_last;         /*!< Pointer to the last module parameter in the functional unit list that was indexed */
+};
+
 /*!
  Linked list element that stores a functional unit (no scope).
 */
@@ -2749,6 +2845,8 @@ struct symtable_s {
   char         entry_type;           /*!< Specifies if this entry represents a signal (1), expression (2) or fsm (3) */
   char*        value;                /*!< String representation of last current value */
   unsigned int size;                 /*!< Number of bytes allowed storage for value */
+  double       real;                 /*!< Last current value of a real signal that was delivered in binary form */
+  bool         real_set;             /*!< Set to TRUE if the last current value is stored in real instead of value */
   symtable*    table[94];            /*!< Array of symbol tables for next level (only enough for printable characters) */
 };
 
@@ -2851,6 +2949,7 @@ struct tnode_s {
   tnode* left;                       /*!< Pointer to left child node */
   tnode* right;                      /*!< Pointer to right child node */
   tnode* up;                         /*!< Pointer to parent node */
+  int    height;                     /*!< Height of the subtree rooted at this node (used to keep the tree balanced) */
 };
 
 #ifdef HAVE_SYS_TIME_H
@@ -3066,11 +3165,13 @@ struct dim_range_s {
 };
 
 /*!
- Represents a reentrant stack and control information.
+ Represents a single frame of saved signal/expression values within the reentrant frame stack.
 */
 struct reentrant_s {
-  uint8*        data;                /*!< Packed bit data stored from signals */
-  int           data_size;           /*!< Number of data elements stored in a single rstack_entry data */
+  unsigned int  base;                /*!< Index of the first word of this frame in the reentrant frame stack */
+  unsigned int  size;                /*!< Number of words stored in this frame */
+  bool          released;            /*!< Set to TRUE when this frame has been restored but is not yet at the top of the stack */
+  reentrant*    prev;                /*!< Pointer to frame below this one in the stack (or next frame in the free list) */
 };
 
 /*!
@@ -3135,6 +3236,31 @@ struct db_s {
   funit_link*  funit_tail;            /*!< Pointer to tail of functional unit list */
   str_link*    fver_head;             /*!< Pointer to head of file version list */
   str_link*    fver_tail;             /*!< Pointer to head of file version list */
+  excl_index*  excl_index;            /*!< Pointer to exclusion ID lookup index (built on demand, NULL if not built) */
+};
+
+/*!
+ Associates an exclusion ID (or a range of consecutive exclusion IDs) with the object that owns it.
+*/
+struct excl_id_s {
+  int          id;                    /*!< Exclusion ID (first exclusion ID of the range for FSM tables) */
+  int          num;                   /*!< Number of consecutive exclusion IDs owned by the object */
+  unsigned int order;                 /*!< Order in which this entry was found in the instance tree */
+  void*        obj;                   /*!< Pointer to signal, expression or FSM table that owns the ID(s) */
+  func_unit*   funit;                 /*!< Pointer to functional unit containing the object */
+};
+
+/*!
+ Sorted tables of the exclusion IDs of all signals, expressions and FSM state transitions found in the
+ instance trees of a database, allowing an exclusion ID to be resolved with a binary search.
+*/
+struct excl_index_s {
+  excl_id*     sigs;                  /*!< Signal exclusion IDs sorted by ID */
+  unsigned int sig_num;               /*!< Number of elements in the sigs array */
+  excl_id*     exps;                  /*!< Expression exclusion IDs sorted by ID */
+  unsigned int exp_num;               /*!< Number of elements in the exps array */
+  excl_id*     arcs;                  /*!< FSM table exclusion ID ranges sorted by first ID */
+  unsigned int arc_num;               /*!< Number of elements in the arcs array */
 };
 
 /*!
@@ -3213,12 +3339,52 @@ struct str_cov_s {
   char*           str;                  /*!< Code string */
 };
 
+/*!
+ Entry of a sorted table used to find the index of a pointer when writing a simulation checkpoint.
+*/
+struct ckpt_ptr_s {
+  const void*     ptr;                  /*!< Pointer being looked up */
+  unsigned int    index;                /*!< Index of the pointer in the checkpoint */
+};
+
+/*!
+ One step of the path from an expression that uses a signal up to its root expression.  Holds the
+ changed bits to set in a parent expression when the child expression below it has changed.
+*/
+struct exp_path_s {
+  expression*     expr;                 /*!< Parent expression to set the changed bits of */
+  uint32          test;                 /*!< Changed bit that, when already set, shows that the rest of the path is set */
+  uint32          set;                  /*!< Changed bits to set (the left or right changed bit of the child's side) */
+};
+
+/*!
+ Precomputed fan-out of a signal change to one of the expressions that use the signal.
+*/
+struct exp_fanout_s {
+  expression*     expr;                 /*!< Expression that uses the signal (NULL if changes are not propagated to it) */
+  exp_path*       path;                 /*!< Steps from the parent of the expression up to the root expression */
+  unsigned int    depth;                /*!< Number of steps in the path */
+  statement*      stmt;                 /*!< Statement of the root expression (NULL if it has none) */
+  unsigned int    lsb;                  /*!< Lowest bit of the signal that the expression reads */
+  unsigned int    msb;                  /*!< Highest bit of the signal that the expression reads */
+};
+
 /*!
  This will define the exception type that gets thrown (Covered does not care about this value)
 */
 define_exception_type(int);
 
-extern struct exception_context the_exception_context[1];
+/*!
+ Storage class for variables that need a separate copy in each thread.  Only the dumpfile decoding thread
+ (see dumppipe.c) runs alongside the main thread, so this is only needed when threads are available.
+*/
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_THREAD_BUILTINS)
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+
+extern THREAD_LOCAL struct exception_context the_exception_context[1];
 
 #endif
 
@@ -846,9 +846,11 @@
  transfer and is performed by the function symtable_assign located in the symtable.c source
  file.  In this operation, the tree that contains the current timestep symbols/values (timestep_tab)
  is traversed, assigning the stored value to the signal structure that is associated with
- the stored symbol.  When this operation occurs, toggle coverage information is obtained glitch-free
- and all statements containing those signals are flagged as being modified and placed in a special
- queue known as the pre-simulation queue (please see sim.c for more details).  After all entries
+ the stored symbol.  When this operation occurs, toggle coverage information is obtained glitch-free.
+ Once all values have been assigned, each changed signal is propagated once (even if it received
+ values from several symbols) and all statements containing those signals are flagged as being
+ modified and placed in a special queue known as the pre-simulation queue (please see sim.c for
+ more details).  After all entries
  in the timestep_tab symbol tree have been traversed, the entire tree is deallocated from memory,
  ready for the next timestep information.
  
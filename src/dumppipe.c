@@ -0,0 +1,479 @@
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     dumppipe.c
+ \date     10/18/2026
+
+ \par
+ The dumpfile pipeline splits the simulation phase of the score command into two threads.  A decoding thread runs
+ the VCD, LXT or FST reader which, instead of setting symbol values and simulating timesteps directly, records each
+ value change and the end of each timestep in a batch.  The main thread takes the batches in order and replays the
+ recorded calls to db_set_symbol_string, db_set_symbol_real and db_do_timestep, so that parsing and decompressing
+ the dumpfile overlaps with simulation without changing the order in which the database sees the changes.
+ Checkpoints that become due are recorded in the same way so that the main thread saves the simulation state at
+ the matching timestep.
+
+ \par
+ Batches are stored in a fixed ring with a single producer and a single consumer.  Each side only ever writes its own
+ ring index so no lock is needed to pass a batch; the mutex and condition variable are only used to sleep when the
+ ring is full or empty.  If the main thread stops simulating (a $finish was reached or an exception was thrown) it
+ tells the decoding thread to discard everything else it reads.
+
+ \par
+ The pipeline is not used when Covered was built without pthreads, when debug output is enabled (the debug output
+ of the two threads would be interleaved) or when the thread cannot be created.  In these cases the reader is simply
+ called from the main thread.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "checkpoint.h"
+#include "defines.h"
+#include "dumppipe.h"
+#include "db.h"
+#include "util.h"
+
+#ifdef DUMPPIPE_SUPPORTED
+#include <pthread.h>
+
+
+/*!
+ Number of batches in the ring between the decoding thread and the main thread.
+*/
+#define DUMPPIPE_RING_SIZE   8
+
+/*!
+ Number of bytes in each batch.  This must be large enough to hold a value change record for the widest
+ supported vector.
+*/
+#define DUMPPIPE_BATCH_SIZE  (MAX_BIT_WIDTH * 4)
+
+
+extern bool debug_mode;
+
+
+/*!
+ Set to TRUE in the decoding thread so that the db_set_symbol and db_do_timestep functions record their calls
+ in the current batch instead of performing them.
+*/
+THREAD_LOCAL bool dumppipe_in_decoder = FALSE;
+
+/*!
+ Batch buffers of the ring.
+*/
+static char* dp_buf[DUMPPIPE_RING_SIZE];
+
+/*!
+ Number of bytes stored in each batch of the ring.
+*/
+static unsigned int dp_size[DUMPPIPE_RING_SIZE];
+
+/*!
+ Number of batches that have been taken by the main thread.  Only written by the main thread.
+*/
+static volatile unsigned int dp_head = 0;
+
+/*!
+ Number of batches that have been published by the decoding thread.  Only written by the decoding thread.
+*/
+static volatile unsigned int dp_tail = 0;
+
+/*!
+ Set by the decoding thread once it has published its last batch.
+*/
+static volatile bool dp_done = FALSE;
+
+/*!
+ Set by the main thread when it no longer needs any batches.
+*/
+static volatile bool dp_stop = FALSE;
+
+/*!
+ Set by the decoding thread if the reader threw an exception.
+*/
+static volatile bool dp_error = FALSE;
+
+/*!
+ Number of bytes stored in the batch currently being filled by the decoding thread.
+*/
+static unsigned int dp_fill = 0;
+
+/*!
+ Protects the sleeps of both threads on dp_cond.
+*/
+static pthread_mutex_t dp_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*!
+ Signalled whenever dp_head, dp_tail, dp_done or dp_stop changes.
+*/
+static pthread_cond_t dp_cond = PTHREAD_COND_INITIALIZER;
+
+/*!
+ Reader function to run in the decoding thread.
+*/
+static void (*dp_decode)( void* ) = NULL;
+
+/*!
+ Argument to pass to the reader function.
+*/
+static void* dp_arg = NULL;
+
+
+/*!
+ Wakes up the other thread if it is sleeping on the ring.
+*/
+static void dumppipe_wake() {
+
+  (void)pthread_mutex_lock( &dp_lock );
+  (void)pthread_cond_broadcast( &dp_cond );
+  (void)pthread_mutex_unlock( &dp_lock );
+
+}
+
+/*!
+ Hands the batch currently being filled to the main thread.
+*/
+static void dumppipe_publish() {
+
+  dp_size[dp_tail % DUMPPIPE_RING_SIZE] = dp_fill;
+  __sync_synchronize();
+  dp_tail++;
+  dumppipe_wake();
+
+  dp_fill = 0;
+
+}
+
+/*!
+ \return Returns a pointer to the next size bytes of the current batch if the main thread still needs the
+         record; otherwise, returns NULL.
+
+ Makes room for a record of the given size in the current batch, publishing the batch and waiting for a free
+ batch in the ring if the record does not fit.
+*/
+static char* dumppipe_reserve(
+  unsigned int size  /*!< Number of bytes needed for the record */
+) {
+
+  char* ptr = NULL;
+
+  assert( size <= DUMPPIPE_BATCH_SIZE );
+
+  if( !dp_stop ) {
+
+    if( (dp_fill + size) > DUMPPIPE_BATCH_SIZE ) {
+      dumppipe_publish();
+    }
+
+    /* Wait for the main thread to free a batch if the ring is full */
+    if( (dp_tail - dp_head) == DUMPPIPE_RING_SIZE ) {
+      (void)pthread_mutex_lock( &dp_lock );
+      while( ((dp_tail - dp_head) == DUMPPIPE_RING_SIZE) && !dp_stop ) {
+        (void)pthread_cond_wait( &dp_cond, &dp_lock );
+      }
+      (void)pthread_mutex_unlock( &dp_lock );
+    }
+
+    if( !dp_stop ) {
+      ptr      = dp_buf[dp_tail % DUMPPIPE_RING_SIZE] + dp_fill;
+      dp_fill += size;
+    }
+
+  }
+
+  return( ptr );
+
+}
+
+/*!
+ Records a value change in the current batch.  Called in place of db_set_symbol_string by the decoding thread.
+*/
+void dumppipe_add_value(
+  const char* sym,   /*!< Name of symbol to set */
+  const char* value  /*!< String version of value to set symbol to */
+) {
+
+  unsigned int sym_len = strlen( sym ) + 1;
+  unsigned int val_len = strlen( value ) + 1;
+  char*        ptr;
+
+  if( (ptr = dumppipe_reserve( 1 + sym_len + val_len )) != NULL ) {
+    ptr[0] = 'V';
+    memcpy( (ptr + 1), sym, sym_len );
+    memcpy( (ptr + 1 + sym_len), value, val_len );
+  }
+
+}
+
+/*!
+ Records a real value change in the current batch.  Called in place of db_set_symbol_real by the decoding thread.
+*/
+void dumppipe_add_real(
+  const char* sym,   /*!< Name of symbol to set */
+  double      value  /*!< Real value to set symbol to */
+) {
+
+  unsigned int sym_len = strlen( sym ) + 1;
+  char*        ptr;
+
+  if( (ptr = dumppipe_reserve( 1 + sym_len + sizeof( double ) )) != NULL ) {
+    ptr[0] = 'R';
+    memcpy( (ptr + 1), sym, sym_len );
+    memcpy( (ptr + 1 + sym_len), &value, sizeof( double ) );
+  }
+
+}
+
+/*!
+ \return Returns TRUE if simulation should continue to advance; otherwise, returns FALSE.
+
+ Records the end of a timestep in the current batch.  Called in place of db_do_timestep by the decoding thread.
+*/
+bool dumppipe_add_timestep(
+  uint64 time,  /*!< Timestep that has ended */
+  bool   final  /*!< Specifies that this is the final timestep */
+) {
+
+  char* ptr;
+
+  if( (ptr = dumppipe_reserve( 2 + sizeof( uint64 ) )) != NULL ) {
+    ptr[0] = 'T';
+    ptr[1] = final ? 1 : 0;
+    memcpy( (ptr + 2), &time, sizeof( uint64 ) );
+  }
+
+  return( !dp_stop );
+
+}
+
+/*!
+ Records a checkpoint in the current batch.  Called in place of checkpoint_write by the decoding thread.
+*/
+void dumppipe_add_checkpoint(
+  uint64 time,       /*!< Timestep that has ended */
+  uint64 next_time,  /*!< Timestep of the value changes that follow */
+  uint64 offset      /*!< Byte offset of the value changes that follow in a VCD dumpfile */
+) {
+
+  char* ptr;
+
+  if( (ptr = dumppipe_reserve( 1 + (3 * sizeof( uint64 )) )) != NULL ) {
+    ptr[0] = 'C';
+    memcpy( (ptr + 1), &time, sizeof( uint64 ) );
+    memcpy( (ptr + 1 + sizeof( uint64 )), &next_time, sizeof( uint64 ) );
+    memcpy( (ptr + 1 + (2 * sizeof( uint64 ))), &offset, sizeof( uint64 ) );
+  }
+
+}
+
+/*!
+ Body of the decoding thread.  Runs the reader and publishes the last batch.
+*/
+static void* dumppipe_decoder(
+  void* unused  /*!< Not used */
+) {
+
+  dumppipe_in_decoder = TRUE;
+  init_exception_context( the_exception_context );
+
+  Try {
+    dp_decode( dp_arg );
+  } Catch_anonymous {
+    dp_error = TRUE;
+  }
+
+  if( !dp_stop && (dp_fill > 0) ) {
+    dumppipe_publish();
+  }
+
+  __sync_synchronize();
+  dp_done = TRUE;
+  dumppipe_wake();
+
+  return( NULL );
+
+}
+
+/*!
+ \return Returns TRUE if the main thread should continue taking batches; otherwise, returns FALSE.
+
+ \throws anonymous db_do_timestep
+
+ Replays the records of the given batch.
+*/
+static bool dumppipe_consume(
+  const char*  ptr,  /*!< Pointer to the start of the batch */
+  unsigned int size  /*!< Number of bytes in the batch */
+) { PROFILE(DUMPPIPE_CONSUME);
+
+  const char* end      = ptr + size;
+  bool        simulate = TRUE;
+
+  while( (ptr < end) && simulate ) {
+
+    if( ptr[0] == 'V' ) {
+
+      const char* sym   = ptr + 1;
+      const char* value = sym + strlen( sym ) + 1;
+      db_set_symbol_string( sym, value );
+      ptr = value + strlen( value ) + 1;
+
+    } else if( ptr[0] == 'R' ) {
+
+      const char* sym = ptr + 1;
+      double      value;
+      ptr = sym + strlen( sym ) + 1;
+      memcpy( &value, ptr, sizeof( double ) );
+      db_set_symbol_real( sym, value );
+      ptr += sizeof( double );
+
+    } else if( ptr[0] == 'C' ) {
+
+      uint64 time, next_time, offset;
+      memcpy( &time, (ptr + 1), sizeof( uint64 ) );
+      memcpy( &next_time, (ptr + 1 + sizeof( uint64 )), sizeof( uint64 ) );
+      memcpy( &offset, (ptr + 1 + (2 * sizeof( uint64 ))), sizeof( uint64 ) );
+      checkpoint_write( time, next_time, offset );
+      ptr += 1 + (3 * sizeof( uint64 ));
+
+    } else {
+
+      uint64 time;
+      assert( ptr[0] == 'T' );
+      memcpy( &time, (ptr + 2), sizeof( uint64 ) );
+      simulate = db_do_timestep( time, (ptr[1] != 0) );
+      ptr += 2 + sizeof( uint64 );
+
+    }
+
+  }
+
+  PROFILE_END;
+
+  return( simulate );
+
+}
+#endif
+
+/*!
+ \throws anonymous Throw Throw decode db_do_timestep
+
+ Runs the given dumpfile reader.  If possible, the reader is run in a separate decoding thread while the main
+ thread simulates the timesteps that it produces; otherwise, the reader is simply called.  Returns once the
+ whole dumpfile has been read and simulated.
+*/
+void dumppipe_run(
+  void  (*decode)( void* ),  /*!< Reader function to call */
+  void* arg                  /*!< Argument to pass to the reader function */
+) { PROFILE(DUMPPIPE_RUN);
+
+#ifdef DUMPPIPE_SUPPORTED
+  pthread_t    thread;
+  bool         threaded = FALSE;
+  unsigned int i;
+
+  if( !debug_mode ) {
+
+    for( i=0; i<DUMPPIPE_RING_SIZE; i++ ) {
+      dp_buf[i] = (char*)malloc_safe_nolimit( DUMPPIPE_BATCH_SIZE );
+    }
+
+    dp_head   = 0;
+    dp_tail   = 0;
+    dp_fill   = 0;
+    dp_done   = FALSE;
+    dp_stop   = FALSE;
+    dp_error  = FALSE;
+    dp_decode = decode;
+    dp_arg    = arg;
+
+    if( pthread_create( &thread, NULL, dumppipe_decoder, NULL ) == 0 ) {
+      threaded = TRUE;
+    } else {
+      for( i=0; i<DUMPPIPE_RING_SIZE; i++ ) {
+        free_safe( dp_buf[i], DUMPPIPE_BATCH_SIZE );
+      }
+    }
+
+  }
+
+  if( threaded ) {
+
+    Try {
+
+      for( ;; ) {
+
+        /* Wait for the decoding thread to publish a batch */
+        if( dp_head == dp_tail ) {
+          (void)pthread_mutex_lock( &dp_lock );
+          while( (dp_head == dp_tail) && !dp_done ) {
+            (void)pthread_cond_wait( &dp_cond, &dp_lock );
+          }
+          (void)pthread_mutex_unlock( &dp_lock );
+        }
+
+        if( dp_head == dp_tail ) {
+          break;
+        }
+
+        __sync_synchronize();
+
+        /* Once simulation has stopped, the remaining batches are discarded */
+        if( !dp_stop && !dumppipe_consume( dp_buf[dp_head % DUMPPIPE_RING_SIZE], dp_size[dp_head % DUMPPIPE_RING_SIZE] ) ) {
+          dp_stop = TRUE;
+        }
+
+        __sync_synchronize();
+        dp_head++;
+        dumppipe_wake();
+
+      }
+
+    } Catch_anonymous {
+      dp_stop = TRUE;
+      dumppipe_wake();
+      (void)pthread_join( thread, NULL );
+      for( i=0; i<DUMPPIPE_RING_SIZE; i++ ) {
+        free_safe( dp_buf[i], DUMPPIPE_BATCH_SIZE );
+      }
+      Throw 0;
+    }
+
+    (void)pthread_join( thread, NULL );
+    for( i=0; i<DUMPPIPE_RING_SIZE; i++ ) {
+      free_safe( dp_buf[i], DUMPPIPE_BATCH_SIZE );
+    }
+
+    /* Report an error from the reader now that everything before it has been simulated */
+    if( dp_error ) {
+      Throw 0;
+    }
+
+  } else {
+
+    decode( arg );
+
+  }
+#else
+  decode( arg );
+#endif
+
+  PROFILE_END;
+
+}
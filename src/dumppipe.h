@@ -0,0 +1,72 @@
+#ifndef __DUMPPIPE_H__
+#define __DUMPPIPE_H__
+
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     dumppipe.h
+ \date     10/18/2026
+ \brief    Contains functions for decoding a dumpfile in a separate thread from simulation.
+*/
+
+#include "defines.h"
+
+
+/*!
+ Specifies that the dumpfile readers can be run in a decoding thread.  The profiler and the debug output are
+ not thread-safe so the pipeline is not available in profiling builds.  The pipeline also needs a compiler
+ that supports the __thread storage class and the __sync builtins.
+*/
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_THREAD_BUILTINS) && !defined(PROFILER) && !defined(VPI_ONLY) && !defined(RUNLIB)
+#define DUMPPIPE_SUPPORTED 1
+#endif
+
+
+/*! \brief Runs the given dumpfile reading function, simulating the timesteps that it produces. */
+void dumppipe_run(
+  void (*decode)( void* ),
+  void* arg
+);
+
+#ifdef DUMPPIPE_SUPPORTED
+/*! \brief Adds a value change to the current timestep batch. */
+void dumppipe_add_value(
+  const char* sym,
+  const char* value
+);
+
+/*! \brief Adds a real value change to the current timestep batch. */
+void dumppipe_add_real(
+  const char* sym,
+  double      value
+);
+
+/*! \brief Ends the current timestep. */
+bool dumppipe_add_timestep(
+  uint64 time,
+  bool   final
+);
+
+/*! \brief Saves the simulation state once the current timestep has been simulated. */
+void dumppipe_add_checkpoint(
+  uint64 time,
+  uint64 next_time,
+  uint64 offset
+);
+#endif
+
+#endif
+
@@ -1191,6 +1191,22 @@ void exclude_merge(
 
 }
 
+/*!
+ \return Returns a pointer to the exclusion ID index of the current database, creating it if it has not been
+         created yet.
+*/
+static excl_index* exclude_get_index() { PROFILE(EXCLUDE_GET_INDEX);
+
+  if( db_list[curr_db]->excl_index == NULL ) {
+    db_list[curr_db]->excl_index = instance_exclusion_index_create( db_list[curr_db]->inst_head );
+  }
+
+  PROFILE_END;
+
+  return( db_list[curr_db]->excl_index );
+
+}
+
 /*!
  \return Returns pointer to found signal if it was found; otherwise, returns NULL.
 */
@@ -1199,15 +1215,9 @@ vsignal* exclude_find_signal(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing found signal */
 ) { PROFILE(EXCLUDE_FIND_SIGNAL);
 
-  inst_link* instl;       /* Pointer to current instance link */
-  vsignal*   sig = NULL;  /* Pointer to found signal */
-
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((sig = instance_find_signal_by_exclusion_id( instl->inst, id, found_funit )) == NULL) ) {
-    instl = instl->next;
-  }
+  vsignal* sig;  /* Pointer to found signal */
 
-  if( sig != NULL ) {
+  if( (sig = instance_find_signal_by_exclusion_id( exclude_get_index(), id, found_funit )) != NULL ) {
     *found_funit = funit_get_curr_module( *found_funit );
   }
 
@@ -1225,15 +1235,9 @@ expression* exclude_find_expression(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing found expression */
 ) { PROFILE(EXCLUDE_FIND_EXPRESSION);
 
-  inst_link*  instl;       /* Pointer to current instance link */
-  expression* exp = NULL;  /* Pointer to found expression */
+  expression* exp;  /* Pointer to found expression */
 
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((exp = instance_find_expression_by_exclusion_id( instl->inst, id, found_funit )) == NULL) ) {
-    instl = instl->next;
-  }
-
-  if( exp != NULL ) {
+  if( (exp = instance_find_expression_by_exclusion_id( exclude_get_index(), id, found_funit )) != NULL ) {
     *found_funit = funit_get_curr_module( *found_funit );
   }
 
@@ -1252,15 +1256,9 @@ int exclude_find_fsm_arc(
   /*@out@*/ func_unit** found_funit  /*!< Pointer to found functional unit */
 ) { PROFILE(EXCLUDE_FIND_FSM_ARC);
 
-  inst_link* instl;  /* Pointer to current instance link */
-  int        arc_index = -1;
-
-  instl = db_list[curr_db]->inst_head;
-  while( (instl != NULL) && ((arc_index = instance_find_fsm_arc_index_by_exclusion_id( instl->inst, id, found_fsm, found_funit )) == -1) ) {
-    instl = instl->next;
-  }
+  int arc_index;
 
-  if( arc_index != -1 ) {
+  if( (arc_index = instance_find_fsm_arc_index_by_exclusion_id( exclude_get_index(), id, found_fsm, found_funit )) != -1 ) {
     *found_funit = funit_get_curr_module( *found_funit );
   }
 
@@ -668,6 +668,7 @@ expression* expression_create(
   new_expr->suppl.part.owns_vec = 1;
   new_expr->value->value.ul     = NULL;
   new_expr->value->suppl.all    = 0;
+  new_expr->value->two_state    = 0;
   new_expr->table               = NULL;
   new_expr->elem.funit          = NULL;
   new_expr->name                = NULL;
@@ -846,6 +847,7 @@ void expression_set_value(
   if( (exp->op == EXP_OP_SIG) || (exp->op == EXP_OP_PARAM) || (exp->op == EXP_OP_TRIGGER) ) {
 
     exp->value->suppl                = sig->value->suppl;
+    exp->value->two_state            = sig->value->two_state;
     exp->value->width                = sig->value->width;
     exp->value->value.ul             = sig->value->value.ul;
     exp->value->suppl.part.owns_data = 0;
@@ -1640,7 +1642,7 @@ void expression_db_read(
       /* Find right expression */
       if( right_id == 0 ) {
         right = NULL;
-      } else if( (right = exp_link_find( right_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
+      } else if( (right = funit_lookup_expression( right_id, curr_funit )) == NULL ) {
         unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, right_id );
         assert( rv < USER_MSG_LENGTH );
         print_output( user_msg, FATAL, __FILE__, __LINE__ );
@@ -1650,7 +1652,7 @@ void expression_db_read(
       /* Find left expression */
       if( left_id == 0 ) {
         left = NULL;
-      } else if( (left = exp_link_find( left_id, curr_funit->exps, curr_funit->exp_size )) == NULL ) {
+      } else if( (left = funit_lookup_expression( left_id, curr_funit )) == NULL ) {
         unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Internal error:  root expression (%d) found before leaf expression (%d) in database file", curr_expr_id, left_id );
         assert( rv < USER_MSG_LENGTH );
         print_output( user_msg, FATAL, __FILE__, __LINE__ );
@@ -5918,10 +5920,10 @@ void expression_vcd_assign(
       if( strlen( value ) > 32 ) {
         char* tmpval = strdup_safe( value );
         tmpval[strlen( value ) - 32] = '\0';
-        (void)vector_vcd_assign( expr->sig->value, tmpval, ((expr->value->width - 1) + intval), intval );
+        (void)vector_vcd_assign( expr->sig->value, tmpval, ((expr->value->width - 1) + intval), intval, NULL, NULL );
         free_safe( tmpval, (strlen( value ) + 1) );
       } else {
-        (void)vector_vcd_assign( expr->sig->value, "0", ((expr->value->width - 1) + intval), intval );
+        (void)vector_vcd_assign( expr->sig->value, "0", ((expr->value->width - 1) + intval), intval, NULL, NULL );
       }
     }
 
@@ -233,8 +233,8 @@ void fsm_db_read(
     } else {
 
       /* Find specified signal */
-      if( ((iexp = exp_link_find( iexp_id, funit->exps, funit->exp_size )) != NULL) &&
-          ((oexp = exp_link_find( oexp_id, funit->exps, funit->exp_size )) != NULL) ) {
+      if( ((iexp = funit_lookup_expression( iexp_id, funit )) != NULL) &&
+          ((oexp = funit_lookup_expression( oexp_id, funit )) != NULL) ) {
 
         /* Create new FSM */
         table = fsm_create( iexp, oexp, FALSE );
@@ -408,7 +408,7 @@ void fsm_vcd_assign(
 
   /* Assign the string value to the given state vectors */
   if( table->from_state->id == table->to_state->id ) {
-    (void)vector_vcd_assign( table->to_state->value, value, (table->to_state->value->width - 1), 0 );
+    (void)vector_vcd_assign( table->to_state->value, value, (table->to_state->value->width - 1), 0, NULL, NULL );
   } else {
     (void)vector_vcd_assign2( table->to_state->value, table->from_state->value, value, ((table->from_state->value->width + table->to_state->value->width) - 1), 0 );
   }
@@ -28,6 +28,7 @@
 #include "util.h"
 #include "fsm.h"
 #include "fsm_var.h"
+#include "func_unit.h"
 #include "vsignal.h"
 #include "expr.h"
 #include "vector.h"
@@ -359,7 +360,7 @@ static expression* fsm_arg_parse_value(
     /* This value should be a parameter value, parse it */
     if( sscanf( *str, "%[a-zA-Z0-9_]\[%d:%d]%n", str_val, &msb, &lsb, &chars_read ) == 3 ) {
       *str = *str + chars_read;
-      if( (mparm = mod_parm_find( str_val, funit->param_head )) != NULL ) {
+      if( (mparm = funit_lookup_param( str_val, funit )) != NULL ) {
 
         /* Generate left child expression */
         left = expression_create( NULL, NULL, EXP_OP_STATIC, FALSE, curr_expr_id, 0, 0, 0, 0, 0, FALSE );
@@ -394,7 +395,7 @@ static expression* fsm_arg_parse_value(
       }
     } else if( sscanf( *str, "%[a-zA-Z0-9_]\[%d+:%d]%n", str_val, &msb, &lsb, &chars_read ) == 3 ) {
       *str = *str + chars_read;
-      if( (mparm = mod_parm_find( str_val, funit->param_head )) != NULL ) {
+      if( (mparm = funit_lookup_param( str_val, funit )) != NULL ) {
 
         /* Generate left child expression */
         left = expression_create( NULL, NULL, EXP_OP_STATIC, FALSE, curr_expr_id, 0, 0, 0, 0, 0, FALSE );
@@ -429,7 +430,7 @@ static expression* fsm_arg_parse_value(
       }
     } else if( sscanf( *str, "%[a-zA-Z0-9_]\[%d-:%d]%n", str_val, &msb, &lsb, &chars_read ) == 3 ) {
       *str = *str + chars_read;
-      if( (mparm = mod_parm_find( str_val, funit->param_head )) != NULL ) {
+      if( (mparm = funit_lookup_param( str_val, funit )) != NULL ) {
 
         /* Generate left child expression */
         left = expression_create( NULL, NULL, EXP_OP_STATIC, FALSE, curr_expr_id, 0, 0, 0, 0, 0, FALSE );
@@ -464,7 +465,7 @@ static expression* fsm_arg_parse_value(
       }
     } else if( sscanf( *str, "%[a-zA-Z0-9_]\[%d]%n", str_val, &lsb, &chars_read ) == 2 ) {
       *str = *str + chars_read;
-      if( (mparm = mod_parm_find( str_val, funit->param_head )) != NULL ) {
+      if( (mparm = funit_lookup_param( str_val, funit )) != NULL ) {
 
         /* Generate left child expression */
         left = expression_create( NULL, NULL, EXP_OP_STATIC, FALSE, curr_expr_id, 0, 0, 0, 0, 0, FALSE );
@@ -486,7 +487,7 @@ static expression* fsm_arg_parse_value(
       }
     } else if( sscanf( *str, "%[a-zA-Z0-9_]%n", str_val, &chars_read ) == 1 ) {
       *str = *str + chars_read;
-      if( (mparm = mod_parm_find( str_val, funit->param_head )) != NULL ) {
+      if( (mparm = funit_lookup_param( str_val, funit )) != NULL ) {
 
         /* Generate parameter expression */
         expr = expression_create( NULL, NULL, EXP_OP_PARAM, FALSE, curr_expr_id, 0, 0, 0, 0, 0, FALSE );
@@ -612,7 +613,7 @@ void fsm_arg_parse_attr(
       if( curr->expr != NULL ) {
         ignore = TRUE;
       } else {
-        table = fsm_link_find( curr->name, funit->fsms, funit->fsm_size );
+        table = funit_lookup_fsm( curr->name, funit );
       }
     } else if( (index == 2) && (strcmp( curr->name, "is" ) == 0) && (curr->expr != NULL) ) {
       if( table == NULL ) {
@@ -651,7 +652,7 @@ void fsm_arg_parse_attr(
             Throw 0;
           } else {
             (void)fsm_var_add( funit->name, out_state, out_state, curr->name, exclude );
-            table = fsm_link_find( curr->name, funit->fsms, funit->fsm_size );
+            table = funit_lookup_fsm( curr->name, funit );
           }
         } Catch_anonymous {
           free_safe( tmp, (slen + 1) );
@@ -679,7 +680,7 @@ void fsm_arg_parse_attr(
             Throw 0;
           } else {
             (void)fsm_var_add( funit->name, in_state, out_state, curr->name, exclude );
-            table = fsm_link_find( curr->name, funit->fsms, funit->fsm_size );
+            table = funit_lookup_fsm( curr->name, funit );
           }
         } Catch_anonymous {
           free_safe( tmp, (slen + 1) );
@@ -37,6 +37,7 @@
 #include "expr.h"
 #include "fsm.h"
 #include "fsm_var.h"
+#include "func_unit.h"
 #include "link.h"
 #include "obfuscate.h"
 #include "statement.h"
@@ -231,7 +232,7 @@ static void fsm_var_add_expr(
 
   if( expr != NULL ) {
 
-    if( exp_link_find( expr->id, funit->exps, funit->exp_size ) == NULL ) {
+    if( funit_lookup_expression( expr->id, funit ) == NULL ) {
 
       /* Set the global curr_funit to the expression's functional unit */
       curr_funit = funit;
@@ -29,6 +29,7 @@
 #include "fstapi.c"
 #include "symtable.h"
 #include "db.h"
+#include "dumppipe.h"
 #include "util.h"
 
 
@@ -39,6 +40,10 @@ extern char       user_msg[USER_MSG_LENGTH];
 extern symtable*  vcd_symtab;
 extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
+extern uint64     score_start_time;
+extern uint64     score_end_time;
+extern bool       checkpoint_resumed;
+extern uint64     checkpoint_resume_time;
 
 
 /*! Specifies the last timestamp simulated */
@@ -47,6 +52,9 @@ static uint64_t vcd_prevtime = 0;
 /*! Specifies the vcd_prevtime value has been assigned by the simulator */
 static bool vcd_prevtime_valid = FALSE;
 
+/*! Specifies that the remaining value changes are not simulated */
+static bool vcd_done = FALSE;
+
 /*! Specifies when we are handling dumping */
 static bool vcd_blackout;
 
@@ -68,6 +76,7 @@ static void fst_reader_process_hier(
   uint32_t msb, lsb;
   uint32_t maxvalpos=0;
   int num_signal_dyn = 65536;
+  unsigned char *bound;  /* Bitmap of handles whose symbols are used by the design */
 
   if( !xc ) {
     return;
@@ -88,6 +97,8 @@ static void fst_reader_process_hier(
   if( xc->signal_typs ) free(xc->signal_typs);
   xc->signal_typs = malloc(num_signal_dyn*sizeof(unsigned char));
 
+  bound = calloc( 1, num_signal_dyn/8 );
+
   fseeko( xc->fh, 0, SEEK_SET );
 
   while( !feof( xc->fh ) ) {
@@ -149,6 +160,8 @@ static void fst_reader_process_hier(
             num_signal_dyn *= 2;
             xc->signal_lens = realloc( xc->signal_lens, num_signal_dyn*sizeof(uint32_t) );
             xc->signal_typs = realloc( xc->signal_typs, num_signal_dyn*sizeof(unsigned char) );
+            bound = realloc( bound, num_signal_dyn/8 );
+            memset( (bound + (num_signal_dyn/16)), 0, (num_signal_dyn/16) );
           }
           xc->signal_lens[xc->maxhandle] = len;
           xc->signal_typs[xc->maxhandle] = vartype;
@@ -175,7 +188,9 @@ static void fst_reader_process_hier(
           }
           {
             uint32_t modlen = (vartype != FST_VT_VCD_PORT) ? len : ((len - 2) / 3);
-            db_assign_symbol( str, fstVcdID( xc->maxhandle + 1 ), msb, lsb );
+            if( db_assign_symbol( str, fstVcdID( xc->maxhandle + 1 ), msb, lsb ) ) {
+              bound[xc->maxhandle/8] |= (1<<(xc->maxhandle&7));
+            }
           }
           xc->maxhandle++;
         } else {
@@ -196,7 +211,9 @@ static void fst_reader_process_hier(
           }
           {
             uint32_t modlen = (vartype != FST_VT_VCD_PORT) ? len : ((len - 2) / 3);
-            db_assign_symbol( str, fstVcdID( alias ), msb, lsb );
+            if( db_assign_symbol( str, fstVcdID( alias ), msb, lsb ) ) {
+              bound[(alias-1)/8] |= (1<<((alias-1)&7));
+            }
           }
           xc->num_alias++;
         }
@@ -211,8 +228,9 @@ static void fst_reader_process_hier(
   xc->signal_lens = realloc( xc->signal_lens, xc->maxhandle*sizeof(uint32_t) );
   xc->signal_typs = realloc( xc->signal_typs, xc->maxhandle*sizeof(unsigned char) );
 
+  /* Only the value changes of handles that are used by the design need to be read */
   if( xc->process_mask ) { free( xc->process_mask ); }
-  xc->process_mask = calloc( 1, (xc->maxhandle+7)/8 );
+  xc->process_mask = bound;
 
   if( xc->temp_signal_value_buf ) free( xc->temp_signal_value_buf );
   xc->temp_signal_value_buf = malloc( xc->longest_signal_value_len + 1 );
@@ -224,7 +242,10 @@ static void fst_reader_process_hier(
 }
 
 /*!
- \throws anonymous db_do_timestep
+ \throws anonymous db_do_dump_timestep
+
+ Called by the FST reader for each value change.  Real values are delivered as native doubles
+ (the reader is told to do so in fst_simulate) and are passed on to the database in binary form.
 */
 static void fst_callback(
   void*                user_callback_data_pointer,
@@ -233,17 +254,35 @@ static void fst_callback(
   const unsigned char* value
 ) { PROFILE(FST_CALLBACK);
 
+  struct fstReaderContext* xc = (struct fstReaderContext*)user_callback_data_pointer;
+
+  /* Value changes up to the checkpoint that we resumed from have already been simulated */
+  bool skip = checkpoint_resumed && (time <= checkpoint_resume_time);
+
   /* If this is a new timestamp, perform a simulation */
-  if( (vcd_prevtime != time) || !vcd_prevtime_valid ) {
+  if( !skip && !vcd_done && ((vcd_prevtime != time) || !vcd_prevtime_valid) ) {
     if( vcd_prevtime_valid ) {
-      (void)db_do_timestep( vcd_prevtime, FALSE );
+      vcd_done = !db_do_dump_timestep( vcd_prevtime, time, 0 );
+    } else {
+      vcd_done = (time > score_end_time);
     }
     vcd_prevtime       = time;
     vcd_prevtime_valid = TRUE;
   }
 
   /* Handle dumpon/off information */
-  if( !value[0] ) {
+  if( vcd_done || skip ) {
+
+    /* The value changes after the end of simulation are ignored */
+
+  } else if( xc->signal_typs[facidx - 1] == FST_VT_VCD_REAL ) {
+
+    /* The double is not necessarily aligned in the reader's buffer */
+    double real;
+    memcpy( &real, value, sizeof( double ) );
+    db_set_symbol_real( fstVcdID( facidx ), real );
+
+  } else if( !value[0] ) {
 
     if( !vcd_blackout ) {
       vcd_blackout = TRUE;
@@ -267,6 +306,40 @@ static void fst_callback(
 
 }
 
+/*!
+ \throws anonymous db_do_dump_timestep fstReaderIterBlocks
+
+ Reads all value changes from the FST file, simulating each timestep.
+*/
+static void fst_simulate(
+  void* xc  /*!< Pointer to FST reader context */
+) { PROFILE(FST_SIMULATE);
+
+  uint64 start_time = score_start_time;
+
+  /* When resuming from a checkpoint, only the timesteps after it need to be read */
+  if( checkpoint_resumed && (start_time <= checkpoint_resume_time) ) {
+    start_time = checkpoint_resume_time + 1;
+  }
+
+  /* Skip the blocks that are entirely outside of the scored time window */
+  if( (start_time > 0) || (score_end_time != 0xffffffffffffffffLL) ) {
+    fstReaderSetLimitTimeRange( xc, start_time, score_end_time );
+  }
+
+  /* Perform simulation, receiving real values as doubles instead of strings */
+  fstReaderIterBlocksSetNativeDoublesOnCallback( xc, 1 );
+  fstReaderIterBlocks( (struct fstReaderContext*)xc, fst_callback, xc, NULL );
+
+  /* Perform last simulation if necessary */
+  if( vcd_prevtime_valid && !vcd_done ) {
+    (void)db_do_dump_timestep( vcd_prevtime, 0xffffffffffffffffLL, 0 );
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Main FST parsing function.  Reads in an FST-style dumpfile, tells Covered about signal information
  and simulation results.
@@ -296,16 +369,8 @@ void fst_parse(
         timestep_tab = malloc_safe_nolimit( sizeof( symtable*) * vcd_symtab_size );
       }
         
-      /* Not sure what this does but it seems to be a requirement of the FST reader */
-      fstReaderSetFacProcessMaskAll( xc );
-
       /* Perform simulation */
-      fstReaderIterBlocks( xc, fst_callback, NULL, NULL );
-
-      /* Perform last simulation if necessary */
-      if( vcd_prevtime_valid ) {
-        (void)db_do_timestep( vcd_prevtime, FALSE );
-      }
+      dumppipe_run( fst_simulate, xc );
 
     } Catch_anonymous {
       symtable_dealloc( vcd_symtab );
@@ -20,9 +20,14 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include "../config.h"
 #include "fstapi.h"
 #include "fastlz.h"
 
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_THREAD_BUILTINS)
+#include <pthread.h>
+#endif
+
 #undef  FST_DEBUG
 
 #define FST_BREAK_SIZE 			(32 * 1024 * 1024)
@@ -32,6 +37,8 @@
 #define FST_HDR_SIM_VERSION_SIZE 	(128)
 #define FST_HDR_DATE_SIZE 		(128)
 #define FST_GZIO_LEN			(32768)
+#define FST_READER_MAX_THREADS		(8)
+#define FST_READER_PARALLEL_MIN_CLEN	(64 * 1024)
 
 
 #if defined(__i386__) || defined(__x86_64__) || defined(_AIX)
@@ -3004,6 +3011,109 @@ if(xc)
  */
 
 /* normal read which re-interleaves the value change data */
+/*
+ * value change chains of a block are read in file order and then
+ * decompressed, in parallel when threads are available
+ */
+struct fstReaderChainJob
+{
+unsigned char *mc;
+unsigned char *mu;
+uint32_t clen;
+uint32_t uclen;
+int rc;
+};
+
+static void fstReaderDecompressChain(struct fstReaderChainJob *job, int packtype)
+{
+if(packtype == 'F')
+	{
+	job->rc = (fastlz_decompress(job->mc, job->clen, job->mu, job->uclen) == (int)job->uclen) ? Z_OK : Z_DATA_ERROR;
+	}
+	else
+	{
+	unsigned long destlen = job->uclen;
+
+	job->rc = uncompress(job->mu, &destlen, job->mc, job->clen);
+	}
+
+free(job->mc);
+job->mc = NULL;
+}
+
+
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_THREAD_BUILTINS)
+struct fstReaderChainPool
+{
+struct fstReaderChainJob *jobs;
+uint32_t num_jobs;
+volatile uint32_t next_job;
+int packtype;
+};
+
+static void *fstReaderDecompressChainsWorker(void *arg)
+{
+struct fstReaderChainPool *pool = (struct fstReaderChainPool *)arg;
+uint32_t j;
+
+while((j = __sync_fetch_and_add(&pool->next_job, 1)) < pool->num_jobs)
+	{
+	fstReaderDecompressChain(pool->jobs + j, pool->packtype);
+	}
+
+return(NULL);
+}
+#endif
+
+
+static void fstReaderDecompressChains(struct fstReaderChainJob *jobs, uint32_t num_jobs, uint64_t total_clen, int packtype)
+{
+uint32_t j;
+
+#if defined(HAVE_LIBPTHREAD) && defined(HAVE_THREAD_BUILTINS)
+if((num_jobs > 1) && (total_clen >= FST_READER_PARALLEL_MIN_CLEN))
+	{
+	struct fstReaderChainPool pool;
+	pthread_t threads[FST_READER_MAX_THREADS];
+	long num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int num_started = 0;
+	int t;
+
+	if(num_threads > FST_READER_MAX_THREADS) num_threads = FST_READER_MAX_THREADS;
+	if(num_threads > (long)num_jobs) num_threads = num_jobs;
+
+	pool.jobs = jobs;
+	pool.num_jobs = num_jobs;
+	pool.next_job = 0;
+	pool.packtype = packtype;
+
+	/* the calling thread works too, so the chains still get decompressed if no thread can be started */
+	for(t=1;t<num_threads;t++)
+		{
+		if(pthread_create(&threads[num_started], NULL, fstReaderDecompressChainsWorker, &pool) == 0)
+			{
+			num_started++;
+			}
+		}
+
+	(void)fstReaderDecompressChainsWorker(&pool);
+
+	for(t=0;t<num_started;t++)
+		{
+		pthread_join(threads[t], NULL);
+		}
+
+	return;
+	}
+#endif
+
+for(j=0;j<num_jobs;j++)
+	{
+	fstReaderDecompressChain(jobs + j, packtype);
+	}
+}
+
+
 int fstReaderIterBlocks(void *ctx,
         void (*value_change_callback)(void *user_callback_data_pointer, uint64_t time, fstHandle facidx, const unsigned char *value),
         void *user_callback_data_pointer, FILE *fv)
@@ -3016,6 +3126,8 @@ uint64_t tsec_nitems;
 int secnum = 0;
 off_t blkpos = 0;
 uint64_t seclen, beg_tim, end_tim;
+uint64_t frame_tim = 0;
+int blocks_skipped = 0;
 uint64_t frame_uclen, frame_clen, frame_maxhandle, vc_maxhandle; 
 off_t vc_start;
 off_t indx_pntr, indx_pos;
@@ -3035,6 +3147,9 @@ uint32_t traversal_mem_offs;
 uint32_t *scatterptr, *headptr, *length_remaining;
 uint32_t cur_blackout = 0;
 int packtype;
+struct fstReaderChainJob *chain_jobs = NULL;
+uint32_t chain_jobs_alloc = 0, num_chain_jobs;
+uint64_t chain_jobs_clen;
 
 if(!xc) return(0);
 
@@ -3074,8 +3189,10 @@ for(;;)
 
 	if(xc->limit_range_valid)
 		{
-		if(beg_tim < xc->limit_range_start)
+		if(end_tim < xc->limit_range_start) /* the frame of the first block processed provides the values at its start */
 			{
+			frame_tim = end_tim;
+			blocks_skipped = 1;
 			blkpos += seclen;
 			continue;
 			}
@@ -3163,17 +3280,20 @@ for(;;)
 
 	if(secnum == 0)
 		{
-		if(beg_tim != time_table[0])
+		if((beg_tim != time_table[0]) || blocks_skipped)
 			{
 			unsigned char *mu = malloc(frame_uclen);
 			uint32_t sig_offs = 0;
 
+			/* if earlier blocks were skipped, the frame holds the values after the last change of the last skipped block */
+			if(!blocks_skipped) { frame_tim = beg_tim; }
+
 			if(fv)
 				{
-				if(beg_tim) { fprintf(fv, "#%"PRIu64"\n", beg_tim); }
+				if(frame_tim) { fprintf(fv, "#%"PRIu64"\n", frame_tim); }
 				if((xc->num_blackouts)&&(cur_blackout != xc->num_blackouts))
 					{
-					if(beg_tim == xc->blackout_times[cur_blackout])
+					if(frame_tim == xc->blackout_times[cur_blackout])
 						{
 						fprintf(fv, "$dump%s $end\n", (xc->blackout_activity[cur_blackout++]) ? "on" : "off");
 						}
@@ -3217,7 +3337,7 @@ for(;;)
 							{
 							xc->temp_signal_value_buf[0] = val;
 							xc->temp_signal_value_buf[1] = 0;
-							value_change_callback(user_callback_data_pointer, beg_tim, idx+1, xc->temp_signal_value_buf);
+							value_change_callback(user_callback_data_pointer, frame_tim, idx+1, xc->temp_signal_value_buf);
 							}
 							else
 							{
@@ -3239,7 +3359,7 @@ for(;;)
 								{
 								memcpy(xc->temp_signal_value_buf, mu+sig_offs, xc->signal_lens[idx]);
 								xc->temp_signal_value_buf[xc->signal_lens[idx]] = 0;
-								value_change_callback(user_callback_data_pointer, beg_tim, idx+1, xc->temp_signal_value_buf);
+								value_change_callback(user_callback_data_pointer, frame_tim, idx+1, xc->temp_signal_value_buf);
 								}
 								else
 								{
@@ -3279,7 +3399,7 @@ for(;;)
 											clone_d[j] = srcdata[7-j];
 											}
 										}
-									value_change_callback(user_callback_data_pointer, beg_tim, idx+1, clone_d);
+									value_change_callback(user_callback_data_pointer, frame_tim, idx+1, clone_d);
 									}
 									else
 									{
@@ -3298,7 +3418,7 @@ for(;;)
 											}
 										}
 									sprintf((char *)xc->temp_signal_value_buf, "%.16g", d);
-									value_change_callback(user_callback_data_pointer, beg_tim, idx+1, xc->temp_signal_value_buf);
+									value_change_callback(user_callback_data_pointer, frame_tim, idx+1, xc->temp_signal_value_buf);
 									}
 								}
 								else
@@ -3368,6 +3488,14 @@ for(;;)
 		chain_table_lengths = malloc((vc_maxhandle+1) * sizeof(uint32_t));
 		}
 
+	if(xc->maxhandle > chain_jobs_alloc)
+		{
+		free(chain_jobs);
+
+		chain_jobs_alloc = xc->maxhandle;
+		chain_jobs = malloc(chain_jobs_alloc * sizeof(struct fstReaderChainJob));
+		}
+
 	pnt = chain_cmem;
 	idx = 0;
 	pval = 0;
@@ -3400,6 +3528,8 @@ for(;;)
 #endif
 	/* check compressed VC data */
 	if(idx > xc->maxhandle) idx = xc->maxhandle;
+	num_chain_jobs = 0;
+	chain_jobs_clen = 0;
 	for(i=0;i<idx;i++)
 		{
 		if(chain_table[i])
@@ -3409,30 +3539,22 @@ for(;;)
 
 	                if(xc->process_mask[process_idx]&(1<<process_bit))
 				{
-				int rc = Z_OK;
 				uint32_t val;
 				uint32_t skiplen;
-				uint32_t tdelta;
 	
 				fseeko(xc->f, vc_start + chain_table[i], SEEK_SET);
 				val = fstReaderVarint32WithSkip(xc->f, &skiplen);
 				if(val)
 					{
-					unsigned char *mu = mem_for_traversal + traversal_mem_offs;
-					unsigned char *mc = malloc(chain_table_lengths[i]);
-					unsigned long destlen = val;
-					unsigned long sourcelen = chain_table_lengths[i];
+					/* read now, decompress below once all of the chains of this block have been read */
+					struct fstReaderChainJob *job = chain_jobs + num_chain_jobs++;
 	
-					fstFread(mc, chain_table_lengths[i], 1, xc->f);
-					if(packtype == 'F')
-						{
-						rc = fastlz_decompress(mc, sourcelen, mu, destlen);
-						}
-						else
-						{
-						rc = uncompress(mu, &destlen, mc, sourcelen);
-						}
-					free(mc);
+					job->mu = mem_for_traversal + traversal_mem_offs;
+					job->clen = chain_table_lengths[i] - skiplen;
+					job->mc = malloc(job->clen);
+					job->uclen = val;
+					fstFread(job->mc, job->clen, 1, xc->f);
+					chain_jobs_clen += job->clen;
 					/* data to process is for(j=0;j<destlen;j++) in mu[j] */
 					headptr[i] = traversal_mem_offs;
 					length_remaining[i] = val;
@@ -3448,12 +3570,31 @@ for(;;)
 					length_remaining[i] = destlen;
 					traversal_mem_offs += destlen;
 					}
-	
-				if(rc != Z_OK)
-					{
-					printf("\tclen: %d (rc=%d)\n", (int)val, rc);
-					exit(255);
-					}
+				}
+			}
+		}
+
+	fstReaderDecompressChains(chain_jobs, num_chain_jobs, chain_jobs_clen, packtype);
+
+	for(i=0;i<num_chain_jobs;i++)
+		{
+		if(chain_jobs[i].rc != Z_OK)
+			{
+			printf("\tclen: %d (rc=%d)\n", (int)chain_jobs[i].uclen, chain_jobs[i].rc);
+			exit(255);
+			}
+		}
+
+	for(i=0;i<idx;i++)
+		{
+		if(chain_table[i])
+			{
+	                int process_idx = i/8;
+	                int process_bit = i&7;
+
+	                if(xc->process_mask[process_idx]&(1<<process_bit))
+				{
+				uint32_t tdelta;
 	
 				if(xc->signal_lens[i] == 1)
 					{
@@ -3755,6 +3896,7 @@ if(chain_table)
 	}
 
 free(time_table);
+free(chain_jobs);
 
 return(1);
 }
@@ -102,6 +102,7 @@ static void funit_init(
   funit->er_head         = NULL;
   funit->er_tail         = NULL;
   funit->parent          = NULL;
+  funit->index           = NULL;
   funit->elem.thr        = NULL;
 
   PROFILE_END;
@@ -130,6 +131,412 @@ func_unit* funit_create() { PROFILE(FUNIT_CREATE);
 
 }
 
+/*!
+ \return Returns a pointer to the lookup index of the given functional unit, creating it if it does
+         not already exist.
+*/
+static funit_index* funit_index_get(
+  func_unit* funit  /*!< Pointer to functional unit to get the lookup index for */
+) { PROFILE(FUNIT_INDEX_GET);
+
+  if( funit->index == NULL ) {
+    funit->index                 = (funit_index*)malloc_safe( sizeof( funit_index ) );
+    funit->index->sig_hash       = NULL;
+    funit->index->sig_hash_size  = 0;
+    funit->index->sig_num        = 0;
+    funit->index->exp_hash       = NULL;
+    funit->index->exp_hash_size  = 0;
+    funit->index->exp_num        = 0;
+    funit->index->fsm_hash       = NULL;
+    funit->index->fsm_hash_size  = 0;
+    funit->index->fsm_num        = 0;
+    funit->index->parm_hash      = NULL;
+    funit->index->parm_hash_size = 0;
+    funit->index->parm_num       = 0;
+    funit->index->parm_last      = NULL;
+  }
+
+  PROFILE_END;
+
+  return( funit->index );
+
+}
+
+/*!
+ \return Returns the number of hash buckets to use for a table that will hold the given number of elements.
+*/
+static unsigned int funit_index_calc_size(
+  unsigned int num  /*!< Number of elements that need to be stored in the hash table */
+) {
+
+  unsigned int size = 16;
+
+  while( (num * 2) > size ) {
+    size <<= 1;
+  }
+
+  return( size );
+
+}
+
+/*!
+ \return Returns the bucket in the signal hash table that contains the given signal name or
+         the empty bucket that the name would be placed in.
+*/
+static unsigned int funit_index_probe_signal(
+  const func_unit* funit,  /*!< Pointer to functional unit containing the signal index */
+  const char*      name    /*!< Name of signal to search for */
+) { PROFILE(FUNIT_INDEX_PROBE_SIGNAL);
+
+  funit_index* index  = funit->index;
+  unsigned int bucket = scope_hash( name ) & (index->sig_hash_size - 1);
+
+  while( (index->sig_hash[bucket] != 0) && !scope_compare( funit->sigs[index->sig_hash[bucket] - 1]->name, name ) ) {
+    bucket = (bucket + 1) & (index->sig_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ Adds any signals that have been appended to the given functional unit since the signal hash table was
+ last updated, growing (and rebuilding) the table as needed.
+*/
+static void funit_index_sync_signals(
+  func_unit* funit  /*!< Pointer to functional unit to update signal index for */
+) { PROFILE(FUNIT_INDEX_SYNC_SIGNALS);
+
+  funit_index* index = funit_index_get( funit );
+  unsigned int i;
+
+  if( ((funit->sig_size * 2) > index->sig_hash_size) || (index->sig_num > funit->sig_size) ) {
+    free_safe( index->sig_hash, (sizeof( unsigned int ) * index->sig_hash_size) );
+    index->sig_hash_size = funit_index_calc_size( funit->sig_size );
+    index->sig_hash      = (unsigned int*)calloc_safe( index->sig_hash_size, sizeof( unsigned int ) );
+    index->sig_num       = 0;
+  }
+
+  for( i=index->sig_num; i<funit->sig_size; i++ ) {
+    unsigned int bucket = funit_index_probe_signal( funit, funit->sigs[i]->name );
+    if( index->sig_hash[bucket] == 0 ) {
+      index->sig_hash[bucket] = (i + 1);
+    }
+  }
+  index->sig_num = funit->sig_size;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the bucket in the expression hash table that contains the given expression ID or
+         the empty bucket that the ID would be placed in.
+*/
+static unsigned int funit_index_probe_expression(
+  const func_unit* funit,  /*!< Pointer to functional unit containing the expression index */
+  int              id      /*!< Expression ID to search for */
+) { PROFILE(FUNIT_INDEX_PROBE_EXPRESSION);
+
+  funit_index* index  = funit->index;
+  unsigned int bucket = ((unsigned int)id * 0x9e3779b1) & (index->exp_hash_size - 1);
+
+  while( (index->exp_hash[bucket] != 0) && (funit->exps[index->exp_hash[bucket] - 1]->id != id) ) {
+    bucket = (bucket + 1) & (index->exp_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ Adds any expressions that have been appended to the given functional unit since the expression hash
+ table was last updated, growing (and rebuilding) the table as needed.
+*/
+static void funit_index_sync_expressions(
+  func_unit* funit  /*!< Pointer to functional unit to update expression index for */
+) { PROFILE(FUNIT_INDEX_SYNC_EXPRESSIONS);
+
+  funit_index* index = funit_index_get( funit );
+  unsigned int i;
+
+  if( ((funit->exp_size * 2) > index->exp_hash_size) || (index->exp_num > funit->exp_size) ) {
+    free_safe( index->exp_hash, (sizeof( unsigned int ) * index->exp_hash_size) );
+    index->exp_hash_size = funit_index_calc_size( funit->exp_size );
+    index->exp_hash      = (unsigned int*)calloc_safe( index->exp_hash_size, sizeof( unsigned int ) );
+    index->exp_num       = 0;
+  }
+
+  for( i=index->exp_num; i<funit->exp_size; i++ ) {
+    unsigned int bucket = funit_index_probe_expression( funit, funit->exps[i]->id );
+    if( index->exp_hash[bucket] == 0 ) {
+      index->exp_hash[bucket] = (i + 1);
+    }
+  }
+  index->exp_num = funit->exp_size;
+
+  PROFILE_END;
+
+}
+
+#ifndef RUNLIB
+/*!
+ \return Returns the bucket in the FSM hash table that contains the given FSM name or the empty bucket
+         that the name would be placed in.
+*/
+static unsigned int funit_index_probe_fsm(
+  const func_unit* funit,  /*!< Pointer to functional unit containing the FSM index */
+  const char*      name    /*!< Name of FSM to search for */
+) { PROFILE(FUNIT_INDEX_PROBE_FSM);
+
+  funit_index* index  = funit->index;
+  unsigned int bucket = scope_hash( name ) & (index->fsm_hash_size - 1);
+
+  while( (index->fsm_hash[bucket] != 0) && (strcmp( funit->fsms[index->fsm_hash[bucket] - 1]->name, name ) != 0) ) {
+    bucket = (bucket + 1) & (index->fsm_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ Adds any FSMs that have been appended to the given functional unit since the FSM hash table was last
+ updated, growing (and rebuilding) the table as needed.
+*/
+static void funit_index_sync_fsms(
+  func_unit* funit  /*!< Pointer to functional unit to update FSM index for */
+) { PROFILE(FUNIT_INDEX_SYNC_FSMS);
+
+  funit_index* index = funit_index_get( funit );
+  unsigned int i;
+
+  if( ((funit->fsm_size * 2) > index->fsm_hash_size) || (index->fsm_num > funit->fsm_size) ) {
+    free_safe( index->fsm_hash, (sizeof( unsigned int ) * index->fsm_hash_size) );
+    index->fsm_hash_size = funit_index_calc_size( funit->fsm_size );
+    index->fsm_hash      = (unsigned int*)calloc_safe( index->fsm_hash_size, sizeof( unsigned int ) );
+    index->fsm_num       = 0;
+  }
+
+  for( i=index->fsm_num; i<funit->fsm_size; i++ ) {
+    if( funit->fsms[i]->name != NULL ) {
+      unsigned int bucket = funit_index_probe_fsm( funit, funit->fsms[i]->name );
+      if( index->fsm_hash[bucket] == 0 ) {
+        index->fsm_hash[bucket] = (i + 1);
+      }
+    }
+  }
+  index->fsm_num = funit->fsm_size;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the bucket in the parameter hash table that contains the given parameter name or the
+         empty bucket that the name would be placed in.
+*/
+static unsigned int funit_index_probe_param(
+  const funit_index* index,  /*!< Pointer to functional unit lookup index */
+  const char*        name    /*!< Name of parameter to search for */
+) { PROFILE(FUNIT_INDEX_PROBE_PARAM);
+
+  unsigned int bucket = scope_hash( name ) & (index->parm_hash_size - 1);
+
+  while( (index->parm_hash[bucket] != NULL) && (strcmp( index->parm_hash[bucket]->name, name ) != 0) ) {
+    bucket = (bucket + 1) & (index->parm_hash_size - 1);
+  }
+
+  PROFILE_END;
+
+  return( bucket );
+
+}
+
+/*!
+ Adds any declared parameters that have been appended to the parameter list of the given functional unit
+ since the parameter hash table was last updated, growing (and rehashing) the table as needed.
+*/
+static void funit_index_sync_params(
+  func_unit* funit  /*!< Pointer to functional unit to update parameter index for */
+) { PROFILE(FUNIT_INDEX_SYNC_PARAMS);
+
+  funit_index* index = funit_index_get( funit );
+  mod_parm*    parm  = (index->parm_last == NULL) ? funit->param_head : index->parm_last->next;
+
+  while( parm != NULL ) {
+
+    if( (parm->name != NULL) && ((parm->suppl.part.type == PARAM_TYPE_DECLARED) || (parm->suppl.part.type == PARAM_TYPE_DECLARED_LOCAL)) ) {
+
+      unsigned int bucket;
+
+      /* Grow the table, if necessary */
+      if( ((index->parm_num + 1) * 2) > index->parm_hash_size ) {
+        mod_parm**   old_hash = index->parm_hash;
+        unsigned int old_size = index->parm_hash_size;
+        unsigned int i;
+        index->parm_hash_size = funit_index_calc_size( index->parm_num + 1 );
+        index->parm_hash      = (mod_parm**)calloc_safe( index->parm_hash_size, sizeof( mod_parm* ) );
+        for( i=0; i<old_size; i++ ) {
+          if( old_hash[i] != NULL ) {
+            index->parm_hash[funit_index_probe_param( index, old_hash[i]->name )] = old_hash[i];
+          }
+        }
+        free_safe( old_hash, (sizeof( mod_parm* ) * old_size) );
+      }
+
+      bucket = funit_index_probe_param( index, parm->name );
+      if( index->parm_hash[bucket] == NULL ) {
+        index->parm_hash[bucket] = parm;
+        index->parm_num++;
+      }
+
+    }
+
+    index->parm_last = parm;
+    parm             = parm->next;
+
+  }
+
+  PROFILE_END;
+
+}
+#endif /* RUNLIB */
+
+/*!
+ Deallocates the lookup index of the given functional unit.  This must be called whenever elements are
+ removed from the signal, expression, FSM or parameter lists of the functional unit.  The index will be
+ rebuilt the next time it is searched.
+*/
+void funit_index_clear(
+  func_unit* funit  /*!< Pointer to functional unit to clear the lookup index of */
+) { PROFILE(FUNIT_INDEX_CLEAR);
+
+  if( funit->index != NULL ) {
+
+    free_safe( funit->index->sig_hash,  (sizeof( unsigned int ) * funit->index->sig_hash_size) );
+    free_safe( funit->index->exp_hash,  (sizeof( unsigned int ) * funit->index->exp_hash_size) );
+    free_safe( funit->index->fsm_hash,  (sizeof( unsigned int ) * funit->index->fsm_hash_size) );
+    free_safe( funit->index->parm_hash, (sizeof( mod_parm* ) * funit->index->parm_hash_size) );
+    free_safe( funit->index, sizeof( funit_index ) );
+    funit->index = NULL;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the signal in the given functional unit with the given name if it exists;
+         otherwise, returns NULL.
+*/
+vsignal* funit_lookup_signal(
+  const char*      name,  /*!< Name of signal to find */
+  const func_unit* funit  /*!< Pointer to functional unit to search */
+) { PROFILE(FUNIT_LOOKUP_SIGNAL);
+
+  vsignal* sig = NULL;
+
+  if( funit->sig_size > 0 ) {
+    unsigned int i;
+    funit_index_sync_signals( (func_unit*)funit );
+    if( (i = funit->index->sig_hash[funit_index_probe_signal( funit, name )]) != 0 ) {
+      sig = funit->sigs[i - 1];
+    }
+  }
+
+  PROFILE_END;
+
+  return( sig );
+
+}
+
+/*!
+ \return Returns a pointer to the expression in the given functional unit with the given ID if it exists;
+         otherwise, returns NULL.
+*/
+expression* funit_lookup_expression(
+  int              id,    /*!< Expression ID to find */
+  const func_unit* funit  /*!< Pointer to functional unit to search */
+) { PROFILE(FUNIT_LOOKUP_EXPRESSION);
+
+  expression* exp = NULL;
+
+  if( funit->exp_size > 0 ) {
+    unsigned int i;
+    funit_index_sync_expressions( (func_unit*)funit );
+    if( (i = funit->index->exp_hash[funit_index_probe_expression( funit, id )]) != 0 ) {
+      exp = funit->exps[i - 1];
+    }
+  }
+
+  PROFILE_END;
+
+  return( exp );
+
+}
+
+#ifndef RUNLIB
+/*!
+ \return Returns a pointer to the FSM in the given functional unit with the given name if it exists;
+         otherwise, returns NULL.
+*/
+fsm* funit_lookup_fsm(
+  const char*      name,  /*!< Name of FSM to find */
+  const func_unit* funit  /*!< Pointer to functional unit to search */
+) { PROFILE(FUNIT_LOOKUP_FSM);
+
+  fsm* table = NULL;
+
+  if( funit->fsm_size > 0 ) {
+    unsigned int i;
+    funit_index_sync_fsms( (func_unit*)funit );
+    if( (i = funit->index->fsm_hash[funit_index_probe_fsm( funit, name )]) != 0 ) {
+      table = funit->fsms[i - 1];
+    }
+  }
+
+  PROFILE_END;
+
+  return( table );
+
+}
+
+/*!
+ \return Returns a pointer to the declared parameter in the given functional unit with the given name if
+         it exists; otherwise, returns NULL.
+
+ Performs the same search as mod_parm_find on the parameter list of the given functional unit.
+*/
+mod_parm* funit_lookup_param(
+  const char*      name,  /*!< Name of parameter to find */
+  const func_unit* funit  /*!< Pointer to functional unit to search */
+) { PROFILE(FUNIT_LOOKUP_PARAM);
+
+  mod_parm* parm = NULL;
+
+  assert( name != NULL );
+
+  funit_index_sync_params( (func_unit*)funit );
+
+  if( funit->index->parm_num > 0 ) {
+    parm = funit->index->parm_hash[funit_index_probe_param( funit->index, name )];
+  }
+
+  PROFILE_END;
+
+  return( parm );
+
+}
+#endif /* RUNLIB */
+
 #ifndef RUNLIB
 /*!
  \return Returns a pointer to the module that contains the specified functional unit.
@@ -265,7 +672,7 @@ mod_parm* funit_find_param(
 
   if( funit != NULL ) {
 
-    if( (mparm = mod_parm_find( name, funit->param_head )) == NULL ) {
+    if( (mparm = funit_lookup_param( name, funit )) == NULL ) {
       mparm = funit_find_param( name, funit->parent );
     }
 
@@ -303,7 +710,7 @@ vsignal* funit_find_signal(
   sig.name = name;
 
   /* Search for signal in given functional unit signal list */
-  if( (found_sig = sig_link_find( name, funit->sigs, funit->sig_size )) == NULL ) {
+  if( (found_sig = funit_lookup_signal( name, funit )) == NULL ) {
 
 #ifndef VPI_ONLY
 #ifndef RUNLIB
@@ -1070,7 +1477,7 @@ func_unit* funit_find_by_id(
 
   funitl = db_list[curr_db]->funit_head;
   while( (funitl != NULL) && (exp == NULL) ) {
-    if( (exp = exp_link_find( id, funitl->funit->exps, funitl->funit->exp_size )) == NULL ) {
+    if( (exp = funit_lookup_expression( id, funitl->funit )) == NULL ) {
       funitl = funitl->next;
     }
   }
@@ -1333,6 +1740,44 @@ void funit_push_threads(
 
 }
 
+#ifndef VPI_ONLY
+/*!
+ \return Returns the position of the given thread in the thread list of the given functional unit.
+
+ Threads are pushed onto the active queue in the order of this list (see \ref funit_push_threads), so a
+ simulation checkpoint records each thread's position in it.
+*/
+unsigned int funit_get_thread_position(
+  const func_unit* funit,  /*!< Pointer to functional unit containing the thread */
+  const thread*    thr     /*!< Pointer to thread to find */
+) { PROFILE(FUNIT_GET_THREAD_POSITION);
+
+  unsigned int pos = 0;
+
+  if( funit->suppl.part.etype == 1 ) {
+
+    thr_link* curr = funit->elem.tlist->head;
+
+    while( (curr != NULL) && (curr->thr != thr) ) {
+      pos++;
+      curr = curr->next;
+    }
+
+    assert( curr != NULL );
+
+  } else {
+
+    assert( funit->elem.thr == thr );
+
+  }
+
+  PROFILE_END;
+
+  return( pos );
+
+}
+#endif
+
 /*!
  Searches the given functional unit thread element for the given thread.  When the thread is found,
  its corresponding thread link is moved to the end of the thread list, the next pointer is updated
@@ -1466,6 +1911,9 @@ static void funit_clean(
     /* Set the global curr_funit to be the same as this funit */
     curr_funit = funit;
 
+    /* Free lookup index */
+    funit_index_clear( funit );
+
     /* Free signal list */
     sig_link_delete_list( funit->sigs, funit->sig_size, funit->sig_no_rm_index, TRUE );
     funit->sigs            = NULL;
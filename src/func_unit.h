@@ -31,6 +31,35 @@
 /*! \brief Creates new functional unit from heap and initializes structure. */
 func_unit* funit_create();
 
+/*! \brief Deallocates the lookup index of the given functional unit. */
+void funit_index_clear(
+  func_unit* funit
+);
+
+/*! \brief Finds the signal with the given name in the given functional unit. */
+vsignal* funit_lookup_signal(
+  const char*      name,
+  const func_unit* funit
+);
+
+/*! \brief Finds the expression with the given ID in the given functional unit. */
+expression* funit_lookup_expression(
+  int              id,
+  const func_unit* funit
+);
+
+/*! \brief Finds the FSM with the given name in the given functional unit. */
+fsm* funit_lookup_fsm(
+  const char*      name,
+  const func_unit* funit
+);
+
+/*! \brief Finds the declared parameter with the given name in the given functional unit. */
+mod_parm* funit_lookup_param(
+  const char*      name,
+  const func_unit* funit
+);
+
 /*! \brief Returns the parent module of the given functional unit. */
 func_unit* funit_get_curr_module(
   func_unit* funit
@@ -194,6 +223,14 @@ void funit_delete_thread(
   thread*    thr
 );
 
+#ifndef VPI_ONLY
+/*! \brief Returns the position of the given thread in the given functional unit's thread list */
+unsigned int funit_get_thread_position(
+  const func_unit* funit,
+  const thread*    thr
+);
+#endif
+
 /*! \brief Outputs dumpvars calls to the given file. */
 void funit_output_dumpvars(
   FILE*       vfile,
@@ -958,7 +958,7 @@ static void gen_item_resolve(
 
       case GI_TYPE_SIG :
         gitem_link_add( gen_item_create_sig( gi->elem.sig ), &(inst->gitem_head), &(inst->gitem_tail) );
-        if( sig_link_find( gi->elem.sig->name, inst->funit->sigs, inst->funit->sig_size ) == NULL ) {
+        if( funit_lookup_signal( gi->elem.sig->name, inst->funit ) == NULL ) {
           sig_link_add( gi->elem.sig, FALSE, &(inst->funit->sigs), &(inst->funit->sig_size), &(inst->funit->sig_no_rm_index) );
         }
         gen_item_resolve( gi->next_true, inst );
@@ -18,6 +18,10 @@
 #ifdef DEBUG
 profiler profiles[NUM_PROFILES] = {
   {"unregistered", NULL, 0, 0, 0, FALSE},
+  {"arc_state_hash_probe", NULL, 0, 0, 0, TRUE},
+  {"arc_arc_hash_probe", NULL, 0, 0, 0, TRUE},
+  {"arc_state_hash_add", NULL, 0, 0, 0, TRUE},
+  {"arc_arc_hash_add", NULL, 0, 0, 0, TRUE},
   {"arc_find_from_state", NULL, 0, 0, 0, TRUE},
   {"arc_find_to_state", NULL, 0, 0, 0, TRUE},
   {"arc_find_arc", NULL, 0, 0, 0, TRUE},
@@ -111,6 +115,7 @@ profiler profiles[NUM_PROFILES] = {
   {"db_check_for_top_module", NULL, 0, 0, 0, TRUE},
   {"db_write", NULL, 0, 0, 0, TRUE},
   {"db_read", NULL, 0, 0, 0, TRUE},
+  {"db_mark_2state_signals", NULL, 0, 0, 0, TRUE},
   {"db_assign_ids", NULL, 0, 0, 0, TRUE},
   {"db_merge_instance_trees", NULL, 0, 0, 0, TRUE},
   {"db_merge_funits", NULL, 0, 0, 0, TRUE},
@@ -165,12 +170,18 @@ profiler profiles[NUM_PROFILES] = {
   {"db_remove_stmt_blks_calling_statement", NULL, 0, 0, 0, TRUE},
   {"db_gen_curr_inst_scope", NULL, 0, 0, 0, TRUE},
   {"db_sync_curr_instance", NULL, 0, 0, 0, TRUE},
+  {"db_vcd_scope_build_hash", NULL, 0, 0, 0, TRUE},
+  {"db_vcd_scope_probe_hash", NULL, 0, 0, 0, TRUE},
+  {"db_vcd_scope_find_child", NULL, 0, 0, 0, TRUE},
   {"db_set_vcd_scope", NULL, 0, 0, 0, TRUE},
   {"db_vcd_upscope", NULL, 0, 0, 0, TRUE},
   {"db_assign_symbol", NULL, 0, 0, 0, TRUE},
   {"db_set_symbol_char", NULL, 0, 0, 0, TRUE},
   {"db_set_symbol_string", NULL, 0, 0, 0, TRUE},
+  {"db_set_symbol_real", NULL, 0, 0, 0, TRUE},
+  {"db_simulate_timestep", NULL, 0, 0, 0, TRUE},
   {"db_do_timestep", NULL, 0, 0, 0, TRUE},
+  {"db_do_dump_timestep", NULL, 0, 0, 0, TRUE},
   {"db_check_dumpfile_scopes", NULL, 0, 0, 0, TRUE},
   {"db_verilator_initialize", NULL, 0, 0, 0, TRUE},
   {"db_verilator_close", NULL, 0, 0, 0, TRUE},
@@ -201,6 +212,7 @@ profiler profiles[NUM_PROFILES] = {
   {"exclude_resolve_reason", NULL, 0, 0, 0, TRUE},
   {"exclude_db_merge", NULL, 0, 0, 0, TRUE},
   {"exclude_merge", NULL, 0, 0, 0, TRUE},
+  {"exclude_get_index", NULL, 0, 0, 0, TRUE},
   {"exclude_find_signal", NULL, 0, 0, 0, TRUE},
   {"exclude_find_expression", NULL, 0, 0, 0, TRUE},
   {"exclude_find_fsm_arc", NULL, 0, 0, 0, TRUE},
@@ -404,6 +416,7 @@ profiler profiles[NUM_PROFILES] = {
   {"fsm_var_cleanup", NULL, 0, 0, 0, TRUE},
   {"fst_reader_process_hier", NULL, 0, 0, 0, TRUE},
   {"fst_callback", NULL, 0, 0, 0, TRUE},
+  {"fst_simulate", NULL, 0, 0, 0, TRUE},
   {"fst_parse", NULL, 0, 0, 0, TRUE},
   {"func_iter_display", NULL, 0, 0, 0, TRUE},
   {"func_iter_sort", NULL, 0, 0, 0, TRUE},
@@ -416,6 +429,20 @@ profiler profiles[NUM_PROFILES] = {
   {"func_iter_dealloc", NULL, 0, 0, 0, TRUE},
   {"funit_init", NULL, 0, 0, 0, TRUE},
   {"funit_create", NULL, 0, 0, 0, TRUE},
+  {"funit_index_get", NULL, 0, 0, 0, TRUE},
+  {"funit_index_probe_signal", NULL, 0, 0, 0, TRUE},
+  {"funit_index_sync_signals", NULL, 0, 0, 0, TRUE},
+  {"funit_index_probe_expression", NULL, 0, 0, 0, TRUE},
+  {"funit_index_sync_expressions", NULL, 0, 0, 0, TRUE},
+  {"funit_index_probe_fsm", NULL, 0, 0, 0, TRUE},
+  {"funit_index_sync_fsms", NULL, 0, 0, 0, TRUE},
+  {"funit_index_probe_param", NULL, 0, 0, 0, TRUE},
+  {"funit_index_sync_params", NULL, 0, 0, 0, TRUE},
+  {"funit_index_clear", NULL, 0, 0, 0, TRUE},
+  {"funit_lookup_signal", NULL, 0, 0, 0, TRUE},
+  {"funit_lookup_expression", NULL, 0, 0, 0, TRUE},
+  {"funit_lookup_fsm", NULL, 0, 0, 0, TRUE},
+  {"funit_lookup_param", NULL, 0, 0, 0, TRUE},
   {"funit_get_curr_module", NULL, 0, 0, 0, TRUE},
   {"funit_get_curr_module_safe", NULL, 0, 0, 0, TRUE},
   {"funit_get_curr_function", NULL, 0, 0, 0, TRUE},
@@ -441,6 +468,7 @@ profiler profiles[NUM_PROFILES] = {
   {"funit_display_expressions", NULL, 0, 0, 0, TRUE},
   {"statement_add_thread", NULL, 0, 0, 0, FALSE},
   {"funit_push_threads", NULL, 0, 0, 0, TRUE},
+  {"funit_get_thread_position", NULL, 0, 0, 0, TRUE},
   {"statement_delete_thread", NULL, 0, 0, 0, TRUE},
   {"funit_output_dumpvars", NULL, 0, 0, 0, TRUE},
   {"funit_is_one_signal_assigned", NULL, 0, 0, 0, TRUE},
@@ -567,6 +595,12 @@ profiler profiles[NUM_PROFILES] = {
   {"instance_find_by_funit", NULL, 0, 0, 0, TRUE},
   {"instance_find_by_funit_name_if_one_helper", NULL, 0, 0, 0, TRUE},
   {"instance_find_by_funit_name_if_one", NULL, 0, 0, 0, TRUE},
+  {"instance_count_exclusion_ids", NULL, 0, 0, 0, TRUE},
+  {"instance_gather_exclusion_ids", NULL, 0, 0, 0, TRUE},
+  {"instance_sort_exclusion_ids", NULL, 0, 0, 0, TRUE},
+  {"instance_search_exclusion_ids", NULL, 0, 0, 0, TRUE},
+  {"instance_exclusion_index_create", NULL, 0, 0, 0, TRUE},
+  {"instance_exclusion_index_dealloc", NULL, 0, 0, 0, TRUE},
   {"instance_find_signal_by_exclusion_id", NULL, 0, 0, 0, TRUE},
   {"instance_find_expression_by_exclusion_id", NULL, 0, 0, 0, TRUE},
   {"instance_find_fsm_arc_index_by_exclusion_id", NULL, 0, 0, 0, TRUE},
@@ -637,6 +671,7 @@ profiler profiles[NUM_PROFILES] = {
   {"inst_link_delete_list", NULL, 0, 0, 0, TRUE},
   {"vcdid", NULL, 0, 0, 0, TRUE},
   {"vcd_callback", NULL, 0, 0, 0, TRUE},
+  {"lxt_simulate", NULL, 0, 0, 0, TRUE},
   {"lxt_parse", NULL, 0, 0, 0, TRUE},
   {"lxt2_rd_expand_integer_to_bits", NULL, 0, 0, 0, TRUE},
   {"lxt2_rd_expand_bits_to_integer", NULL, 0, 0, 0, TRUE},
@@ -787,8 +822,12 @@ profiler profiles[NUM_PROFILES] = {
   {"def_finish", NULL, 0, 0, 0, TRUE},
   {"def_undefine", NULL, 0, 0, 0, TRUE},
   {"include_filename", NULL, 0, 0, 0, TRUE},
+  {"include_lookup", NULL, 0, 0, 0, TRUE},
+  {"pplexer_include_cache_clear", NULL, 0, 0, 0, TRUE},
   {"do_include", NULL, 0, 0, 0, TRUE},
   {"yywrap", NULL, 0, 0, 0, TRUE},
+  {"pplexer_take_output", NULL, 0, 0, 0, TRUE},
+  {"pplexer_take_includes", NULL, 0, 0, 0, TRUE},
   {"reset_pplexer", NULL, 0, 0, 0, TRUE},
   {"race_blk_create", NULL, 0, 0, 0, TRUE},
   {"race_find_head_statement_containing_statement_helper", NULL, 0, 0, 0, TRUE},
@@ -828,11 +867,17 @@ profiler profiles[NUM_PROFILES] = {
   {"rank_perform", NULL, 0, 0, 0, TRUE},
   {"rank_output", NULL, 0, 0, 0, TRUE},
   {"command_rank", NULL, 0, 0, 0, TRUE},
-  {"reentrant_count_afu_bits", NULL, 0, 0, 0, TRUE},
-  {"reentrant_store_data_bits", NULL, 0, 0, 0, TRUE},
-  {"reentrant_restore_data_bits", NULL, 0, 0, 0, TRUE},
+  {"reentrant_stack_reserve", NULL, 0, 0, 0, TRUE},
+  {"reentrant_store_vector", NULL, 0, 0, 0, TRUE},
+  {"reentrant_restore_vector", NULL, 0, 0, 0, TRUE},
+  {"reentrant_store_data", NULL, 0, 0, 0, TRUE},
+  {"reentrant_restore_data", NULL, 0, 0, 0, TRUE},
   {"reentrant_create", NULL, 0, 0, 0, TRUE},
   {"reentrant_dealloc", NULL, 0, 0, 0, TRUE},
+  {"reentrant_dealloc_all", NULL, 0, 0, 0, TRUE},
+  {"reentrant_checkpoint_write", NULL, 0, 0, 0, TRUE},
+  {"reentrant_checkpoint_read", NULL, 0, 0, 0, TRUE},
+  {"reentrant_find", NULL, 0, 0, 0, TRUE},
   {"report_parse_metrics", NULL, 0, 0, 0, TRUE},
   {"report_parse_args", NULL, 0, 0, 0, TRUE},
   {"report_gather_instance_stats", NULL, 0, 0, 0, TRUE},
@@ -870,6 +915,8 @@ profiler profiles[NUM_PROFILES] = {
   {"sim_thread_insert_into_delay_queue", NULL, 0, 0, 0, TRUE},
   {"sim_thread_push", NULL, 0, 0, 0, TRUE},
   {"sim_expr_changed", NULL, 0, 0, 0, TRUE},
+  {"sim_fanout_changed", NULL, 0, 0, 0, TRUE},
+  {"sim_alloc_thread", NULL, 0, 0, 0, TRUE},
   {"sim_create_thread", NULL, 0, 0, 0, TRUE},
   {"sim_add_thread", NULL, 0, 0, 0, TRUE},
   {"sim_kill_thread", NULL, 0, 0, 0, TRUE},
@@ -883,6 +930,10 @@ profiler profiles[NUM_PROFILES] = {
   {"sim_finish", NULL, 0, 0, 0, TRUE},
   {"sim_add_nonblock_assign", NULL, 0, 0, 0, TRUE},
   {"sim_perform_nba", NULL, 0, 0, 0, TRUE},
+  {"sim_checkpoint_write_thread", NULL, 0, 0, 0, TRUE},
+  {"sim_checkpoint_write", NULL, 0, 0, 0, TRUE},
+  {"sim_checkpoint_read_thread", NULL, 0, 0, 0, TRUE},
+  {"sim_checkpoint_read", NULL, 0, 0, 0, TRUE},
   {"sim_dealloc", NULL, 0, 0, 0, TRUE},
   {"statistic_create", NULL, 0, 0, 0, TRUE},
   {"statistic_is_empty", NULL, 0, 0, 0, TRUE},
@@ -937,11 +988,13 @@ profiler profiles[NUM_PROFILES] = {
   {"symtable_add_memory", NULL, 0, 0, 0, TRUE},
   {"symtable_add_fsm", NULL, 0, 0, 0, TRUE},
   {"symtable_set_value", NULL, 0, 0, 0, TRUE},
+  {"symtable_set_real", NULL, 0, 0, 0, TRUE},
   {"symtable_assign", NULL, 0, 0, 0, TRUE},
   {"symtable_dealloc", NULL, 0, 0, 0, TRUE},
   {"sys_task_uniform", NULL, 0, 0, 0, TRUE},
   {"sys_task_rtl_dist_uniform", NULL, 0, 0, 0, TRUE},
   {"sys_task_srandom", NULL, 0, 0, 0, TRUE},
+  {"sys_task_get_random_seed", NULL, 0, 0, 0, TRUE},
   {"sys_task_random", NULL, 0, 0, 0, TRUE},
   {"sys_task_urandom", NULL, 0, 0, 0, FALSE},
   {"sys_task_urandom_range", NULL, 0, 0, 0, FALSE},
@@ -1033,6 +1086,7 @@ profiler profiles[NUM_PROFILES] = {
   {"get_absolute_path", NULL, 0, 0, 0, TRUE},
   {"get_relative_path", NULL, 0, 0, 0, TRUE},
   {"directory_exists", NULL, 0, 0, 0, TRUE},
+  {"directory_name_add", NULL, 0, 0, 0, TRUE},
   {"directory_load", NULL, 0, 0, 0, TRUE},
   {"file_exists", NULL, 0, 0, 0, TRUE},
   {"util_readline", NULL, 0, 0, 0, TRUE},
@@ -1043,8 +1097,12 @@ profiler profiles[NUM_PROFILES] = {
   {"scope_extract_scope", NULL, 0, 0, 0, TRUE},
   {"scope_gen_printable", NULL, 0, 0, 0, TRUE},
   {"scope_compare", NULL, 0, 0, 0, TRUE},
+  {"scope_hash", NULL, 0, 0, 0, TRUE},
   {"scope_local", NULL, 0, 0, 0, TRUE},
   {"convert_file_to_module", NULL, 0, 0, 0, TRUE},
+  {"vfile_index_dealloc", NULL, 0, 0, 0, TRUE},
+  {"vfile_index_create", NULL, 0, 0, 0, TRUE},
+  {"vfile_index_clear", NULL, 0, 0, 0, TRUE},
   {"get_next_vfile", NULL, 0, 0, 0, TRUE},
   {"gen_space", NULL, 0, 0, 0, TRUE},
   {"remove_underscores", NULL, 0, 0, 0, TRUE},
@@ -1052,9 +1110,14 @@ profiler profiles[NUM_PROFILES] = {
   {"calc_miss_percent", NULL, 0, 0, 0, TRUE},
   {"read_command_file", NULL, 0, 0, 0, TRUE},
   {"convert_str_to_uint64", NULL, 0, 0, 0, TRUE},
+  {"convert_str_to_real", NULL, 0, 0, 0, TRUE},
   {"convert_int_to_str", NULL, 0, 0, 0, TRUE},
   {"calc_num_bits_to_store", NULL, 0, 0, 0, TRUE},
   {"vcd_calc_index", NULL, 0, 0, 0, TRUE},
+  {"vcd_id_hash", NULL, 0, 0, 0, TRUE},
+  {"vcd_id_filter_build", NULL, 0, 0, 0, TRUE},
+  {"vcd_id_filter_dealloc", NULL, 0, 0, 0, TRUE},
+  {"vcd_id_used", NULL, 0, 0, 0, TRUE},
   {"vcd_getch_fetch", NULL, 0, 0, 0, TRUE},
   {"vcd_get_token", NULL, 0, 0, 0, TRUE},
   {"vcd_sync_end", NULL, 0, 0, 0, TRUE},
@@ -1062,8 +1125,12 @@ profiler profiles[NUM_PROFILES] = {
   {"vcd_parse_def", NULL, 0, 0, 0, TRUE},
   {"vcd_parse_sim_vector", NULL, 0, 0, 0, TRUE},
   {"vcd_parse_sim_real", NULL, 0, 0, 0, TRUE},
+  {"vcd_shard_find_time", NULL, 0, 0, 0, TRUE},
+  {"vcd_shard_index", NULL, 0, 0, 0, TRUE},
+  {"vcd_shard_start", NULL, 0, 0, 0, TRUE},
   {"vcd_parse_sim", NULL, 0, 0, 0, TRUE},
   {"vcd_parse", NULL, 0, 0, 0, TRUE},
+  {"vector_get_writable_row", NULL, 0, 0, 0, TRUE},
   {"vector_init_ulong", NULL, 0, 0, 0, TRUE},
   {"vector_int_r64", NULL, 0, 0, 0, TRUE},
   {"vector_int_r32", NULL, 0, 0, 0, TRUE},
@@ -1075,6 +1142,8 @@ profiler profiles[NUM_PROFILES] = {
   {"vector_db_read", NULL, 0, 0, 0, TRUE},
   {"vector_db_merge", NULL, 0, 0, 0, TRUE},
   {"vector_merge", NULL, 0, 0, 0, TRUE},
+  {"vector_checkpoint_write", NULL, 0, 0, 0, TRUE},
+  {"vector_checkpoint_read", NULL, 0, 0, 0, TRUE},
   {"vector_get_eval_a", NULL, 0, 0, 0, TRUE},
   {"vector_get_eval_b", NULL, 0, 0, 0, TRUE},
   {"vector_get_eval_c", NULL, 0, 0, 0, TRUE},
@@ -1116,7 +1185,9 @@ profiler profiles[NUM_PROFILES] = {
   {"vector_to_string", NULL, 0, 0, 0, TRUE},
   {"vector_from_string_fixed", NULL, 0, 0, 0, TRUE},
   {"vector_from_string", NULL, 0, 0, 0, TRUE},
+  {"vector_changed_range", NULL, 0, 0, 0, TRUE},
   {"vector_vcd_assign", NULL, 0, 0, 0, TRUE},
+  {"vector_vcd_assign_real", NULL, 0, 0, 0, TRUE},
   {"vector_vcd_assign2", NULL, 0, 0, 0, TRUE},
   {"vector_bitwise_and_op", NULL, 0, 0, 0, TRUE},
   {"vector_bitwise_nand_op", NULL, 0, 0, 0, TRUE},
@@ -1130,6 +1201,7 @@ profiler profiles[NUM_PROFILES] = {
   {"vector_op_ge", NULL, 0, 0, 0, TRUE},
   {"vector_op_eq", NULL, 0, 0, 0, TRUE},
   {"vector_ceq_ulong", NULL, 0, 0, 0, TRUE},
+  {"vector_hash_ulong", NULL, 0, 0, 0, TRUE},
   {"vector_op_ceq", NULL, 0, 0, 0, TRUE},
   {"vector_op_cxeq", NULL, 0, 0, 0, TRUE},
   {"vector_op_czeq", NULL, 0, 0, 0, TRUE},
@@ -1177,19 +1249,61 @@ profiler profiles[NUM_PROFILES] = {
   {"covered_register", NULL, 0, 0, 0, TRUE},
   {"vsignal_init", NULL, 0, 0, 0, TRUE},
   {"vsignal_create", NULL, 0, 0, 0, TRUE},
+  {"vsignal_dealloc_fanouts", NULL, 0, 0, 0, TRUE},
   {"vsignal_create_vec", NULL, 0, 0, 0, TRUE},
   {"vsignal_duplicate", NULL, 0, 0, 0, TRUE},
   {"vsignal_db_write", NULL, 0, 0, 0, TRUE},
   {"vsignal_db_read", NULL, 0, 0, 0, TRUE},
   {"vsignal_db_merge", NULL, 0, 0, 0, TRUE},
   {"vsignal_merge", NULL, 0, 0, 0, TRUE},
+  {"vsignal_fanout_range", NULL, 0, 0, 0, TRUE},
+  {"vsignal_create_fanouts", NULL, 0, 0, 0, TRUE},
+  {"vsignal_propagate_range", NULL, 0, 0, 0, TRUE},
   {"vsignal_propagate", NULL, 0, 0, 0, TRUE},
+  {"vsignal_mark_changed", NULL, 0, 0, 0, TRUE},
   {"vsignal_vcd_assign", NULL, 0, 0, 0, TRUE},
+  {"vsignal_vcd_assign_real", NULL, 0, 0, 0, TRUE},
   {"vsignal_add_expression", NULL, 0, 0, 0, TRUE},
   {"vsignal_from_string", NULL, 0, 0, 0, TRUE},
   {"vsignal_calc_width_for_expr", NULL, 0, 0, 0, TRUE},
   {"vsignal_calc_lsb_for_expr", NULL, 0, 0, 0, TRUE},
-  {"vsignal_dealloc", NULL, 0, 0, 0, TRUE}
+  {"vsignal_dealloc", NULL, 0, 0, 0, TRUE},
+  {"ppcache_read_file", NULL, 0, 0, 0, TRUE},
+  {"ppcache_hash_file", NULL, 0, 0, 0, TRUE},
+  {"ppcache_entry_name", NULL, 0, 0, 0, TRUE},
+  {"ppcache_resolve_include", NULL, 0, 0, 0, TRUE},
+  {"ppcache_check_include", NULL, 0, 0, 0, TRUE},
+  {"ppcache_load_entry", NULL, 0, 0, 0, TRUE},
+  {"ppcache_lookup", NULL, 0, 0, 0, TRUE},
+  {"ppcache_store", NULL, 0, 0, 0, TRUE},
+  {"dumppipe_consume", NULL, 0, 0, 0, TRUE},
+  {"dumppipe_run", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write_data", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_data", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_ptr_map_create", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_ptr_map_find", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_funits_create", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_funits_dealloc", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write_funit", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_funit", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_expression_dim", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write_expression", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_expression", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write_fsm", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_fsm", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write_design", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_design", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_due", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_write", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_read_header", NULL, 0, 0, 0, TRUE},
+  {"checkpoint_initialize", NULL, 0, 0, 0, TRUE},
+  {"shard_fork", NULL, 0, 0, 0, TRUE},
+  {"shard_started", NULL, 0, 0, 0, TRUE},
+  {"shard_db_name", NULL, 0, 0, 0, TRUE},
+  {"shard_exit", NULL, 0, 0, 0, TRUE},
+  {"shard_dealloc", NULL, 0, 0, 0, TRUE},
+  {"shard_merge", NULL, 0, 0, 0, TRUE},
+  {"shard_abort", NULL, 0, 0, 0, TRUE}
 };
 #endif
 
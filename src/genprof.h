@@ -24,1182 +24,1296 @@
 
 #include "defines.h"
 
-#define NUM_PROFILES 1173
+#define NUM_PROFILES 1287
 
 #ifdef DEBUG
 #define UNREGISTERED 0
-#define ARC_FIND_FROM_STATE 1
-#define ARC_FIND_TO_STATE 2
-#define ARC_FIND_ARC 3
-#define ARC_FIND_ARC_BY_EXCLUSION_ID 4
-#define ARC_CREATE 5
-#define ARC_ADD 6
-#define ARC_STATE_HITS 7
-#define ARC_TRANSITION_HITS 8
-#define ARC_TRANSITION_EXCLUDED 9
-#define ARC_GET_STATS 10
-#define ARC_DB_WRITE 11
-#define ARC_DB_READ 12
-#define ARC_DB_MERGE 13
-#define ARC_MERGE 14
-#define ARC_GET_STATES 15
-#define ARC_GET_TRANSITIONS 16
-#define ARC_ARE_ANY_EXCLUDED 17
-#define ARC_DEALLOC 18
-#define ASSERTION_PARSE 19
-#define ASSERTION_PARSE_ATTR 20
-#define ASSERTION_GET_STATS 21
-#define ASSERTION_DISPLAY_INSTANCE_SUMMARY 22
-#define ASSERTION_INSTANCE_SUMMARY 23
-#define ASSERTION_DISPLAY_FUNIT_SUMMARY 24
-#define ASSERTION_FUNIT_SUMMARY 25
-#define ASSERTION_DISPLAY_VERBOSE 26
-#define ASSERTION_INSTANCE_VERBOSE 27
-#define ASSERTION_FUNIT_VERBOSE 28
-#define ASSERTION_REPORT 29
-#define ASSERTION_GET_FUNIT_SUMMARY 30
-#define ASSERTION_COLLECT 31
-#define ASSERTION_GET_COVERAGE 32
-#define ATTRIBUTE_CREATE 33
-#define ATTRIBUTE_PARSE 34
-#define ATTRIBUTE_DEALLOC 35
-#define BIND_ADD 36
-#define BIND_APPEND_FSM_EXPR 37
-#define BIND_REMOVE 38
-#define BIND_FIND_SIG_NAME 39
-#define BIND_PARAM 40
-#define BIND_SIGNAL 41
-#define BIND_TASK_FUNCTION_PORTS 42
-#define BIND_TASK_FUNCTION_NAMEDBLOCK 43
-#define BIND_PERFORM 44
-#define BIND_DEALLOC 45
-#define CODEGEN_CREATE_EXPR_HELPER 46
-#define CODEGEN_CREATE_EXPR 47
-#define CODEGEN_GEN_EXPR1 48
-#define CODEGEN_GEN_EXPR 49
-#define CODEGEN_GEN_EXPR_ONE_LINE 50
-#define COMBINATION_CALC_DEPTH 51
-#define COMBINATION_DOES_MULTI_EXP_NEED_UL 52
-#define COMBINATION_MULTI_EXPR_CALC 53
-#define COMBINATION_IS_EXPR_MULTI_NODE 54
-#define COMBINATION_GET_TREE_STATS 55
-#define COMBINATION_RESET_COUNTED_EXPRS 56
-#define COMBINATION_RESET_COUNTED_EXPR_TREE 57
-#define COMBINATION_GET_STATS 58
-#define COMBINATION_GET_FUNIT_SUMMARY 59
-#define COMBINATION_GET_INST_SUMMARY 60
-#define COMBINATION_DISPLAY_INSTANCE_SUMMARY 61
-#define COMBINATION_INSTANCE_SUMMARY 62
-#define COMBINATION_DISPLAY_FUNIT_SUMMARY 63
-#define COMBINATION_FUNIT_SUMMARY 64
-#define COMBINATION_DRAW_LINE 65
-#define COMBINATION_DRAW_CENTERED_LINE 66
-#define COMBINATION_PARENTHESIZE 67
-#define COMBINATION_UNDERLINE_TREE 68
-#define COMBINATION_PREP_LINE 69
-#define COMBINATION_UNDERLINE 70
-#define COMBINATION_UNARY 71
-#define COMBINATION_EVENT 72
-#define COMBINATION_TWO_VARS 73
-#define COMBINATION_MULTI_VAR_EXPRS 74
-#define COMBINATION_MULTI_EXPR_OUTPUT_LENGTH 75
-#define COMBINATION_MULTI_EXPR_OUTPUT 76
-#define COMBINATION_MULTI_VARS 77
-#define COMBINATION_GET_MISSED_EXPR 78
-#define COMBINATION_LIST_MISSED 79
-#define COMBINATION_OUTPUT_EXPR 80
-#define COMBINATION_DISPLAY_VERBOSE 81
-#define COMBINATION_INSTANCE_VERBOSE 82
-#define COMBINATION_FUNIT_VERBOSE 83
-#define COMBINATION_COLLECT 84
-#define COMBINATION_GET_EXCLUDE_LIST 85
-#define COMBINATION_GET_EXPRESSION 86
-#define COMBINATION_GET_COVERAGE 87
-#define COMBINATION_REPORT 88
-#define DB_CREATE 89
-#define DB_CLOSE 90
-#define DB_CHECK_FOR_TOP_MODULE 91
-#define DB_WRITE 92
-#define DB_READ 93
-#define DB_ASSIGN_IDS 94
-#define DB_MERGE_INSTANCE_TREES 95
-#define DB_MERGE_FUNITS 96
-#define DB_SCALE_TO_PRECISION 97
-#define DB_CREATE_UNNAMED_SCOPE 98
-#define DB_IS_UNNAMED_SCOPE 99
-#define DB_SET_TIMESCALE 100
-#define DB_FIND_AND_SET_CURR_FUNIT 101
-#define DB_GET_CURR_FUNIT 102
-#define DB_GET_FUNIT_BY_POSITION 103
-#define DB_GET_EXCLUSION_ID_SIZE 104
-#define DB_GEN_EXCLUSION_ID 105
-#define DB_ADD_FILE_VERSION 106
-#define DB_OUTPUT_DUMPVARS 107
-#define DB_ADD_INSTANCE 108
-#define DB_ADD_MODULE 109
-#define DB_END_MODULE 110
-#define DB_ADD_FUNCTION_TASK_NAMEDBLOCK 111
-#define DB_END_FUNCTION_TASK_NAMEDBLOCK 112
-#define DB_ADD_DECLARED_PARAM 113
-#define DB_ADD_OVERRIDE_PARAM 114
-#define DB_ADD_VECTOR_PARAM 115
-#define DB_ADD_DEFPARAM 116
-#define DB_ADD_SIGNAL 117
-#define DB_ADD_ENUM 118
-#define DB_END_ENUM_LIST 119
-#define DB_ADD_TYPEDEF 120
-#define DB_FIND_SIGNAL 121
-#define DB_ADD_GEN_ITEM_BLOCK 122
-#define DB_FIND_GEN_ITEM 123
-#define DB_FIND_TYPEDEF 124
-#define DB_GET_CURR_GEN_BLOCK 125
-#define DB_CURR_SIGNAL_COUNT 126
-#define DB_CREATE_EXPRESSION 127
-#define DB_BIND_EXPR_TREE 128
-#define DB_CREATE_EXPR_FROM_STATIC 129
-#define DB_ADD_EXPRESSION 130
-#define DB_CREATE_SENSITIVITY_LIST 131
-#define DB_PARALLELIZE_STATEMENT 132
-#define DB_CREATE_STATEMENT 133
-#define DB_ADD_STATEMENT 134
-#define DB_REMOVE_STATEMENT_FROM_CURRENT_FUNIT 135
-#define DB_REMOVE_STATEMENT 136
-#define DB_CONNECT_STATEMENT_TRUE 137
-#define DB_CONNECT_STATEMENT_FALSE 138
-#define DB_GEN_ITEM_CONNECT_TRUE 139
-#define DB_GEN_ITEM_CONNECT_FALSE 140
-#define DB_GEN_ITEM_CONNECT 141
-#define DB_STATEMENT_CONNECT 142
-#define DB_CREATE_ATTR_PARAM 143
-#define DB_PARSE_ATTRIBUTE 144
-#define DB_REMOVE_STMT_BLKS_CALLING_STATEMENT 145
-#define DB_GEN_CURR_INST_SCOPE 146
-#define DB_SYNC_CURR_INSTANCE 147
-#define DB_SET_VCD_SCOPE 148
-#define DB_VCD_UPSCOPE 149
-#define DB_ASSIGN_SYMBOL 150
-#define DB_SET_SYMBOL_CHAR 151
-#define DB_SET_SYMBOL_STRING 152
-#define DB_DO_TIMESTEP 153
-#define DB_CHECK_DUMPFILE_SCOPES 154
-#define DB_VERILATOR_INITIALIZE 155
-#define DB_VERILATOR_CLOSE 156
-#define DB_ADD_LINE_COVERAGE 157
-#define ENUMERATE_ADD_ITEM 158
-#define ENUMERATE_END_LIST 159
-#define ENUMERATE_RESOLVE 160
-#define ENUMERATE_DEALLOC 161
-#define ENUMERATE_DEALLOC_LIST 162
-#define EXCLUDE_EXPR_ASSIGN_AND_RECALC 163
-#define EXCLUDE_SIG_ASSIGN_AND_RECALC 164
-#define EXCLUDE_ARC_ASSIGN_AND_RECALC 165
-#define EXCLUDE_ADD_EXCLUDE_REASON 166
-#define EXCLUDE_REMOVE_EXCLUDE_REASON 167
-#define EXCLUDE_IS_LINE_EXCLUDED 168
-#define EXCLUDE_SET_LINE_EXCLUDE 169
-#define EXCLUDE_IS_TOGGLE_EXCLUDED 170
-#define EXCLUDE_SET_TOGGLE_EXCLUDE 171
-#define EXCLUDE_IS_COMB_EXCLUDED 172
-#define EXCLUDE_SET_COMB_EXCLUDE 173
-#define EXCLUDE_IS_FSM_EXCLUDED 174
-#define EXCLUDE_SET_FSM_EXCLUDE 175
-#define EXCLUDE_IS_ASSERT_EXCLUDED 176
-#define EXCLUDE_SET_ASSERT_EXCLUDE 177
-#define EXCLUDE_FIND_EXCLUDE_REASON 178
-#define EXCLUDE_DB_WRITE 179
-#define EXCLUDE_DB_READ 180
-#define EXCLUDE_RESOLVE_REASON 181
-#define EXCLUDE_DB_MERGE 182
-#define EXCLUDE_MERGE 183
-#define EXCLUDE_FIND_SIGNAL 184
-#define EXCLUDE_FIND_EXPRESSION 185
-#define EXCLUDE_FIND_FSM_ARC 186
-#define EXCLUDE_FORMAT_REASON 187
-#define EXCLUDED_GET_MESSAGE 188
-#define EXCLUDE_HANDLE_EXCLUDE_REASON 189
-#define EXCLUDE_PRINT_EXCLUSION 190
-#define EXCLUDE_LINE_FROM_ID 191
-#define EXCLUDE_TOGGLE_FROM_ID 192
-#define EXCLUDE_MEMORY_FROM_ID 193
-#define EXCLUDE_EXPR_FROM_ID 194
-#define EXCLUDE_FSM_FROM_ID 195
-#define EXCLUDE_ASSERT_FROM_ID 196
-#define EXCLUDE_APPLY_EXCLUSIONS 197
-#define COMMAND_EXCLUDE 198
-#define EXPRESSION_CREATE_TMP_VECS 199
-#define EXPRESSION_CREATE_NBA 200
-#define EXPRESSION_IS_NBA_LHS 201
-#define EXPRESSION_CREATE_VALUE 202
-#define EXPRESSION_CREATE 203
-#define EXPRESSION_SET_VALUE 204
-#define EXPRESSION_SET_SIGNED 205
-#define EXPRESSION_RESIZE 206
-#define EXPRESSION_GET_ID 207
-#define EXPRESSION_GET_FIRST_LINE_EXPR 208
-#define EXPRESSION_GET_LAST_LINE_EXPR 209
-#define EXPRESSION_GET_CURR_DIMENSION 210
-#define EXPRESSION_FIND_RHS_SIGS 211
-#define EXPRESSION_FIND_PARAMS 212
-#define EXPRESSION_FIND_ULINE_ID 213
-#define EXPRESSION_FIND_EXPR 214
-#define EXPRESSION_CONTAINS_EXPR_CALLING_STMT 215
-#define EXPRESSION_GET_ROOT_STATEMENT 216
-#define EXPRESSION_ASSIGN_EXPR_IDS 217
-#define EXPRESSION_DB_WRITE 218
-#define EXPRESSION_DB_WRITE_TREE 219
-#define EXPRESSION_DB_READ 220
-#define EXPRESSION_DB_MERGE 221
-#define EXPRESSION_MERGE 222
-#define EXPRESSION_STRING_OP 223
-#define EXPRESSION_STRING 224
-#define EXPRESSION_OP_FUNC__XOR 225
-#define EXPRESSION_OP_FUNC__XOR_A 226
-#define EXPRESSION_OP_FUNC__MULTIPLY 227
-#define EXPRESSION_OP_FUNC__MULTIPLY_A 228
-#define EXPRESSION_OP_FUNC__DIVIDE 229
-#define EXPRESSION_OP_FUNC__DIVIDE_A 230
-#define EXPRESSION_OP_FUNC__MOD 231
-#define EXPRESSION_OP_FUNC__MOD_A 232
-#define EXPRESSION_OP_FUNC__ADD 233
-#define EXPRESSION_OP_FUNC__ADD_A 234
-#define EXPRESSION_OP_FUNC__SUBTRACT 235
-#define EXPRESSION_OP_FUNC__SUB_A 236
-#define EXPRESSION_OP_FUNC__AND 237
-#define EXPRESSION_OP_FUNC__AND_A 238
-#define EXPRESSION_OP_FUNC__OR 239
-#define EXPRESSION_OP_FUNC__OR_A 240
-#define EXPRESSION_OP_FUNC__NAND 241
-#define EXPRESSION_OP_FUNC__NOR 242
-#define EXPRESSION_OP_FUNC__NXOR 243
-#define EXPRESSION_OP_FUNC__LT 244
-#define EXPRESSION_OP_FUNC__GT 245
-#define EXPRESSION_OP_FUNC__LSHIFT 246
-#define EXPRESSION_OP_FUNC__LSHIFT_A 247
-#define EXPRESSION_OP_FUNC__RSHIFT 248
-#define EXPRESSION_OP_FUNC__RSHIFT_A 249
-#define EXPRESSION_OP_FUNC__ARSHIFT 250
-#define EXPRESSION_OP_FUNC__ARSHIFT_A 251
-#define EXPRESSION_OP_FUNC__TIME 252
-#define EXPRESSION_OP_FUNC__RANDOM 253
-#define EXPRESSION_OP_FUNC__SASSIGN 254
-#define EXPRESSION_OP_FUNC__SRANDOM 255
-#define EXPRESSION_OP_FUNC__URANDOM 256
-#define EXPRESSION_OP_FUNC__URANDOM_RANGE 257
-#define EXPRESSION_OP_FUNC__REALTOBITS 258
-#define EXPRESSION_OP_FUNC__BITSTOREAL 259
-#define EXPRESSION_OP_FUNC__SHORTREALTOBITS 260
-#define EXPRESSION_OP_FUNC__BITSTOSHORTREAL 261
-#define EXPRESSION_OP_FUNC__ITOR 262
-#define EXPRESSION_OP_FUNC__RTOI 263
-#define EXPRESSION_OP_FUNC__TEST_PLUSARGS 264
-#define EXPRESSION_OP_FUNC__VALUE_PLUSARGS 265
-#define EXPRESSION_OP_FUNC__SIGNED 266
-#define EXPRESSION_OP_FUNC__UNSIGNED 267
-#define EXPRESSION_OP_FUNC__CLOG2 268
-#define EXPRESSION_OP_FUNC__EQ 269
-#define EXPRESSION_OP_FUNC__CEQ 270
-#define EXPRESSION_OP_FUNC__LE 271
-#define EXPRESSION_OP_FUNC__GE 272
-#define EXPRESSION_OP_FUNC__NE 273
-#define EXPRESSION_OP_FUNC__CNE 274
-#define EXPRESSION_OP_FUNC__LOR 275
-#define EXPRESSION_OP_FUNC__LAND 276
-#define EXPRESSION_OP_FUNC__COND 277
-#define EXPRESSION_OP_FUNC__COND_SEL 278
-#define EXPRESSION_OP_FUNC__UINV 279
-#define EXPRESSION_OP_FUNC__UAND 280
-#define EXPRESSION_OP_FUNC__UNOT 281
-#define EXPRESSION_OP_FUNC__UOR 282
-#define EXPRESSION_OP_FUNC__UXOR 283
-#define EXPRESSION_OP_FUNC__UNAND 284
-#define EXPRESSION_OP_FUNC__UNOR 285
-#define EXPRESSION_OP_FUNC__UNXOR 286
-#define EXPRESSION_OP_FUNC__NULL 287
-#define EXPRESSION_OP_FUNC__SIG 288
-#define EXPRESSION_OP_FUNC__SBIT 289
-#define EXPRESSION_OP_FUNC__MBIT 290
-#define EXPRESSION_OP_FUNC__EXPAND 291
-#define EXPRESSION_OP_FUNC__LIST 292
-#define EXPRESSION_OP_FUNC__CONCAT 293
-#define EXPRESSION_OP_FUNC__PEDGE 294
-#define EXPRESSION_OP_FUNC__NEDGE 295
-#define EXPRESSION_OP_FUNC__AEDGE 296
-#define EXPRESSION_OP_FUNC__EOR 297
-#define EXPRESSION_OP_FUNC__SLIST 298
-#define EXPRESSION_OP_FUNC__DELAY 299
-#define EXPRESSION_OP_FUNC__TRIGGER 300
-#define EXPRESSION_OP_FUNC__CASE 301
-#define EXPRESSION_OP_FUNC__CASEX 302
-#define EXPRESSION_OP_FUNC__CASEZ 303
-#define EXPRESSION_OP_FUNC__DEFAULT 304
-#define EXPRESSION_OP_FUNC__BASSIGN 305
-#define EXPRESSION_OP_FUNC__FUNC_CALL 306
-#define EXPRESSION_OP_FUNC__TASK_CALL 307
-#define EXPRESSION_OP_FUNC__NB_CALL 308
-#define EXPRESSION_OP_FUNC__FORK 309
-#define EXPRESSION_OP_FUNC__JOIN 310
-#define EXPRESSION_OP_FUNC__DISABLE 311
-#define EXPRESSION_OP_FUNC__REPEAT 312
-#define EXPRESSION_OP_FUNC__EXPONENT 313
-#define EXPRESSION_OP_FUNC__PASSIGN 314
-#define EXPRESSION_OP_FUNC__MBIT_POS 315
-#define EXPRESSION_OP_FUNC__MBIT_NEG 316
-#define EXPRESSION_OP_FUNC__NEGATE 317
-#define EXPRESSION_OP_FUNC__IINC 318
-#define EXPRESSION_OP_FUNC__PINC 319
-#define EXPRESSION_OP_FUNC__IDEC 320
-#define EXPRESSION_OP_FUNC__PDEC 321
-#define EXPRESSION_OP_FUNC__DLY_ASSIGN 322
-#define EXPRESSION_OP_FUNC__DLY_OP 323
-#define EXPRESSION_OP_FUNC__REPEAT_DLY 324
-#define EXPRESSION_OP_FUNC__DIM 325
-#define EXPRESSION_OP_FUNC__WAIT 326
-#define EXPRESSION_OP_FUNC__FINISH 327
-#define EXPRESSION_OP_FUNC__STOP 328
-#define EXPRESSION_OPERATE 329
-#define EXPRESSION_OPERATE_RECURSIVELY 330
-#define EXPRESSION_SET_LINE_COVERAGE 331
-#define EXPRESSION_VCD_ASSIGN 332
-#define EXPRESSION_IS_STATIC_ONLY_HELPER 333
-#define EXPRESSION_IS_ASSIGNED 334
-#define EXPRESSION_IS_BIT_SELECT 335
-#define EXPRESSION_IS_LAST_SELECT 336
-#define EXPRESSION_GET_FIRST_SELECT 337
-#define EXPRESSION_IS_IN_RASSIGN 338
-#define EXPRESSION_SET_ASSIGNED 339
-#define EXPRESSION_SET_CHANGED 340
-#define EXPRESSION_ASSIGN 341
-#define EXPRESSION_DEALLOC 342
-#define FSM_CREATE 343
-#define FSM_ADD_ARC 344
-#define FSM_CREATE_TABLES 345
-#define FSM_DB_WRITE 346
-#define FSM_DB_READ 347
-#define FSM_DB_MERGE 348
-#define FSM_MERGE 349
-#define FSM_TABLE_SET 350
-#define FSM_VCD_ASSIGN 351
-#define FSM_GET_STATS 352
-#define FSM_GET_FUNIT_SUMMARY 353
-#define FSM_GET_INST_SUMMARY 354
-#define FSM_GATHER_SIGNALS 355
-#define FSM_COLLECT 356
-#define FSM_GET_COVERAGE 357
-#define FSM_DISPLAY_INSTANCE_SUMMARY 358
-#define FSM_INSTANCE_SUMMARY 359
-#define FSM_DISPLAY_FUNIT_SUMMARY 360
-#define FSM_FUNIT_SUMMARY 361
-#define FSM_DISPLAY_STATE_VERBOSE 362
-#define FSM_DISPLAY_ARC_VERBOSE 363
-#define FSM_DISPLAY_VERBOSE 364
-#define FSM_INSTANCE_VERBOSE 365
-#define FSM_FUNIT_VERBOSE 366
-#define FSM_REPORT 367
-#define FSM_DEALLOC 368
-#define FSM_ARG_PARSE_STATE 369
-#define FSM_ARG_PARSE 370
-#define FSM_ARG_PARSE_VALUE 371
-#define FSM_ARG_PARSE_TRANS 372
-#define FSM_ARG_PARSE_ATTR 373
-#define FSM_VAR_ADD 374
-#define FSM_VAR_IS_OUTPUT_STATE 375
-#define FSM_VAR_BIND_EXPR 376
-#define FSM_VAR_ADD_EXPR 377
-#define FSM_VAR_BIND_STMT 378
-#define FSM_VAR_BIND_ADD 379
-#define FSM_VAR_STMT_ADD 380
-#define FSM_VAR_BIND 381
-#define FSM_VAR_DEALLOC 382
-#define FSM_VAR_REMOVE 383
-#define FSM_VAR_CLEANUP 384
-#define FST_READER_PROCESS_HIER 385
-#define FST_CALLBACK 386
-#define FST_PARSE 387
-#define FUNC_ITER_DISPLAY 388
-#define FUNC_ITER_SORT 389
-#define FUNC_ITER_COUNT_STMT_ITERS 390
-#define FUNC_ITER_ADD_STMT_ITERS 391
-#define FUNC_ITER_ADD_SIG_LINKS 392
-#define FUNC_ITER_INIT 393
-#define FUNC_ITER_GET_NEXT_STATEMENT 394
-#define FUNC_ITER_GET_NEXT_SIGNAL 395
-#define FUNC_ITER_DEALLOC 396
-#define FUNIT_INIT 397
-#define FUNIT_CREATE 398
-#define FUNIT_GET_CURR_MODULE 399
-#define FUNIT_GET_CURR_MODULE_SAFE 400
-#define FUNIT_GET_CURR_FUNCTION 401
-#define FUNIT_GET_CURR_TASK 402
-#define FUNIT_GET_PORT_COUNT 403
-#define FUNIT_FIND_PARAM 404
-#define FUNIT_FIND_SIGNAL 405
-#define FUNIT_REMOVE_STMT_BLKS_CALLING_STMT 406
-#define FUNIT_GEN_TASK_FUNCTION_NAMEDBLOCK_NAME 407
-#define FUNIT_SIZE_ELEMENTS 408
-#define FUNIT_DB_WRITE 409
-#define FUNIT_DB_READ 410
-#define FUNIT_VERSION_DB_READ 411
-#define FUNIT_DB_MERGE 412
-#define FUNIT_MERGE 413
-#define FUNIT_FLATTEN_NAME 414
-#define FUNIT_FIND_BY_ID 415
-#define FUNIT_IS_TOP_MODULE 416
-#define FUNIT_IS_UNNAMED 417
-#define FUNIT_IS_UNNAMED_CHILD_OF 418
-#define FUNIT_IS_CHILD_OF 419
-#define FUNIT_DISPLAY_SIGNALS 420
-#define FUNIT_DISPLAY_EXPRESSIONS 421
-#define STATEMENT_ADD_THREAD 422
-#define FUNIT_PUSH_THREADS 423
-#define STATEMENT_DELETE_THREAD 424
-#define FUNIT_OUTPUT_DUMPVARS 425
-#define FUNIT_IS_ONE_SIGNAL_ASSIGNED 426
-#define FUNIT_CLEAN 427
-#define FUNIT_DEALLOC 428
-#define GEN_ITEM_STRINGIFY 429
-#define GEN_ITEM_DISPLAY 430
-#define GEN_ITEM_DISPLAY_BLOCK_HELPER 431
-#define GEN_ITEM_DISPLAY_BLOCK 432
-#define GEN_ITEM_COMPARE 433
-#define GEN_ITEM_FIND 434
-#define GEN_ITEM_REMOVE_IF_CONTAINS_EXPR_CALLING_STMT 435
-#define GEN_ITEM_GET_GENVAR 436
-#define GEN_ITEM_VARNAME_CONTAINS_GENVAR 437
-#define GEN_ITEM_CALC_SIGNAL_NAME 438
-#define GEN_ITEM_CREATE_EXPR 439
-#define GEN_ITEM_CREATE_SIG 440
-#define GEN_ITEM_CREATE_STMT 441
-#define GEN_ITEM_CREATE_INST 442
-#define GEN_ITEM_CREATE_TFN 443
-#define GEN_ITEM_CREATE_BIND 444
-#define GEN_ITEM_RESIZE_STMTS_AND_SIGS 445
-#define GEN_ITEM_ASSIGN_IDS 446
-#define GEN_ITEM_DB_WRITE 447
-#define GEN_ITEM_DB_WRITE_EXPR_TREE 448
-#define GEN_ITEM_CONNECT 449
-#define GEN_ITEM_RESOLVE 450
-#define GEN_ITEM_BIND 451
-#define GENERATE_RESOLVE_INST 452
-#define GENERATE_REMOVE_STMT_HELPER 453
-#define GENERATE_REMOVE_STMT 454
-#define GENERATE_FIND_STMT_BY_POSITION_HELPER 455
-#define GENERATE_FIND_STMT_BY_POSITION 456
-#define GENERATE_FIND_TFN_BY_POSITION_HELPER 457
-#define GENERATE_FIND_TFN_BY_POSITION 458
-#define GEN_ITEM_DEALLOC 459
-#define GENERATOR_GET_RELATIVE_SCOPE 460
-#define GENERATOR_CLEAR_REPLACE_PTRS 461
-#define GENERATOR_IS_STATIC_FUNCTION_ONLY 462
-#define GENERATOR_IS_STATIC_FUNCTION 463
-#define GENERATOR_REPLACE 464
-#define GENERATOR_PUSH_REG_INSERT 465
-#define GENERATOR_POP_REG_INSERT 466
-#define GENERATOR_IS_BASE_REG_INSERT 467
-#define GENERATOR_INSERT_REG 468
-#define GENERATOR_PUSH_FUNIT 469
-#define GENERATOR_POP_FUNIT 470
-#define GENERATOR_EXPR_NEEDS_TO_BE_SUBSTITUTED 471
-#define GENERATOR_EXPR_COV_NEEDED 472
-#define GENERATOR_CLEAR_COMB_CNTD 473
-#define GENERATOR_CREATE_EXPR_NAME 474
-#define GENERATOR_SORT_FUNIT_BY_FILENAME 475
-#define GENERATOR_SET_NEXT_FUNIT 476
-#define GENERATOR_DEALLOC_FNAME_LIST 477
-#define GENERATOR_OUTPUT_FUNIT 478
-#define GENERATOR_WRITE_VERILATOR_INST_IDS 479
-#define GENERATOR_OUTPUT 480
-#define GENERATOR_INIT_FUNIT 481
-#define GENERATOR_PREPEND_TO_WORK_CODE 482
-#define GENERATOR_ADD_TO_WORK_CODE 483
-#define GENERATOR_FLUSH_WORK_CODE1 484
-#define GENERATOR_ADD_TO_HOLD_CODE 485
-#define GENERATOR_FLUSH_HOLD_CODE1 486
-#define GENERATOR_FLUSH_ALL1 487
-#define GENERATOR_FIND_STATEMENT 488
-#define GENERATOR_FIND_CASE_STATEMENT 489
-#define GENERATOR_INSERT_LINE_COV_WITH_STMT 490
-#define GENERATOR_INSERT_LINE_COV 491
-#define GENERATOR_INSERT_EVENT_COMB_COV 492
-#define GENERATOR_INSERT_UNARY_COMB_COV 493
-#define GENERATOR_INSERT_AND_COMB_COV 494
-#define GENERATOR_MBIT_GEN_VALUE 495
-#define GENERATOR_IS_RHS_OF_ASSIGNMENT 496
-#define GENERATOR_GEN_SIZE 497
-#define GENERATOR_CREATE_LHS 498
-#define GENERATOR_INSERT_SUBEXP 499
-#define GENERATOR_COMB_COV_HELPER2 500
-#define GENERATOR_INSERT_COMB_COV_HELPER 501
-#define GENERATOR_GEN_MEM_INDEX_HELPER 502
-#define GENERATOR_GEN_MEM_INDEX 503
-#define GENERATOR_GEN_MEM_SIZE 504
-#define GENERATOR_GET_LHS_LSB_HELPER 505
-#define GENERATOR_GET_LHS_LSB 506
-#define GENERATOR_MEM_COV 507
-#define GENERATOR_MEM_COV_HELPER 508
-#define GENERATOR_COMB_COV 509
-#define GENERATOR_INSERT_COMB_COV_FROM_STMT_STACK 510
-#define GENERATOR_INSERT_COMB_COV_WITH_STMT 511
-#define GENERATOR_INSERT_CASE_COMB_COV 512
-#define GENERATOR_FSM_COVS 513
-#define GENERATOR_HANDLE_EVENT_TYPE 514
-#define GENERATOR_HANDLE_EVENT_TRIGGER 515
-#define GENERATOR_HOLD_LAST_TOKEN 516
-#define GENERATOR_FLUSH_HELD_TOKEN 517
-#define GENERATOR_INST_ID_PARAM 518
-#define GENERATOR_INST_ID_OVERRIDES_HELPER 519
-#define GENERATOR_INST_ID_OVERRIDES 520
-#define GENERATOR_BEGIN_PARALLEL_STATEMENT 521
-#define GENERATOR_END_PARALLEL_STATEMENT 522
-#define GENERATOR_BUILD 523
-#define GENERATOR_BUILD2 524
-#define GENERATOR_DESTROY2 525
-#define GENERATOR_TMP_REGS 526
-#define GENERATOR_CREATE_TMP_REGS 527
-#define GENERROR 528
-#define GENERATOR_WRITE_TO_FILE 529
-#define SCORE_ADD_ARGS 530
-#define INFO_SET_VECTOR_ELEM_SIZE 531
-#define INFO_SET_SCORED 532
-#define INFO_DB_WRITE 533
-#define INFO_DB_READ 534
-#define ARGS_DB_READ 535
-#define MESSAGE_DB_READ 536
-#define MERGED_CDD_DB_READ 537
-#define INFO_DEALLOC 538
-#define INSTANCE_DISPLAY_TREE_HELPER 539
-#define INSTANCE_DISPLAY_TREE 540
-#define INSTANCE_CREATE 541
-#define INSTANCE_ASSIGN_IDS 542
-#define INSTANCE_GEN_SCOPE 543
-#define INSTANCE_GEN_VERILATOR_SCOPE 544
-#define INSTANCE_COMPARE 545
-#define INSTANCE_FIND_SCOPE 546
-#define INSTANCE_FIND_BY_FUNIT 547
-#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE_HELPER 548
-#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE 549
-#define INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID 550
-#define INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID 551
-#define INSTANCE_FIND_FSM_ARC_INDEX_BY_EXCLUSION_ID 552
-#define INSTANCE_ADD_CHILD 553
-#define INSTANCE_COPY_HELPER 554
-#define INSTANCE_COPY 555
-#define INSTANCE_PARSE_ADD 556
-#define INSTANCE_RESOLVE_INST 557
-#define INSTANCE_RESOLVE_HELPER 558
-#define INSTANCE_RESOLVE 559
-#define INSTANCE_READ_ADD 560
-#define INSTANCE_MERGE 561
-#define INSTANCE_GET_LEADING_HIERARCHY 562
-#define INSTANCE_GET_VERILATOR_LEADING_HIERARCHY 563
-#define INSTANCE_MARK_LHIER_DIFFS 564
-#define INSTANCE_MERGE_TWO_TREES 565
-#define INSTANCE_DB_WRITE 566
-#define INSTANCE_ONLY_DB_READ 567
-#define INSTANCE_ONLY_DB_MERGE 568
-#define INSTANCE_REMOVE_STMT_BLKS_CALLING_STMT 569
-#define INSTANCE_REMOVE_PARMS_WITH_EXPR 570
-#define INSTANCE_DEALLOC_SINGLE 571
-#define INSTANCE_OUTPUT_DUMPVARS 572
-#define INSTANCE_DEALLOC_TREE 573
-#define INSTANCE_DEALLOC 574
-#define LINE_GET_STATS 575
-#define LINE_COLLECT 576
-#define LINE_GET_FUNIT_SUMMARY 577
-#define LINE_GET_INST_SUMMARY 578
-#define LINE_DISPLAY_INSTANCE_SUMMARY 579
-#define LINE_INSTANCE_SUMMARY 580
-#define LINE_DISPLAY_FUNIT_SUMMARY 581
-#define LINE_FUNIT_SUMMARY 582
-#define LINE_DISPLAY_VERBOSE 583
-#define LINE_INSTANCE_VERBOSE 584
-#define LINE_FUNIT_VERBOSE 585
-#define LINE_REPORT 586
-#define STR_LINK_ADD 587
-#define STMT_LINK_ADD_HEAD 588
-#define EXP_LINK_ADD 589
-#define SIG_LINK_ADD 590
-#define FSM_LINK_ADD 591
-#define FUNIT_LINK_ADD 592
-#define GITEM_LINK_ADD 593
-#define INST_LINK_ADD 594
-#define STR_LINK_FIND 595
-#define STMT_LINK_FIND 596
-#define STMT_LINK_FIND_BY_POSITION 597
-#define EXP_LINK_FIND 598
-#define SIG_LINK_FIND 599
-#define FSM_LINK_FIND 600
-#define FUNIT_LINK_FIND 601
-#define GITEM_LINK_FIND 602
-#define INST_LINK_FIND_BY_SCOPE 603
-#define INST_LINK_FIND_BY_FUNIT 604
-#define STR_LINK_REMOVE 605
-#define EXP_LINK_REMOVE 606
-#define GITEM_LINK_REMOVE 607
-#define FUNIT_LINK_REMOVE 608
-#define STR_LINK_DELETE_LIST 609
-#define STMT_LINK_UNLINK 610
-#define STMT_LINK_DELETE_LIST 611
-#define EXP_LINK_DELETE_LIST 612
-#define SIG_LINK_DELETE_LIST 613
-#define FSM_LINK_DELETE_LIST 614
-#define FUNIT_LINK_DELETE_LIST 615
-#define GITEM_LINK_DELETE_LIST 616
-#define INST_LINK_DELETE_LIST 617
-#define VCDID 618
-#define VCD_CALLBACK 619
-#define LXT_PARSE 620
-#define LXT2_RD_EXPAND_INTEGER_TO_BITS 621
-#define LXT2_RD_EXPAND_BITS_TO_INTEGER 622
-#define LXT2_RD_ITER_RADIX 623
-#define LXT2_RD_ITER_RADIX0 624
-#define LXT2_RD_BUILD_RADIX 625
-#define LXT2_RD_REGENERATE_PROCESS_MASK 626
-#define LXT2_RD_PROCESS_BLOCK 627
-#define LXT2_RD_INIT 628
-#define LXT2_RD_CLOSE 629
-#define LXT2_RD_GET_FACNAME 630
-#define LXT2_RD_ITER_BLOCKS 631
-#define LXT2_RD_LIMIT_TIME_RANGE 632
-#define LXT2_RD_UNLIMIT_TIME_RANGE 633
-#define MEMORY_GET_STAT 634
-#define MEMORY_GET_STATS 635
-#define MEMORY_GET_FUNIT_SUMMARY 636
-#define MEMORY_GET_INST_SUMMARY 637
-#define MEMORY_CREATE_PDIM_BIT_ARRAY 638
-#define MEMORY_GET_MEM_COVERAGE 639
-#define MEMORY_GET_COVERAGE 640
-#define MEMORY_COLLECT 641
-#define MEMORY_DISPLAY_TOGGLE_INSTANCE_SUMMARY 642
-#define MEMORY_TOGGLE_INSTANCE_SUMMARY 643
-#define MEMORY_DISPLAY_AE_INSTANCE_SUMMARY 644
-#define MEMORY_AE_INSTANCE_SUMMARY 645
-#define MEMORY_DISPLAY_TOGGLE_FUNIT_SUMMARY 646
-#define MEMORY_TOGGLE_FUNIT_SUMMARY 647
-#define MEMORY_DISPLAY_AE_FUNIT_SUMMARY 648
-#define MEMORY_AE_FUNIT_SUMMARY 649
-#define MEMORY_DISPLAY_MEMORY 650
-#define MEMORY_DISPLAY_VERBOSE 651
-#define MEMORY_INSTANCE_VERBOSE 652
-#define MEMORY_FUNIT_VERBOSE 653
-#define MEMORY_REPORT 654
-#define MERGE_CHECK 655
-#define COMMAND_MERGE 656
-#define OBFUSCATE_SET_MODE 657
-#define OBFUSCATE_NAME 658
-#define OBFUSCATE_DEALLOC 659
-#define OVL_IS_ASSERTION_NAME 660
-#define OVL_IS_ASSERTION_MODULE 661
-#define OVL_IS_COVERAGE_POINT 662
-#define OVL_ADD_ASSERTIONS_TO_NO_SCORE_LIST 663
-#define OVL_GET_FUNIT_STATS 664
-#define OVL_GET_COVERAGE_POINT 665
-#define OVL_DISPLAY_VERBOSE 666
-#define OVL_COLLECT 667
-#define OVL_GET_COVERAGE 668
-#define MOD_PARM_FIND 669
-#define MOD_PARM_FIND_EXPR_AND_REMOVE 670
-#define MOD_PARM_GEN_SIZE_CODE 671
-#define MOD_PARM_GEN_LSB_CODE 672
-#define MOD_PARM_ADD 673
-#define INST_PARM_FIND 674
-#define INST_PARM_ADD 675
-#define INST_PARM_ADD_GENVAR 676
-#define INST_PARM_BIND 677
-#define DEFPARAM_ADD 678
-#define DEFPARAM_DEALLOC 679
-#define PARAM_FIND_AND_SET_EXPR_VALUE 680
-#define PARAM_SET_SIG_SIZE 681
-#define PARAM_SIZE_FUNCTION 682
-#define PARAM_EXPR_EVAL 683
-#define PARAM_HAS_OVERRIDE 684
-#define PARAM_HAS_DEFPARAM 685
-#define PARAM_RESOLVE_DECLARED 686
-#define PARAM_RESOLVE_OVERRIDE 687
-#define PARAM_RESOLVE_INST 688
-#define PARAM_RESOLVE 689
-#define PARAM_DB_WRITE 690
-#define MOD_PARM_DEALLOC 691
-#define INST_PARM_DEALLOC 692
-#define PARSE_READLINE 693
-#define PARSE_DESIGN 694
-#define PARSE_AND_SCORE_DUMPFILE 695
-#define PARSER_STATIC_EXPR_PRIMARY_A 696
-#define PARSER_STATIC_EXPR_PRIMARY_B 697
-#define PARSER_EXPRESSION_LIST_A 698
-#define PARSER_EXPRESSION_LIST_B 699
-#define PARSER_EXPRESSION_LIST_C 700
-#define PARSER_EXPRESSION_LIST_D 701
-#define PARSER_IDENTIFIER_A 702
-#define PARSER_GENERATE_CASE_ITEM_A 703
-#define PARSER_GENERATE_CASE_ITEM_B 704
-#define PARSER_GENERATE_CASE_ITEM_C 705
-#define PARSER_STATEMENT_BEGIN_A 706
-#define PARSER_STATEMENT_FORK_A 707
-#define PARSER_STATEMENT_FOR_A 708
-#define PARSER_CASE_ITEM_A 709
-#define PARSER_CASE_ITEM_B 710
-#define PARSER_CASE_ITEM_C 711
-#define PARSER_DELAY_VALUE_A 712
-#define PARSER_DELAY_VALUE_B 713
-#define PARSER_PARAMETER_VALUE_BYNAME_A 714
-#define PARSER_GATE_INSTANCE_A 715
-#define PARSER_GATE_INSTANCE_B 716
-#define PARSER_GATE_INSTANCE_C 717
-#define PARSER_GATE_INSTANCE_D 718
-#define PARSER_LIST_OF_NAMES_A 719
-#define PARSER_LIST_OF_NAMES_B 720
-#define PARSER_CHECK_PSTAR 721
-#define PARSER_CHECK_ATTRIBUTE 722
-#define PARSER_CREATE_ATTR_LIST 723
-#define PARSER_CREATE_ATTR 724
-#define PARSER_CREATE_TASK_DECL 725
-#define PARSER_CREATE_TASK_BODY 726
-#define PARSER_CREATE_FUNCTION_DECL 727
-#define PARSER_CREATE_FUNCTION_BODY 728
-#define PARSER_END_TASK_FUNCTION 729
-#define PARSER_CREATE_PORT 730
-#define PARSER_HANDLE_INLINE_PORT_ERROR 731
-#define PARSER_CREATE_SIMPLE_NUMBER 732
-#define PARSER_CREATE_COMPLEX_NUMBER 733
-#define PARSER_APPEND_SE_PORT_LIST 734
-#define PARSER_CREATE_SE_PORT_LIST 735
-#define PARSER_CREATE_UNARY_SE 736
-#define PARSER_CREATE_SYSCALL_SE 737
-#define PARSER_CREATE_UNARY_EXP 738
-#define PARSER_CREATE_BINARY_EXP 739
-#define PARSER_CREATE_OP_AND_ASSIGN_EXP 740
-#define PARSER_CREATE_SYSCALL_EXP 741
-#define PARSER_CREATE_SYSCALL_W_PARAMS_EXP 742
-#define PARSER_CREATE_OP_AND_ASSIGN_W_DIM_EXP 743
-#define PARSER_HANDLE_CASE_STATEMENT 744
-#define PARSER_HANDLE_CASE_STATEMENT_LIST 745
-#define PARSER_HANDLE_GENERATE_CASE_STATEMENT 746
-#define PARSER_HANDLE_GENERATE_CASE_STATEMENT_LIST 747
-#define VLERROR 748
-#define VLWARN 749
-#define PARSER_DEALLOC_SIG_RANGE 750
-#define PARSER_COPY_CURR_RANGE 751
-#define PARSER_COPY_RANGE_TO_CURR_RANGE 752
-#define PARSER_EXPLICITLY_SET_CURR_RANGE 753
-#define PARSER_IMPLICITLY_SET_CURR_RANGE 754
-#define PARSER_CHECK_GENERATION 755
-#define PERF_GEN_STATS 756
-#define PERF_OUTPUT_MOD_STATS 757
-#define PERF_OUTPUT_INST_REPORT_HELPER 758
-#define PERF_OUTPUT_INST_REPORT 759
-#define DEF_LOOKUP 760
-#define IS_DEFINED 761
-#define DEF_MATCH 762
-#define DEF_START 763
-#define DEFINE_MACRO 764
-#define DO_DEFINE 765
-#define DEF_IS_DONE 766
-#define DEF_FINISH 767
-#define DEF_UNDEFINE 768
-#define INCLUDE_FILENAME 769
-#define DO_INCLUDE 770
-#define YYWRAP 771
-#define RESET_PPLEXER 772
-#define RACE_BLK_CREATE 773
-#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT_HELPER 774
-#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT 775
-#define RACE_GET_HEAD_STATEMENT 776
-#define RACE_FIND_HEAD_STATEMENT 777
-#define RACE_CALC_STMT_BLK_TYPE 778
-#define RACE_CALC_EXPR_ASSIGNMENT 779
-#define RACE_CALC_ASSIGNMENTS 780
-#define RACE_HANDLE_RACE_CONDITION 781
-#define RACE_CHECK_ASSIGNMENT_TYPES 782
-#define RACE_CHECK_ONE_BLOCK_ASSIGNMENT 783
-#define RACE_CHECK_RACE_COUNT 784
-#define RACE_CHECK_MODULES 785
-#define RACE_DB_WRITE 786
-#define RACE_DB_READ 787
-#define RACE_GET_STATS 788
-#define RACE_REPORT_SUMMARY 789
-#define RACE_REPORT_VERBOSE 790
-#define RACE_REPORT 791
-#define RACE_COLLECT_LINES 792
-#define RACE_BLK_DELETE_LIST 793
-#define RANK_CREATE_COMP_CDD_COV 794
-#define RANK_DEALLOC_COMP_CDD_COV 795
-#define RANK_CHECK_INDEX 796
-#define RANK_GATHER_SIGNAL_COV 797
-#define RANK_GATHER_COMB_COV 798
-#define RANK_GATHER_EXPRESSION_COV 799
-#define RANK_GATHER_FSM_COV 800
-#define RANK_CALC_NUM_CPS 801
-#define RANK_GATHER_COMP_CDD_COV 802
-#define RANK_READ_CDD 803
-#define RANK_SELECTED_CDD_COV 804
-#define RANK_PERFORM_WEIGHTED_SELECTION 805
-#define RANK_PERFORM_GREEDY_SORT 806
-#define RANK_COUNT_CPS 807
-#define RANK_PERFORM 808
-#define RANK_OUTPUT 809
-#define COMMAND_RANK 810
-#define REENTRANT_COUNT_AFU_BITS 811
-#define REENTRANT_STORE_DATA_BITS 812
-#define REENTRANT_RESTORE_DATA_BITS 813
-#define REENTRANT_CREATE 814
-#define REENTRANT_DEALLOC 815
-#define REPORT_PARSE_METRICS 816
-#define REPORT_PARSE_ARGS 817
-#define REPORT_GATHER_INSTANCE_STATS 818
-#define REPORT_GATHER_FUNIT_STATS 819
-#define REPORT_PRINT_HEADER 820
-#define REPORT_GENERATE 821
-#define REPORT_READ_CDD_AND_READY 822
-#define REPORT_CLOSE_CDD 823
-#define REPORT_SAVE_CDD 824
-#define REPORT_FORMAT_EXCLUSION_REASON 825
-#define REPORT_OUTPUT_EXCLUSION_REASON 826
-#define COMMAND_REPORT 827
-#define SCOPE_FIND_FUNIT_FROM_SCOPE 828
-#define SCOPE_FIND_PARAM 829
-#define SCOPE_FIND_SIGNAL 830
-#define SCOPE_FIND_TASK_FUNCTION_NAMEDBLOCK 831
-#define SCOPE_GET_PARENT_FUNIT 832
-#define SCOPE_GET_PARENT_MODULE 833
-#define SCORE_GENERATE_TOP_VPI_MODULE 834
-#define SCORE_GENERATE_TOP_DUMPVARS_MODULE 835
-#define SCORE_GENERATE_PLI_TAB_FILE 836
-#define SCORE_PARSE_DEFINE 837
-#define SCORE_PARSE_METRICS 838
-#define SCORE_PARSE_ARGS 839
-#define COMMAND_SCORE 840
-#define SEARCH_INIT 841
-#define SEARCH_ADD_INCLUDE_PATH 842
-#define SEARCH_ADD_DIRECTORY_PATH 843
-#define SEARCH_ADD_FILE 844
-#define SEARCH_ADD_NO_SCORE_FUNIT 845
-#define SEARCH_ADD_EXTENSIONS 846
-#define SEARCH_FREE_LISTS 847
-#define SIM_CURRENT_THREAD 848
-#define SIM_THREAD_POP_HEAD 849
-#define SIM_THREAD_INSERT_INTO_DELAY_QUEUE 850
-#define SIM_THREAD_PUSH 851
-#define SIM_EXPR_CHANGED 852
-#define SIM_CREATE_THREAD 853
-#define SIM_ADD_THREAD 854
-#define SIM_KILL_THREAD 855
-#define SIM_KILL_THREAD_WITH_FUNIT 856
-#define SIM_ADD_STATICS 857
-#define SIM_EXPRESSION 858
-#define SIM_THREAD 859
-#define SIM_SIMULATE 860
-#define SIM_INITIALIZE 861
-#define SIM_STOP 862
-#define SIM_FINISH 863
-#define SIM_ADD_NONBLOCK_ASSIGN 864
-#define SIM_PERFORM_NBA 865
-#define SIM_DEALLOC 866
-#define STATISTIC_CREATE 867
-#define STATISTIC_IS_EMPTY 868
-#define STATISTIC_DEALLOC 869
-#define STATEMENT_CREATE 870
-#define STATEMENT_QUEUE_ADD 871
-#define STATEMENT_QUEUE_COMPARE 872
-#define STATEMENT_SIZE_ELEMENTS 873
-#define STATEMENT_DB_WRITE 874
-#define STATEMENT_DB_WRITE_TREE 875
-#define STATEMENT_DB_WRITE_EXPR_TREE 876
-#define STATEMENT_DB_READ 877
-#define STATEMENT_ASSIGN_EXPR_IDS 878
-#define STATEMENT_CONNECT 879
-#define STATEMENT_GET_LAST_LINE_HELPER 880
-#define STATEMENT_GET_LAST_LINE 881
-#define STATEMENT_FIND_RHS_SIGS 882
-#define STATEMENT_FIND_STATEMENT 883
-#define STATEMENT_FIND_STATEMENT_BY_POSITION 884
-#define STATEMENT_CONTAINS_EXPR_CALLING_STMT 885
-#define STATEMENT_ADD_TO_STMT_LINK 886
-#define STATEMENT_DEALLOC_RECURSIVE 887
-#define STATEMENT_DEALLOC 888
-#define STATIC_EXPR_GEN_UNARY 889
-#define STATIC_EXPR_GEN 890
-#define STATIC_EXPR_GEN_TERNARY 891
-#define STATIC_EXPR_CALC_LSB_AND_WIDTH_PRE 892
-#define STATIC_EXPR_CALC_LSB_AND_WIDTH_POST 893
-#define STATIC_EXPR_DEALLOC 894
-#define STMT_BLK_ADD_TO_REMOVE_LIST 895
-#define STMT_BLK_REMOVE 896
-#define STMT_BLK_SPECIFY_REMOVAL_REASON 897
-#define STRUCT_UNION_LENGTH 898
-#define STRUCT_UNION_ADD_MEMBER 899
-#define STRUCT_UNION_ADD_MEMBER_VOID 900
-#define STRUCT_UNION_ADD_MEMBER_SIG 901
-#define STRUCT_UNION_ADD_MEMBER_TYPEDEF 902
-#define STRUCT_UNION_ADD_MEMBER_ENUM 903
-#define STRUCT_UNION_ADD_MEMBER_STRUCT_UNION 904
-#define STRUCT_UNION_CREATE 905
-#define STRUCT_UNION_MEMBER_DEALLOC 906
-#define STRUCT_UNION_DEALLOC 907
-#define STRUCT_UNION_DEALLOC_LIST 908
-#define SYMTABLE_ADD_SYM_SIG 909
-#define SYMTABLE_ADD_SYM_EXP 910
-#define SYMTABLE_ADD_SYM_FSM 911
-#define SYMTABLE_INIT 912
-#define SYMTABLE_CREATE 913
-#define SYMTABLE_GET_TABLE 914
-#define SYMTABLE_ADD_SIGNAL 915
-#define SYMTABLE_ADD_EXPRESSION 916
-#define SYMTABLE_ADD_MEMORY 917
-#define SYMTABLE_ADD_FSM 918
-#define SYMTABLE_SET_VALUE 919
-#define SYMTABLE_ASSIGN 920
-#define SYMTABLE_DEALLOC 921
-#define SYS_TASK_UNIFORM 922
-#define SYS_TASK_RTL_DIST_UNIFORM 923
-#define SYS_TASK_SRANDOM 924
-#define SYS_TASK_RANDOM 925
-#define SYS_TASK_URANDOM 926
-#define SYS_TASK_URANDOM_RANGE 927
-#define SYS_TASK_REALTOBITS 928
-#define SYS_TASK_BITSTOREAL 929
-#define SYS_TASK_SHORTREALTOBITS 930
-#define SYS_TASK_BITSTOSHORTREAL 931
-#define SYS_TASK_ITOR 932
-#define SYS_TASK_RTOI 933
-#define SYS_TASK_STORE_PLUSARGS 934
-#define SYS_TASK_TEST_PLUSARG 935
-#define SYS_TASK_VALUE_PLUSARGS 936
-#define SYS_TASK_DEALLOC 937
-#define TCL_FUNC_GET_RACE_REASON_MSGS 938
-#define TCL_FUNC_GET_FUNIT_LIST 939
-#define TCL_FUNC_GET_INSTANCES 940
-#define TCL_FUNC_GET_INSTANCE_LIST 941
-#define TCL_FUNC_IS_FUNIT 942
-#define TCL_FUNC_GET_FUNIT 943
-#define TCL_FUNC_GET_INST 944
-#define TCL_FUNC_GET_FUNIT_NAME 945
-#define TCL_FUNC_GET_FILENAME 946
-#define TCL_FUNC_INST_SCOPE 947
-#define TCL_FUNC_GET_FUNIT_START_AND_END 948
-#define TCL_FUNC_COLLECT_UNCOVERED_LINES 949
-#define TCL_FUNC_COLLECT_COVERED_LINES 950
-#define TCL_FUNC_COLLECT_RACE_LINES 951
-#define TCL_FUNC_COLLECT_UNCOVERED_TOGGLES 952
-#define TCL_FUNC_COLLECT_COVERED_TOGGLES 953
-#define TCL_FUNC_COLLECT_UNCOVERED_MEMORIES 954
-#define TCL_FUNC_COLLECT_COVERED_MEMORIES 955
-#define TCL_FUNC_GET_TOGGLE_COVERAGE 956
-#define TCL_FUNC_GET_MEMORY_COVERAGE 957
-#define TCL_FUNC_COLLECT_UNCOVERED_COMBS 958
-#define TCL_FUNC_COLLECT_COVERED_COMBS 959
-#define TCL_FUNC_GET_COMB_EXPRESSION 960
-#define TCL_FUNC_GET_COMB_COVERAGE 961
-#define TCL_FUNC_COLLECT_UNCOVERED_FSMS 962
-#define TCL_FUNC_COLLECT_COVERED_FSMS 963
-#define TCL_FUNC_GET_FSM_COVERAGE 964
-#define TCL_FUNC_COLLECT_UNCOVERED_ASSERTIONS 965
-#define TCL_FUNC_COLLECT_COVERED_ASSERTIONS 966
-#define TCL_FUNC_GET_ASSERT_COVERAGE 967
-#define TCL_FUNC_OPEN_CDD 968
-#define TCL_FUNC_CLOSE_CDD 969
-#define TCL_FUNC_SAVE_CDD 970
-#define TCL_FUNC_MERGE_CDD 971
-#define TCL_FUNC_GET_LINE_SUMMARY 972
-#define TCL_FUNC_GET_TOGGLE_SUMMARY 973
-#define TCL_FUNC_GET_MEMORY_SUMMARY 974
-#define TCL_FUNC_GET_COMB_SUMMARY 975
-#define TCL_FUNC_GET_FSM_SUMMARY 976
-#define TCL_FUNC_GET_ASSERT_SUMMARY 977
-#define TCL_FUNC_PREPROCESS_VERILOG 978
-#define TCL_FUNC_GET_SCORE_PATH 979
-#define TCL_FUNC_GET_INCLUDE_PATHNAME 980
-#define TCL_FUNC_GET_GENERATION 981
-#define TCL_FUNC_SET_LINE_EXCLUDE 982
-#define TCL_FUNC_SET_TOGGLE_EXCLUDE 983
-#define TCL_FUNC_SET_MEMORY_EXCLUDE 984
-#define TCL_FUNC_SET_COMB_EXCLUDE 985
-#define TCL_FUNC_FSM_EXCLUDE 986
-#define TCL_FUNC_SET_ASSERT_EXCLUDE 987
-#define TCL_FUNC_GENERATE_REPORT 988
-#define TCL_FUNC_INITIALIZE 989
-#define TOGGLE_GET_STATS 990
-#define TOGGLE_COLLECT 991
-#define TOGGLE_GET_COVERAGE 992
-#define TOGGLE_GET_FUNIT_SUMMARY 993
-#define TOGGLE_GET_INST_SUMMARY 994
-#define TOGGLE_DISPLAY_INSTANCE_SUMMARY 995
-#define TOGGLE_INSTANCE_SUMMARY 996
-#define TOGGLE_DISPLAY_FUNIT_SUMMARY 997
-#define TOGGLE_FUNIT_SUMMARY 998
-#define TOGGLE_DISPLAY_VERBOSE 999
-#define TOGGLE_INSTANCE_VERBOSE 1000
-#define TOGGLE_FUNIT_VERBOSE 1001
-#define TOGGLE_REPORT 1002
-#define TREE_ADD 1003
-#define TREE_FIND 1004
-#define TREE_REMOVE 1005
-#define TREE_DEALLOC 1006
-#define CHECK_OPTION_VALUE 1007
-#define IS_VARIABLE 1008
-#define IS_FUNC_UNIT 1009
-#define IS_LEGAL_FILENAME 1010
-#define GET_BASENAME 1011
-#define GET_DIRNAME 1012
-#define GET_ABSOLUTE_PATH 1013
-#define GET_RELATIVE_PATH 1014
-#define DIRECTORY_EXISTS 1015
-#define DIRECTORY_LOAD 1016
-#define FILE_EXISTS 1017
-#define UTIL_READLINE 1018
-#define GET_QUOTED_STRING 1019
-#define SUBSTITUTE_ENV_VARS 1020
-#define SCOPE_EXTRACT_FRONT 1021
-#define SCOPE_EXTRACT_BACK 1022
-#define SCOPE_EXTRACT_SCOPE 1023
-#define SCOPE_GEN_PRINTABLE 1024
-#define SCOPE_COMPARE 1025
-#define SCOPE_LOCAL 1026
-#define CONVERT_FILE_TO_MODULE 1027
-#define GET_NEXT_VFILE 1028
-#define GEN_SPACE 1029
-#define REMOVE_UNDERSCORES 1030
-#define GET_FUNIT_TYPE 1031
-#define CALC_MISS_PERCENT 1032
-#define READ_COMMAND_FILE 1033
-#define CONVERT_STR_TO_UINT64 1034
-#define CONVERT_INT_TO_STR 1035
-#define CALC_NUM_BITS_TO_STORE 1036
-#define VCD_CALC_INDEX 1037
-#define VCD_GETCH_FETCH 1038
-#define VCD_GET_TOKEN 1039
-#define VCD_SYNC_END 1040
-#define VCD_PARSE_DEF_VAR 1041
-#define VCD_PARSE_DEF 1042
-#define VCD_PARSE_SIM_VECTOR 1043
-#define VCD_PARSE_SIM_REAL 1044
-#define VCD_PARSE_SIM 1045
-#define VCD_PARSE 1046
-#define VECTOR_INIT_ULONG 1047
-#define VECTOR_INT_R64 1048
-#define VECTOR_INT_R32 1049
-#define VECTOR_CREATE 1050
-#define VECTOR_COPY 1051
-#define VECTOR_COPY_RANGE 1052
-#define VECTOR_CLONE 1053
-#define VECTOR_DB_WRITE 1054
-#define VECTOR_DB_READ 1055
-#define VECTOR_DB_MERGE 1056
-#define VECTOR_MERGE 1057
-#define VECTOR_GET_EVAL_A 1058
-#define VECTOR_GET_EVAL_B 1059
-#define VECTOR_GET_EVAL_C 1060
-#define VECTOR_GET_EVAL_D 1061
-#define VECTOR_GET_EVAL_AB_COUNT 1062
-#define VECTOR_GET_EVAL_ABC_COUNT 1063
-#define VECTOR_GET_EVAL_ABCD_COUNT 1064
-#define VECTOR_GET_TOGGLE01_ULONG 1065
-#define VECTOR_GET_TOGGLE10_ULONG 1066
-#define VECTOR_DISPLAY_TOGGLE01_ULONG 1067
-#define VECTOR_DISPLAY_TOGGLE10_ULONG 1068
-#define VECTOR_TOGGLE_COUNT 1069
-#define VECTOR_MEM_RW_COUNT 1070
-#define VECTOR_SET_ASSIGNED 1071
-#define VECTOR_SET_COVERAGE_AND_ASSIGN 1072
-#define VECTOR_GET_SIGN_EXTEND_VECTOR_ULONG 1073
-#define VECTOR_SIGN_EXTEND_ULONG 1074
-#define VECTOR_LSHIFT_ULONG 1075
-#define VECTOR_RSHIFT_ULONG 1076
-#define VECTOR_SET_VALUE 1077
-#define VECTOR_SET_MEM_RD 1078
-#define VECTOR_PART_SELECT_PULL 1079
-#define VECTOR_PART_SELECT_PUSH 1080
-#define VECTOR_SET_UNARY_EVALS 1081
-#define VECTOR_SET_AND_COMB_EVALS 1082
-#define VECTOR_SET_OR_COMB_EVALS 1083
-#define VECTOR_SET_OTHER_COMB_EVALS 1084
-#define VECTOR_IS_UKNOWN 1085
-#define VECTOR_IS_NOT_ZERO 1086
-#define VECTOR_SET_TO_X 1087
-#define VECTOR_TO_INT 1088
-#define VECTOR_TO_UINT64 1089
-#define VECTOR_TO_REAL64 1090
-#define VECTOR_TO_SIM_TIME 1091
-#define VECTOR_FROM_INT 1092
-#define VECTOR_FROM_UINT64 1093
-#define VECTOR_FROM_REAL64 1094
-#define VECTOR_SET_STATIC 1095
-#define VECTOR_TO_STRING 1096
-#define VECTOR_FROM_STRING_FIXED 1097
-#define VECTOR_FROM_STRING 1098
-#define VECTOR_VCD_ASSIGN 1099
-#define VECTOR_VCD_ASSIGN2 1100
-#define VECTOR_BITWISE_AND_OP 1101
-#define VECTOR_BITWISE_NAND_OP 1102
-#define VECTOR_BITWISE_OR_OP 1103
-#define VECTOR_BITWISE_NOR_OP 1104
-#define VECTOR_BITWISE_XOR_OP 1105
-#define VECTOR_BITWISE_NXOR_OP 1106
-#define VECTOR_OP_LT 1107
-#define VECTOR_OP_LE 1108
-#define VECTOR_OP_GT 1109
-#define VECTOR_OP_GE 1110
-#define VECTOR_OP_EQ 1111
-#define VECTOR_CEQ_ULONG 1112
-#define VECTOR_OP_CEQ 1113
-#define VECTOR_OP_CXEQ 1114
-#define VECTOR_OP_CZEQ 1115
-#define VECTOR_OP_NE 1116
-#define VECTOR_OP_CNE 1117
-#define VECTOR_OP_LOR 1118
-#define VECTOR_OP_LAND 1119
-#define VECTOR_OP_LSHIFT 1120
-#define VECTOR_OP_RSHIFT 1121
-#define VECTOR_OP_ARSHIFT 1122
-#define VECTOR_OP_ADD 1123
-#define VECTOR_OP_NEGATE 1124
-#define VECTOR_OP_SUBTRACT 1125
-#define VECTOR_OP_MULTIPLY 1126
-#define VECTOR_OP_DIVIDE 1127
-#define VECTOR_OP_MODULUS 1128
-#define VECTOR_OP_INC 1129
-#define VECTOR_OP_DEC 1130
-#define VECTOR_UNARY_INV 1131
-#define VECTOR_UNARY_AND 1132
-#define VECTOR_UNARY_NAND 1133
-#define VECTOR_UNARY_OR 1134
-#define VECTOR_UNARY_NOR 1135
-#define VECTOR_UNARY_XOR 1136
-#define VECTOR_UNARY_NXOR 1137
-#define VECTOR_UNARY_NOT 1138
-#define VECTOR_OP_EXPAND 1139
-#define VECTOR_OP_LIST 1140
-#define VECTOR_OP_CLOG2 1141
-#define VECTOR_DEALLOC_VALUE 1142
-#define VECTOR_DEALLOC 1143
-#define SYM_VALUE_STORE 1144
-#define ADD_SYM_VALUES_TO_SIM 1145
-#define COVERED_ROSYNCH 1146
-#define COVERED_VALUE_CHANGE_BIN 1147
-#define COVERED_VALUE_CHANGE_REAL 1148
-#define COVERED_END_OF_SIM 1149
-#define COVERED_CB_ERROR_HANDLER 1150
-#define GEN_NEXT_SYMBOL 1151
-#define COVERED_CREATE_VALUE_CHANGE_CB 1152
-#define COVERED_PARSE_TASK_FUNC 1153
-#define COVERED_PARSE_SIGNALS 1154
-#define COVERED_PARSE_INSTANCE 1155
-#define COVERED_SIM_CALLTF 1156
-#define COVERED_REGISTER 1157
-#define VSIGNAL_INIT 1158
-#define VSIGNAL_CREATE 1159
-#define VSIGNAL_CREATE_VEC 1160
-#define VSIGNAL_DUPLICATE 1161
-#define VSIGNAL_DB_WRITE 1162
-#define VSIGNAL_DB_READ 1163
-#define VSIGNAL_DB_MERGE 1164
-#define VSIGNAL_MERGE 1165
-#define VSIGNAL_PROPAGATE 1166
-#define VSIGNAL_VCD_ASSIGN 1167
-#define VSIGNAL_ADD_EXPRESSION 1168
-#define VSIGNAL_FROM_STRING 1169
-#define VSIGNAL_CALC_WIDTH_FOR_EXPR 1170
-#define VSIGNAL_CALC_LSB_FOR_EXPR 1171
-#define VSIGNAL_DEALLOC 1172
+#define ARC_STATE_HASH_PROBE 1
+#define ARC_ARC_HASH_PROBE 2
+#define ARC_STATE_HASH_ADD 3
+#define ARC_ARC_HASH_ADD 4
+#define ARC_FIND_FROM_STATE 5
+#define ARC_FIND_TO_STATE 6
+#define ARC_FIND_ARC 7
+#define ARC_FIND_ARC_BY_EXCLUSION_ID 8
+#define ARC_CREATE 9
+#define ARC_ADD 10
+#define ARC_STATE_HITS 11
+#define ARC_TRANSITION_HITS 12
+#define ARC_TRANSITION_EXCLUDED 13
+#define ARC_GET_STATS 14
+#define ARC_DB_WRITE 15
+#define ARC_DB_READ 16
+#define ARC_DB_MERGE 17
+#define ARC_MERGE 18
+#define ARC_GET_STATES 19
+#define ARC_GET_TRANSITIONS 20
+#define ARC_ARE_ANY_EXCLUDED 21
+#define ARC_DEALLOC 22
+#define ASSERTION_PARSE 23
+#define ASSERTION_PARSE_ATTR 24
+#define ASSERTION_GET_STATS 25
+#define ASSERTION_DISPLAY_INSTANCE_SUMMARY 26
+#define ASSERTION_INSTANCE_SUMMARY 27
+#define ASSERTION_DISPLAY_FUNIT_SUMMARY 28
+#define ASSERTION_FUNIT_SUMMARY 29
+#define ASSERTION_DISPLAY_VERBOSE 30
+#define ASSERTION_INSTANCE_VERBOSE 31
+#define ASSERTION_FUNIT_VERBOSE 32
+#define ASSERTION_REPORT 33
+#define ASSERTION_GET_FUNIT_SUMMARY 34
+#define ASSERTION_COLLECT 35
+#define ASSERTION_GET_COVERAGE 36
+#define ATTRIBUTE_CREATE 37
+#define ATTRIBUTE_PARSE 38
+#define ATTRIBUTE_DEALLOC 39
+#define BIND_ADD 40
+#define BIND_APPEND_FSM_EXPR 41
+#define BIND_REMOVE 42
+#define BIND_FIND_SIG_NAME 43
+#define BIND_PARAM 44
+#define BIND_SIGNAL 45
+#define BIND_TASK_FUNCTION_PORTS 46
+#define BIND_TASK_FUNCTION_NAMEDBLOCK 47
+#define BIND_PERFORM 48
+#define BIND_DEALLOC 49
+#define CODEGEN_CREATE_EXPR_HELPER 50
+#define CODEGEN_CREATE_EXPR 51
+#define CODEGEN_GEN_EXPR1 52
+#define CODEGEN_GEN_EXPR 53
+#define CODEGEN_GEN_EXPR_ONE_LINE 54
+#define COMBINATION_CALC_DEPTH 55
+#define COMBINATION_DOES_MULTI_EXP_NEED_UL 56
+#define COMBINATION_MULTI_EXPR_CALC 57
+#define COMBINATION_IS_EXPR_MULTI_NODE 58
+#define COMBINATION_GET_TREE_STATS 59
+#define COMBINATION_RESET_COUNTED_EXPRS 60
+#define COMBINATION_RESET_COUNTED_EXPR_TREE 61
+#define COMBINATION_GET_STATS 62
+#define COMBINATION_GET_FUNIT_SUMMARY 63
+#define COMBINATION_GET_INST_SUMMARY 64
+#define COMBINATION_DISPLAY_INSTANCE_SUMMARY 65
+#define COMBINATION_INSTANCE_SUMMARY 66
+#define COMBINATION_DISPLAY_FUNIT_SUMMARY 67
+#define COMBINATION_FUNIT_SUMMARY 68
+#define COMBINATION_DRAW_LINE 69
+#define COMBINATION_DRAW_CENTERED_LINE 70
+#define COMBINATION_PARENTHESIZE 71
+#define COMBINATION_UNDERLINE_TREE 72
+#define COMBINATION_PREP_LINE 73
+#define COMBINATION_UNDERLINE 74
+#define COMBINATION_UNARY 75
+#define COMBINATION_EVENT 76
+#define COMBINATION_TWO_VARS 77
+#define COMBINATION_MULTI_VAR_EXPRS 78
+#define COMBINATION_MULTI_EXPR_OUTPUT_LENGTH 79
+#define COMBINATION_MULTI_EXPR_OUTPUT 80
+#define COMBINATION_MULTI_VARS 81
+#define COMBINATION_GET_MISSED_EXPR 82
+#define COMBINATION_LIST_MISSED 83
+#define COMBINATION_OUTPUT_EXPR 84
+#define COMBINATION_DISPLAY_VERBOSE 85
+#define COMBINATION_INSTANCE_VERBOSE 86
+#define COMBINATION_FUNIT_VERBOSE 87
+#define COMBINATION_COLLECT 88
+#define COMBINATION_GET_EXCLUDE_LIST 89
+#define COMBINATION_GET_EXPRESSION 90
+#define COMBINATION_GET_COVERAGE 91
+#define COMBINATION_REPORT 92
+#define DB_CREATE 93
+#define DB_CLOSE 94
+#define DB_CHECK_FOR_TOP_MODULE 95
+#define DB_WRITE 96
+#define DB_READ 97
+#define DB_MARK_2STATE_SIGNALS 98
+#define DB_ASSIGN_IDS 99
+#define DB_MERGE_INSTANCE_TREES 100
+#define DB_MERGE_FUNITS 101
+#define DB_SCALE_TO_PRECISION 102
+#define DB_CREATE_UNNAMED_SCOPE 103
+#define DB_IS_UNNAMED_SCOPE 104
+#define DB_SET_TIMESCALE 105
+#define DB_FIND_AND_SET_CURR_FUNIT 106
+#define DB_GET_CURR_FUNIT 107
+#define DB_GET_FUNIT_BY_POSITION 108
+#define DB_GET_EXCLUSION_ID_SIZE 109
+#define DB_GEN_EXCLUSION_ID 110
+#define DB_ADD_FILE_VERSION 111
+#define DB_OUTPUT_DUMPVARS 112
+#define DB_ADD_INSTANCE 113
+#define DB_ADD_MODULE 114
+#define DB_END_MODULE 115
+#define DB_ADD_FUNCTION_TASK_NAMEDBLOCK 116
+#define DB_END_FUNCTION_TASK_NAMEDBLOCK 117
+#define DB_ADD_DECLARED_PARAM 118
+#define DB_ADD_OVERRIDE_PARAM 119
+#define DB_ADD_VECTOR_PARAM 120
+#define DB_ADD_DEFPARAM 121
+#define DB_ADD_SIGNAL 122
+#define DB_ADD_ENUM 123
+#define DB_END_ENUM_LIST 124
+#define DB_ADD_TYPEDEF 125
+#define DB_FIND_SIGNAL 126
+#define DB_ADD_GEN_ITEM_BLOCK 127
+#define DB_FIND_GEN_ITEM 128
+#define DB_FIND_TYPEDEF 129
+#define DB_GET_CURR_GEN_BLOCK 130
+#define DB_CURR_SIGNAL_COUNT 131
+#define DB_CREATE_EXPRESSION 132
+#define DB_BIND_EXPR_TREE 133
+#define DB_CREATE_EXPR_FROM_STATIC 134
+#define DB_ADD_EXPRESSION 135
+#define DB_CREATE_SENSITIVITY_LIST 136
+#define DB_PARALLELIZE_STATEMENT 137
+#define DB_CREATE_STATEMENT 138
+#define DB_ADD_STATEMENT 139
+#define DB_REMOVE_STATEMENT_FROM_CURRENT_FUNIT 140
+#define DB_REMOVE_STATEMENT 141
+#define DB_CONNECT_STATEMENT_TRUE 142
+#define DB_CONNECT_STATEMENT_FALSE 143
+#define DB_GEN_ITEM_CONNECT_TRUE 144
+#define DB_GEN_ITEM_CONNECT_FALSE 145
+#define DB_GEN_ITEM_CONNECT 146
+#define DB_STATEMENT_CONNECT 147
+#define DB_CREATE_ATTR_PARAM 148
+#define DB_PARSE_ATTRIBUTE 149
+#define DB_REMOVE_STMT_BLKS_CALLING_STATEMENT 150
+#define DB_GEN_CURR_INST_SCOPE 151
+#define DB_SYNC_CURR_INSTANCE 152
+#define DB_VCD_SCOPE_BUILD_HASH 153
+#define DB_VCD_SCOPE_PROBE_HASH 154
+#define DB_VCD_SCOPE_FIND_CHILD 155
+#define DB_SET_VCD_SCOPE 156
+#define DB_VCD_UPSCOPE 157
+#define DB_ASSIGN_SYMBOL 158
+#define DB_SET_SYMBOL_CHAR 159
+#define DB_SET_SYMBOL_STRING 160
+#define DB_SET_SYMBOL_REAL 161
+#define DB_SIMULATE_TIMESTEP 162
+#define DB_DO_TIMESTEP 163
+#define DB_DO_DUMP_TIMESTEP 164
+#define DB_CHECK_DUMPFILE_SCOPES 165
+#define DB_VERILATOR_INITIALIZE 166
+#define DB_VERILATOR_CLOSE 167
+#define DB_ADD_LINE_COVERAGE 168
+#define ENUMERATE_ADD_ITEM 169
+#define ENUMERATE_END_LIST 170
+#define ENUMERATE_RESOLVE 171
+#define ENUMERATE_DEALLOC 172
+#define ENUMERATE_DEALLOC_LIST 173
+#define EXCLUDE_EXPR_ASSIGN_AND_RECALC 174
+#define EXCLUDE_SIG_ASSIGN_AND_RECALC 175
+#define EXCLUDE_ARC_ASSIGN_AND_RECALC 176
+#define EXCLUDE_ADD_EXCLUDE_REASON 177
+#define EXCLUDE_REMOVE_EXCLUDE_REASON 178
+#define EXCLUDE_IS_LINE_EXCLUDED 179
+#define EXCLUDE_SET_LINE_EXCLUDE 180
+#define EXCLUDE_IS_TOGGLE_EXCLUDED 181
+#define EXCLUDE_SET_TOGGLE_EXCLUDE 182
+#define EXCLUDE_IS_COMB_EXCLUDED 183
+#define EXCLUDE_SET_COMB_EXCLUDE 184
+#define EXCLUDE_IS_FSM_EXCLUDED 185
+#define EXCLUDE_SET_FSM_EXCLUDE 186
+#define EXCLUDE_IS_ASSERT_EXCLUDED 187
+#define EXCLUDE_SET_ASSERT_EXCLUDE 188
+#define EXCLUDE_FIND_EXCLUDE_REASON 189
+#define EXCLUDE_DB_WRITE 190
+#define EXCLUDE_DB_READ 191
+#define EXCLUDE_RESOLVE_REASON 192
+#define EXCLUDE_DB_MERGE 193
+#define EXCLUDE_MERGE 194
+#define EXCLUDE_GET_INDEX 195
+#define EXCLUDE_FIND_SIGNAL 196
+#define EXCLUDE_FIND_EXPRESSION 197
+#define EXCLUDE_FIND_FSM_ARC 198
+#define EXCLUDE_FORMAT_REASON 199
+#define EXCLUDED_GET_MESSAGE 200
+#define EXCLUDE_HANDLE_EXCLUDE_REASON 201
+#define EXCLUDE_PRINT_EXCLUSION 202
+#define EXCLUDE_LINE_FROM_ID 203
+#define EXCLUDE_TOGGLE_FROM_ID 204
+#define EXCLUDE_MEMORY_FROM_ID 205
+#define EXCLUDE_EXPR_FROM_ID 206
+#define EXCLUDE_FSM_FROM_ID 207
+#define EXCLUDE_ASSERT_FROM_ID 208
+#define EXCLUDE_APPLY_EXCLUSIONS 209
+#define COMMAND_EXCLUDE 210
+#define EXPRESSION_CREATE_TMP_VECS 211
+#define EXPRESSION_CREATE_NBA 212
+#define EXPRESSION_IS_NBA_LHS 213
+#define EXPRESSION_CREATE_VALUE 214
+#define EXPRESSION_CREATE 215
+#define EXPRESSION_SET_VALUE 216
+#define EXPRESSION_SET_SIGNED 217
+#define EXPRESSION_RESIZE 218
+#define EXPRESSION_GET_ID 219
+#define EXPRESSION_GET_FIRST_LINE_EXPR 220
+#define EXPRESSION_GET_LAST_LINE_EXPR 221
+#define EXPRESSION_GET_CURR_DIMENSION 222
+#define EXPRESSION_FIND_RHS_SIGS 223
+#define EXPRESSION_FIND_PARAMS 224
+#define EXPRESSION_FIND_ULINE_ID 225
+#define EXPRESSION_FIND_EXPR 226
+#define EXPRESSION_CONTAINS_EXPR_CALLING_STMT 227
+#define EXPRESSION_GET_ROOT_STATEMENT 228
+#define EXPRESSION_ASSIGN_EXPR_IDS 229
+#define EXPRESSION_DB_WRITE 230
+#define EXPRESSION_DB_WRITE_TREE 231
+#define EXPRESSION_DB_READ 232
+#define EXPRESSION_DB_MERGE 233
+#define EXPRESSION_MERGE 234
+#define EXPRESSION_STRING_OP 235
+#define EXPRESSION_STRING 236
+#define EXPRESSION_OP_FUNC__XOR 237
+#define EXPRESSION_OP_FUNC__XOR_A 238
+#define EXPRESSION_OP_FUNC__MULTIPLY 239
+#define EXPRESSION_OP_FUNC__MULTIPLY_A 240
+#define EXPRESSION_OP_FUNC__DIVIDE 241
+#define EXPRESSION_OP_FUNC__DIVIDE_A 242
+#define EXPRESSION_OP_FUNC__MOD 243
+#define EXPRESSION_OP_FUNC__MOD_A 244
+#define EXPRESSION_OP_FUNC__ADD 245
+#define EXPRESSION_OP_FUNC__ADD_A 246
+#define EXPRESSION_OP_FUNC__SUBTRACT 247
+#define EXPRESSION_OP_FUNC__SUB_A 248
+#define EXPRESSION_OP_FUNC__AND 249
+#define EXPRESSION_OP_FUNC__AND_A 250
+#define EXPRESSION_OP_FUNC__OR 251
+#define EXPRESSION_OP_FUNC__OR_A 252
+#define EXPRESSION_OP_FUNC__NAND 253
+#define EXPRESSION_OP_FUNC__NOR 254
+#define EXPRESSION_OP_FUNC__NXOR 255
+#define EXPRESSION_OP_FUNC__LT 256
+#define EXPRESSION_OP_FUNC__GT 257
+#define EXPRESSION_OP_FUNC__LSHIFT 258
+#define EXPRESSION_OP_FUNC__LSHIFT_A 259
+#define EXPRESSION_OP_FUNC__RSHIFT 260
+#define EXPRESSION_OP_FUNC__RSHIFT_A 261
+#define EXPRESSION_OP_FUNC__ARSHIFT 262
+#define EXPRESSION_OP_FUNC__ARSHIFT_A 263
+#define EXPRESSION_OP_FUNC__TIME 264
+#define EXPRESSION_OP_FUNC__RANDOM 265
+#define EXPRESSION_OP_FUNC__SASSIGN 266
+#define EXPRESSION_OP_FUNC__SRANDOM 267
+#define EXPRESSION_OP_FUNC__URANDOM 268
+#define EXPRESSION_OP_FUNC__URANDOM_RANGE 269
+#define EXPRESSION_OP_FUNC__REALTOBITS 270
+#define EXPRESSION_OP_FUNC__BITSTOREAL 271
+#define EXPRESSION_OP_FUNC__SHORTREALTOBITS 272
+#define EXPRESSION_OP_FUNC__BITSTOSHORTREAL 273
+#define EXPRESSION_OP_FUNC__ITOR 274
+#define EXPRESSION_OP_FUNC__RTOI 275
+#define EXPRESSION_OP_FUNC__TEST_PLUSARGS 276
+#define EXPRESSION_OP_FUNC__VALUE_PLUSARGS 277
+#define EXPRESSION_OP_FUNC__SIGNED 278
+#define EXPRESSION_OP_FUNC__UNSIGNED 279
+#define EXPRESSION_OP_FUNC__CLOG2 280
+#define EXPRESSION_OP_FUNC__EQ 281
+#define EXPRESSION_OP_FUNC__CEQ 282
+#define EXPRESSION_OP_FUNC__LE 283
+#define EXPRESSION_OP_FUNC__GE 284
+#define EXPRESSION_OP_FUNC__NE 285
+#define EXPRESSION_OP_FUNC__CNE 286
+#define EXPRESSION_OP_FUNC__LOR 287
+#define EXPRESSION_OP_FUNC__LAND 288
+#define EXPRESSION_OP_FUNC__COND 289
+#define EXPRESSION_OP_FUNC__COND_SEL 290
+#define EXPRESSION_OP_FUNC__UINV 291
+#define EXPRESSION_OP_FUNC__UAND 292
+#define EXPRESSION_OP_FUNC__UNOT 293
+#define EXPRESSION_OP_FUNC__UOR 294
+#define EXPRESSION_OP_FUNC__UXOR 295
+#define EXPRESSION_OP_FUNC__UNAND 296
+#define EXPRESSION_OP_FUNC__UNOR 297
+#define EXPRESSION_OP_FUNC__UNXOR 298
+#define EXPRESSION_OP_FUNC__NULL 299
+#define EXPRESSION_OP_FUNC__SIG 300
+#define EXPRESSION_OP_FUNC__SBIT 301
+#define EXPRESSION_OP_FUNC__MBIT 302
+#define EXPRESSION_OP_FUNC__EXPAND 303
+#define EXPRESSION_OP_FUNC__LIST 304
+#define EXPRESSION_OP_FUNC__CONCAT 305
+#define EXPRESSION_OP_FUNC__PEDGE 306
+#define EXPRESSION_OP_FUNC__NEDGE 307
+#define EXPRESSION_OP_FUNC__AEDGE 308
+#define EXPRESSION_OP_FUNC__EOR 309
+#define EXPRESSION_OP_FUNC__SLIST 310
+#define EXPRESSION_OP_FUNC__DELAY 311
+#define EXPRESSION_OP_FUNC__TRIGGER 312
+#define EXPRESSION_OP_FUNC__CASE 313
+#define EXPRESSION_OP_FUNC__CASEX 314
+#define EXPRESSION_OP_FUNC__CASEZ 315
+#define EXPRESSION_OP_FUNC__DEFAULT 316
+#define EXPRESSION_OP_FUNC__BASSIGN 317
+#define EXPRESSION_OP_FUNC__FUNC_CALL 318
+#define EXPRESSION_OP_FUNC__TASK_CALL 319
+#define EXPRESSION_OP_FUNC__NB_CALL 320
+#define EXPRESSION_OP_FUNC__FORK 321
+#define EXPRESSION_OP_FUNC__JOIN 322
+#define EXPRESSION_OP_FUNC__DISABLE 323
+#define EXPRESSION_OP_FUNC__REPEAT 324
+#define EXPRESSION_OP_FUNC__EXPONENT 325
+#define EXPRESSION_OP_FUNC__PASSIGN 326
+#define EXPRESSION_OP_FUNC__MBIT_POS 327
+#define EXPRESSION_OP_FUNC__MBIT_NEG 328
+#define EXPRESSION_OP_FUNC__NEGATE 329
+#define EXPRESSION_OP_FUNC__IINC 330
+#define EXPRESSION_OP_FUNC__PINC 331
+#define EXPRESSION_OP_FUNC__IDEC 332
+#define EXPRESSION_OP_FUNC__PDEC 333
+#define EXPRESSION_OP_FUNC__DLY_ASSIGN 334
+#define EXPRESSION_OP_FUNC__DLY_OP 335
+#define EXPRESSION_OP_FUNC__REPEAT_DLY 336
+#define EXPRESSION_OP_FUNC__DIM 337
+#define EXPRESSION_OP_FUNC__WAIT 338
+#define EXPRESSION_OP_FUNC__FINISH 339
+#define EXPRESSION_OP_FUNC__STOP 340
+#define EXPRESSION_OPERATE 341
+#define EXPRESSION_OPERATE_RECURSIVELY 342
+#define EXPRESSION_SET_LINE_COVERAGE 343
+#define EXPRESSION_VCD_ASSIGN 344
+#define EXPRESSION_IS_STATIC_ONLY_HELPER 345
+#define EXPRESSION_IS_ASSIGNED 346
+#define EXPRESSION_IS_BIT_SELECT 347
+#define EXPRESSION_IS_LAST_SELECT 348
+#define EXPRESSION_GET_FIRST_SELECT 349
+#define EXPRESSION_IS_IN_RASSIGN 350
+#define EXPRESSION_SET_ASSIGNED 351
+#define EXPRESSION_SET_CHANGED 352
+#define EXPRESSION_ASSIGN 353
+#define EXPRESSION_DEALLOC 354
+#define FSM_CREATE 355
+#define FSM_ADD_ARC 356
+#define FSM_CREATE_TABLES 357
+#define FSM_DB_WRITE 358
+#define FSM_DB_READ 359
+#define FSM_DB_MERGE 360
+#define FSM_MERGE 361
+#define FSM_TABLE_SET 362
+#define FSM_VCD_ASSIGN 363
+#define FSM_GET_STATS 364
+#define FSM_GET_FUNIT_SUMMARY 365
+#define FSM_GET_INST_SUMMARY 366
+#define FSM_GATHER_SIGNALS 367
+#define FSM_COLLECT 368
+#define FSM_GET_COVERAGE 369
+#define FSM_DISPLAY_INSTANCE_SUMMARY 370
+#define FSM_INSTANCE_SUMMARY 371
+#define FSM_DISPLAY_FUNIT_SUMMARY 372
+#define FSM_FUNIT_SUMMARY 373
+#define FSM_DISPLAY_STATE_VERBOSE 374
+#define FSM_DISPLAY_ARC_VERBOSE 375
+#define FSM_DISPLAY_VERBOSE 376
+#define FSM_INSTANCE_VERBOSE 377
+#define FSM_FUNIT_VERBOSE 378
+#define FSM_REPORT 379
+#define FSM_DEALLOC 380
+#define FSM_ARG_PARSE_STATE 381
+#define FSM_ARG_PARSE 382
+#define FSM_ARG_PARSE_VALUE 383
+#define FSM_ARG_PARSE_TRANS 384
+#define FSM_ARG_PARSE_ATTR 385
+#define FSM_VAR_ADD 386
+#define FSM_VAR_IS_OUTPUT_STATE 387
+#define FSM_VAR_BIND_EXPR 388
+#define FSM_VAR_ADD_EXPR 389
+#define FSM_VAR_BIND_STMT 390
+#define FSM_VAR_BIND_ADD 391
+#define FSM_VAR_STMT_ADD 392
+#define FSM_VAR_BIND 393
+#define FSM_VAR_DEALLOC 394
+#define FSM_VAR_REMOVE 395
+#define FSM_VAR_CLEANUP 396
+#define FST_READER_PROCESS_HIER 397
+#define FST_CALLBACK 398
+#define FST_SIMULATE 399
+#define FST_PARSE 400
+#define FUNC_ITER_DISPLAY 401
+#define FUNC_ITER_SORT 402
+#define FUNC_ITER_COUNT_STMT_ITERS 403
+#define FUNC_ITER_ADD_STMT_ITERS 404
+#define FUNC_ITER_ADD_SIG_LINKS 405
+#define FUNC_ITER_INIT 406
+#define FUNC_ITER_GET_NEXT_STATEMENT 407
+#define FUNC_ITER_GET_NEXT_SIGNAL 408
+#define FUNC_ITER_DEALLOC 409
+#define FUNIT_INIT 410
+#define FUNIT_CREATE 411
+#define FUNIT_INDEX_GET 412
+#define FUNIT_INDEX_PROBE_SIGNAL 413
+#define FUNIT_INDEX_SYNC_SIGNALS 414
+#define FUNIT_INDEX_PROBE_EXPRESSION 415
+#define FUNIT_INDEX_SYNC_EXPRESSIONS 416
+#define FUNIT_INDEX_PROBE_FSM 417
+#define FUNIT_INDEX_SYNC_FSMS 418
+#define FUNIT_INDEX_PROBE_PARAM 419
+#define FUNIT_INDEX_SYNC_PARAMS 420
+#define FUNIT_INDEX_CLEAR 421
+#define FUNIT_LOOKUP_SIGNAL 422
+#define FUNIT_LOOKUP_EXPRESSION 423
+#define FUNIT_LOOKUP_FSM 424
+#define FUNIT_LOOKUP_PARAM 425
+#define FUNIT_GET_CURR_MODULE 426
+#define FUNIT_GET_CURR_MODULE_SAFE 427
+#define FUNIT_GET_CURR_FUNCTION 428
+#define FUNIT_GET_CURR_TASK 429
+#define FUNIT_GET_PORT_COUNT 430
+#define FUNIT_FIND_PARAM 431
+#define FUNIT_FIND_SIGNAL 432
+#define FUNIT_REMOVE_STMT_BLKS_CALLING_STMT 433
+#define FUNIT_GEN_TASK_FUNCTION_NAMEDBLOCK_NAME 434
+#define FUNIT_SIZE_ELEMENTS 435
+#define FUNIT_DB_WRITE 436
+#define FUNIT_DB_READ 437
+#define FUNIT_VERSION_DB_READ 438
+#define FUNIT_DB_MERGE 439
+#define FUNIT_MERGE 440
+#define FUNIT_FLATTEN_NAME 441
+#define FUNIT_FIND_BY_ID 442
+#define FUNIT_IS_TOP_MODULE 443
+#define FUNIT_IS_UNNAMED 444
+#define FUNIT_IS_UNNAMED_CHILD_OF 445
+#define FUNIT_IS_CHILD_OF 446
+#define FUNIT_DISPLAY_SIGNALS 447
+#define FUNIT_DISPLAY_EXPRESSIONS 448
+#define STATEMENT_ADD_THREAD 449
+#define FUNIT_PUSH_THREADS 450
+#define FUNIT_GET_THREAD_POSITION 451
+#define STATEMENT_DELETE_THREAD 452
+#define FUNIT_OUTPUT_DUMPVARS 453
+#define FUNIT_IS_ONE_SIGNAL_ASSIGNED 454
+#define FUNIT_CLEAN 455
+#define FUNIT_DEALLOC 456
+#define GEN_ITEM_STRINGIFY 457
+#define GEN_ITEM_DISPLAY 458
+#define GEN_ITEM_DISPLAY_BLOCK_HELPER 459
+#define GEN_ITEM_DISPLAY_BLOCK 460
+#define GEN_ITEM_COMPARE 461
+#define GEN_ITEM_FIND 462
+#define GEN_ITEM_REMOVE_IF_CONTAINS_EXPR_CALLING_STMT 463
+#define GEN_ITEM_GET_GENVAR 464
+#define GEN_ITEM_VARNAME_CONTAINS_GENVAR 465
+#define GEN_ITEM_CALC_SIGNAL_NAME 466
+#define GEN_ITEM_CREATE_EXPR 467
+#define GEN_ITEM_CREATE_SIG 468
+#define GEN_ITEM_CREATE_STMT 469
+#define GEN_ITEM_CREATE_INST 470
+#define GEN_ITEM_CREATE_TFN 471
+#define GEN_ITEM_CREATE_BIND 472
+#define GEN_ITEM_RESIZE_STMTS_AND_SIGS 473
+#define GEN_ITEM_ASSIGN_IDS 474
+#define GEN_ITEM_DB_WRITE 475
+#define GEN_ITEM_DB_WRITE_EXPR_TREE 476
+#define GEN_ITEM_CONNECT 477
+#define GEN_ITEM_RESOLVE 478
+#define GEN_ITEM_BIND 479
+#define GENERATE_RESOLVE_INST 480
+#define GENERATE_REMOVE_STMT_HELPER 481
+#define GENERATE_REMOVE_STMT 482
+#define GENERATE_FIND_STMT_BY_POSITION_HELPER 483
+#define GENERATE_FIND_STMT_BY_POSITION 484
+#define GENERATE_FIND_TFN_BY_POSITION_HELPER 485
+#define GENERATE_FIND_TFN_BY_POSITION 486
+#define GEN_ITEM_DEALLOC 487
+#define GENERATOR_GET_RELATIVE_SCOPE 488
+#define GENERATOR_CLEAR_REPLACE_PTRS 489
+#define GENERATOR_IS_STATIC_FUNCTION_ONLY 490
+#define GENERATOR_IS_STATIC_FUNCTION 491
+#define GENERATOR_REPLACE 492
+#define GENERATOR_PUSH_REG_INSERT 493
+#define GENERATOR_POP_REG_INSERT 494
+#define GENERATOR_IS_BASE_REG_INSERT 495
+#define GENERATOR_INSERT_REG 496
+#define GENERATOR_PUSH_FUNIT 497
+#define GENERATOR_POP_FUNIT 498
+#define GENERATOR_EXPR_NEEDS_TO_BE_SUBSTITUTED 499
+#define GENERATOR_EXPR_COV_NEEDED 500
+#define GENERATOR_CLEAR_COMB_CNTD 501
+#define GENERATOR_CREATE_EXPR_NAME 502
+#define GENERATOR_SORT_FUNIT_BY_FILENAME 503
+#define GENERATOR_SET_NEXT_FUNIT 504
+#define GENERATOR_DEALLOC_FNAME_LIST 505
+#define GENERATOR_OUTPUT_FUNIT 506
+#define GENERATOR_WRITE_VERILATOR_INST_IDS 507
+#define GENERATOR_OUTPUT 508
+#define GENERATOR_INIT_FUNIT 509
+#define GENERATOR_PREPEND_TO_WORK_CODE 510
+#define GENERATOR_ADD_TO_WORK_CODE 511
+#define GENERATOR_FLUSH_WORK_CODE1 512
+#define GENERATOR_ADD_TO_HOLD_CODE 513
+#define GENERATOR_FLUSH_HOLD_CODE1 514
+#define GENERATOR_FLUSH_ALL1 515
+#define GENERATOR_FIND_STATEMENT 516
+#define GENERATOR_FIND_CASE_STATEMENT 517
+#define GENERATOR_INSERT_LINE_COV_WITH_STMT 518
+#define GENERATOR_INSERT_LINE_COV 519
+#define GENERATOR_INSERT_EVENT_COMB_COV 520
+#define GENERATOR_INSERT_UNARY_COMB_COV 521
+#define GENERATOR_INSERT_AND_COMB_COV 522
+#define GENERATOR_MBIT_GEN_VALUE 523
+#define GENERATOR_IS_RHS_OF_ASSIGNMENT 524
+#define GENERATOR_GEN_SIZE 525
+#define GENERATOR_CREATE_LHS 526
+#define GENERATOR_INSERT_SUBEXP 527
+#define GENERATOR_COMB_COV_HELPER2 528
+#define GENERATOR_INSERT_COMB_COV_HELPER 529
+#define GENERATOR_GEN_MEM_INDEX_HELPER 530
+#define GENERATOR_GEN_MEM_INDEX 531
+#define GENERATOR_GEN_MEM_SIZE 532
+#define GENERATOR_GET_LHS_LSB_HELPER 533
+#define GENERATOR_GET_LHS_LSB 534
+#define GENERATOR_MEM_COV 535
+#define GENERATOR_MEM_COV_HELPER 536
+#define GENERATOR_COMB_COV 537
+#define GENERATOR_INSERT_COMB_COV_FROM_STMT_STACK 538
+#define GENERATOR_INSERT_COMB_COV_WITH_STMT 539
+#define GENERATOR_INSERT_CASE_COMB_COV 540
+#define GENERATOR_FSM_COVS 541
+#define GENERATOR_HANDLE_EVENT_TYPE 542
+#define GENERATOR_HANDLE_EVENT_TRIGGER 543
+#define GENERATOR_HOLD_LAST_TOKEN 544
+#define GENERATOR_FLUSH_HELD_TOKEN 545
+#define GENERATOR_INST_ID_PARAM 546
+#define GENERATOR_INST_ID_OVERRIDES_HELPER 547
+#define GENERATOR_INST_ID_OVERRIDES 548
+#define GENERATOR_BEGIN_PARALLEL_STATEMENT 549
+#define GENERATOR_END_PARALLEL_STATEMENT 550
+#define GENERATOR_BUILD 551
+#define GENERATOR_BUILD2 552
+#define GENERATOR_DESTROY2 553
+#define GENERATOR_TMP_REGS 554
+#define GENERATOR_CREATE_TMP_REGS 555
+#define GENERROR 556
+#define GENERATOR_WRITE_TO_FILE 557
+#define SCORE_ADD_ARGS 558
+#define INFO_SET_VECTOR_ELEM_SIZE 559
+#define INFO_SET_SCORED 560
+#define INFO_DB_WRITE 561
+#define INFO_DB_READ 562
+#define ARGS_DB_READ 563
+#define MESSAGE_DB_READ 564
+#define MERGED_CDD_DB_READ 565
+#define INFO_DEALLOC 566
+#define INSTANCE_DISPLAY_TREE_HELPER 567
+#define INSTANCE_DISPLAY_TREE 568
+#define INSTANCE_CREATE 569
+#define INSTANCE_ASSIGN_IDS 570
+#define INSTANCE_GEN_SCOPE 571
+#define INSTANCE_GEN_VERILATOR_SCOPE 572
+#define INSTANCE_COMPARE 573
+#define INSTANCE_FIND_SCOPE 574
+#define INSTANCE_FIND_BY_FUNIT 575
+#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE_HELPER 576
+#define INSTANCE_FIND_BY_FUNIT_NAME_IF_ONE 577
+#define INSTANCE_COUNT_EXCLUSION_IDS 578
+#define INSTANCE_GATHER_EXCLUSION_IDS 579
+#define INSTANCE_SORT_EXCLUSION_IDS 580
+#define INSTANCE_SEARCH_EXCLUSION_IDS 581
+#define INSTANCE_EXCLUSION_INDEX_CREATE 582
+#define INSTANCE_EXCLUSION_INDEX_DEALLOC 583
+#define INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID 584
+#define INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID 585
+#define INSTANCE_FIND_FSM_ARC_INDEX_BY_EXCLUSION_ID 586
+#define INSTANCE_ADD_CHILD 587
+#define INSTANCE_COPY_HELPER 588
+#define INSTANCE_COPY 589
+#define INSTANCE_PARSE_ADD 590
+#define INSTANCE_RESOLVE_INST 591
+#define INSTANCE_RESOLVE_HELPER 592
+#define INSTANCE_RESOLVE 593
+#define INSTANCE_READ_ADD 594
+#define INSTANCE_MERGE 595
+#define INSTANCE_GET_LEADING_HIERARCHY 596
+#define INSTANCE_GET_VERILATOR_LEADING_HIERARCHY 597
+#define INSTANCE_MARK_LHIER_DIFFS 598
+#define INSTANCE_MERGE_TWO_TREES 599
+#define INSTANCE_DB_WRITE 600
+#define INSTANCE_ONLY_DB_READ 601
+#define INSTANCE_ONLY_DB_MERGE 602
+#define INSTANCE_REMOVE_STMT_BLKS_CALLING_STMT 603
+#define INSTANCE_REMOVE_PARMS_WITH_EXPR 604
+#define INSTANCE_DEALLOC_SINGLE 605
+#define INSTANCE_OUTPUT_DUMPVARS 606
+#define INSTANCE_DEALLOC_TREE 607
+#define INSTANCE_DEALLOC 608
+#define LINE_GET_STATS 609
+#define LINE_COLLECT 610
+#define LINE_GET_FUNIT_SUMMARY 611
+#define LINE_GET_INST_SUMMARY 612
+#define LINE_DISPLAY_INSTANCE_SUMMARY 613
+#define LINE_INSTANCE_SUMMARY 614
+#define LINE_DISPLAY_FUNIT_SUMMARY 615
+#define LINE_FUNIT_SUMMARY 616
+#define LINE_DISPLAY_VERBOSE 617
+#define LINE_INSTANCE_VERBOSE 618
+#define LINE_FUNIT_VERBOSE 619
+#define LINE_REPORT 620
+#define STR_LINK_ADD 621
+#define STMT_LINK_ADD_HEAD 622
+#define EXP_LINK_ADD 623
+#define SIG_LINK_ADD 624
+#define FSM_LINK_ADD 625
+#define FUNIT_LINK_ADD 626
+#define GITEM_LINK_ADD 627
+#define INST_LINK_ADD 628
+#define STR_LINK_FIND 629
+#define STMT_LINK_FIND 630
+#define STMT_LINK_FIND_BY_POSITION 631
+#define EXP_LINK_FIND 632
+#define SIG_LINK_FIND 633
+#define FSM_LINK_FIND 634
+#define FUNIT_LINK_FIND 635
+#define GITEM_LINK_FIND 636
+#define INST_LINK_FIND_BY_SCOPE 637
+#define INST_LINK_FIND_BY_FUNIT 638
+#define STR_LINK_REMOVE 639
+#define EXP_LINK_REMOVE 640
+#define GITEM_LINK_REMOVE 641
+#define FUNIT_LINK_REMOVE 642
+#define STR_LINK_DELETE_LIST 643
+#define STMT_LINK_UNLINK 644
+#define STMT_LINK_DELETE_LIST 645
+#define EXP_LINK_DELETE_LIST 646
+#define SIG_LINK_DELETE_LIST 647
+#define FSM_LINK_DELETE_LIST 648
+#define FUNIT_LINK_DELETE_LIST 649
+#define GITEM_LINK_DELETE_LIST 650
+#define INST_LINK_DELETE_LIST 651
+#define VCDID 652
+#define VCD_CALLBACK 653
+#define LXT_SIMULATE 654
+#define LXT_PARSE 655
+#define LXT2_RD_EXPAND_INTEGER_TO_BITS 656
+#define LXT2_RD_EXPAND_BITS_TO_INTEGER 657
+#define LXT2_RD_ITER_RADIX 658
+#define LXT2_RD_ITER_RADIX0 659
+#define LXT2_RD_BUILD_RADIX 660
+#define LXT2_RD_REGENERATE_PROCESS_MASK 661
+#define LXT2_RD_PROCESS_BLOCK 662
+#define LXT2_RD_INIT 663
+#define LXT2_RD_CLOSE 664
+#define LXT2_RD_GET_FACNAME 665
+#define LXT2_RD_ITER_BLOCKS 666
+#define LXT2_RD_LIMIT_TIME_RANGE 667
+#define LXT2_RD_UNLIMIT_TIME_RANGE 668
+#define MEMORY_GET_STAT 669
+#define MEMORY_GET_STATS 670
+#define MEMORY_GET_FUNIT_SUMMARY 671
+#define MEMORY_GET_INST_SUMMARY 672
+#define MEMORY_CREATE_PDIM_BIT_ARRAY 673
+#define MEMORY_GET_MEM_COVERAGE 674
+#define MEMORY_GET_COVERAGE 675
+#define MEMORY_COLLECT 676
+#define MEMORY_DISPLAY_TOGGLE_INSTANCE_SUMMARY 677
+#define MEMORY_TOGGLE_INSTANCE_SUMMARY 678
+#define MEMORY_DISPLAY_AE_INSTANCE_SUMMARY 679
+#define MEMORY_AE_INSTANCE_SUMMARY 680
+#define MEMORY_DISPLAY_TOGGLE_FUNIT_SUMMARY 681
+#define MEMORY_TOGGLE_FUNIT_SUMMARY 682
+#define MEMORY_DISPLAY_AE_FUNIT_SUMMARY 683
+#define MEMORY_AE_FUNIT_SUMMARY 684
+#define MEMORY_DISPLAY_MEMORY 685
+#define MEMORY_DISPLAY_VERBOSE 686
+#define MEMORY_INSTANCE_VERBOSE 687
+#define MEMORY_FUNIT_VERBOSE 688
+#define MEMORY_REPORT 689
+#define MERGE_CHECK 690
+#define COMMAND_MERGE 691
+#define OBFUSCATE_SET_MODE 692
+#define OBFUSCATE_NAME 693
+#define OBFUSCATE_DEALLOC 694
+#define OVL_IS_ASSERTION_NAME 695
+#define OVL_IS_ASSERTION_MODULE 696
+#define OVL_IS_COVERAGE_POINT 697
+#define OVL_ADD_ASSERTIONS_TO_NO_SCORE_LIST 698
+#define OVL_GET_FUNIT_STATS 699
+#define OVL_GET_COVERAGE_POINT 700
+#define OVL_DISPLAY_VERBOSE 701
+#define OVL_COLLECT 702
+#define OVL_GET_COVERAGE 703
+#define MOD_PARM_FIND 704
+#define MOD_PARM_FIND_EXPR_AND_REMOVE 705
+#define MOD_PARM_GEN_SIZE_CODE 706
+#define MOD_PARM_GEN_LSB_CODE 707
+#define MOD_PARM_ADD 708
+#define INST_PARM_FIND 709
+#define INST_PARM_ADD 710
+#define INST_PARM_ADD_GENVAR 711
+#define INST_PARM_BIND 712
+#define DEFPARAM_ADD 713
+#define DEFPARAM_DEALLOC 714
+#define PARAM_FIND_AND_SET_EXPR_VALUE 715
+#define PARAM_SET_SIG_SIZE 716
+#define PARAM_SIZE_FUNCTION 717
+#define PARAM_EXPR_EVAL 718
+#define PARAM_HAS_OVERRIDE 719
+#define PARAM_HAS_DEFPARAM 720
+#define PARAM_RESOLVE_DECLARED 721
+#define PARAM_RESOLVE_OVERRIDE 722
+#define PARAM_RESOLVE_INST 723
+#define PARAM_RESOLVE 724
+#define PARAM_DB_WRITE 725
+#define MOD_PARM_DEALLOC 726
+#define INST_PARM_DEALLOC 727
+#define PARSE_READLINE 728
+#define PARSE_DESIGN 729
+#define PARSE_AND_SCORE_DUMPFILE 730
+#define PARSER_STATIC_EXPR_PRIMARY_A 731
+#define PARSER_STATIC_EXPR_PRIMARY_B 732
+#define PARSER_EXPRESSION_LIST_A 733
+#define PARSER_EXPRESSION_LIST_B 734
+#define PARSER_EXPRESSION_LIST_C 735
+#define PARSER_EXPRESSION_LIST_D 736
+#define PARSER_IDENTIFIER_A 737
+#define PARSER_GENERATE_CASE_ITEM_A 738
+#define PARSER_GENERATE_CASE_ITEM_B 739
+#define PARSER_GENERATE_CASE_ITEM_C 740
+#define PARSER_STATEMENT_BEGIN_A 741
+#define PARSER_STATEMENT_FORK_A 742
+#define PARSER_STATEMENT_FOR_A 743
+#define PARSER_CASE_ITEM_A 744
+#define PARSER_CASE_ITEM_B 745
+#define PARSER_CASE_ITEM_C 746
+#define PARSER_DELAY_VALUE_A 747
+#define PARSER_DELAY_VALUE_B 748
+#define PARSER_PARAMETER_VALUE_BYNAME_A 749
+#define PARSER_GATE_INSTANCE_A 750
+#define PARSER_GATE_INSTANCE_B 751
+#define PARSER_GATE_INSTANCE_C 752
+#define PARSER_GATE_INSTANCE_D 753
+#define PARSER_LIST_OF_NAMES_A 754
+#define PARSER_LIST_OF_NAMES_B 755
+#define PARSER_CHECK_PSTAR 756
+#define PARSER_CHECK_ATTRIBUTE 757
+#define PARSER_CREATE_ATTR_LIST 758
+#define PARSER_CREATE_ATTR 759
+#define PARSER_CREATE_TASK_DECL 760
+#define PARSER_CREATE_TASK_BODY 761
+#define PARSER_CREATE_FUNCTION_DECL 762
+#define PARSER_CREATE_FUNCTION_BODY 763
+#define PARSER_END_TASK_FUNCTION 764
+#define PARSER_CREATE_PORT 765
+#define PARSER_HANDLE_INLINE_PORT_ERROR 766
+#define PARSER_CREATE_SIMPLE_NUMBER 767
+#define PARSER_CREATE_COMPLEX_NUMBER 768
+#define PARSER_APPEND_SE_PORT_LIST 769
+#define PARSER_CREATE_SE_PORT_LIST 770
+#define PARSER_CREATE_UNARY_SE 771
+#define PARSER_CREATE_SYSCALL_SE 772
+#define PARSER_CREATE_UNARY_EXP 773
+#define PARSER_CREATE_BINARY_EXP 774
+#define PARSER_CREATE_OP_AND_ASSIGN_EXP 775
+#define PARSER_CREATE_SYSCALL_EXP 776
+#define PARSER_CREATE_SYSCALL_W_PARAMS_EXP 777
+#define PARSER_CREATE_OP_AND_ASSIGN_W_DIM_EXP 778
+#define PARSER_HANDLE_CASE_STATEMENT 779
+#define PARSER_HANDLE_CASE_STATEMENT_LIST 780
+#define PARSER_HANDLE_GENERATE_CASE_STATEMENT 781
+#define PARSER_HANDLE_GENERATE_CASE_STATEMENT_LIST 782
+#define VLERROR 783
+#define VLWARN 784
+#define PARSER_DEALLOC_SIG_RANGE 785
+#define PARSER_COPY_CURR_RANGE 786
+#define PARSER_COPY_RANGE_TO_CURR_RANGE 787
+#define PARSER_EXPLICITLY_SET_CURR_RANGE 788
+#define PARSER_IMPLICITLY_SET_CURR_RANGE 789
+#define PARSER_CHECK_GENERATION 790
+#define PERF_GEN_STATS 791
+#define PERF_OUTPUT_MOD_STATS 792
+#define PERF_OUTPUT_INST_REPORT_HELPER 793
+#define PERF_OUTPUT_INST_REPORT 794
+#define DEF_LOOKUP 795
+#define IS_DEFINED 796
+#define DEF_MATCH 797
+#define DEF_START 798
+#define DEFINE_MACRO 799
+#define DO_DEFINE 800
+#define DEF_IS_DONE 801
+#define DEF_FINISH 802
+#define DEF_UNDEFINE 803
+#define INCLUDE_FILENAME 804
+#define INCLUDE_LOOKUP 805
+#define PPLEXER_INCLUDE_CACHE_CLEAR 806
+#define DO_INCLUDE 807
+#define YYWRAP 808
+#define PPLEXER_TAKE_OUTPUT 809
+#define PPLEXER_TAKE_INCLUDES 810
+#define RESET_PPLEXER 811
+#define RACE_BLK_CREATE 812
+#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT_HELPER 813
+#define RACE_FIND_HEAD_STATEMENT_CONTAINING_STATEMENT 814
+#define RACE_GET_HEAD_STATEMENT 815
+#define RACE_FIND_HEAD_STATEMENT 816
+#define RACE_CALC_STMT_BLK_TYPE 817
+#define RACE_CALC_EXPR_ASSIGNMENT 818
+#define RACE_CALC_ASSIGNMENTS 819
+#define RACE_HANDLE_RACE_CONDITION 820
+#define RACE_CHECK_ASSIGNMENT_TYPES 821
+#define RACE_CHECK_ONE_BLOCK_ASSIGNMENT 822
+#define RACE_CHECK_RACE_COUNT 823
+#define RACE_CHECK_MODULES 824
+#define RACE_DB_WRITE 825
+#define RACE_DB_READ 826
+#define RACE_GET_STATS 827
+#define RACE_REPORT_SUMMARY 828
+#define RACE_REPORT_VERBOSE 829
+#define RACE_REPORT 830
+#define RACE_COLLECT_LINES 831
+#define RACE_BLK_DELETE_LIST 832
+#define RANK_CREATE_COMP_CDD_COV 833
+#define RANK_DEALLOC_COMP_CDD_COV 834
+#define RANK_CHECK_INDEX 835
+#define RANK_GATHER_SIGNAL_COV 836
+#define RANK_GATHER_COMB_COV 837
+#define RANK_GATHER_EXPRESSION_COV 838
+#define RANK_GATHER_FSM_COV 839
+#define RANK_CALC_NUM_CPS 840
+#define RANK_GATHER_COMP_CDD_COV 841
+#define RANK_READ_CDD 842
+#define RANK_SELECTED_CDD_COV 843
+#define RANK_PERFORM_WEIGHTED_SELECTION 844
+#define RANK_PERFORM_GREEDY_SORT 845
+#define RANK_COUNT_CPS 846
+#define RANK_PERFORM 847
+#define RANK_OUTPUT 848
+#define COMMAND_RANK 849
+#define REENTRANT_STACK_RESERVE 850
+#define REENTRANT_STORE_VECTOR 851
+#define REENTRANT_RESTORE_VECTOR 852
+#define REENTRANT_STORE_DATA 853
+#define REENTRANT_RESTORE_DATA 854
+#define REENTRANT_CREATE 855
+#define REENTRANT_DEALLOC 856
+#define REENTRANT_DEALLOC_ALL 857
+#define REENTRANT_CHECKPOINT_WRITE 858
+#define REENTRANT_CHECKPOINT_READ 859
+#define REENTRANT_FIND 860
+#define REPORT_PARSE_METRICS 861
+#define REPORT_PARSE_ARGS 862
+#define REPORT_GATHER_INSTANCE_STATS 863
+#define REPORT_GATHER_FUNIT_STATS 864
+#define REPORT_PRINT_HEADER 865
+#define REPORT_GENERATE 866
+#define REPORT_READ_CDD_AND_READY 867
+#define REPORT_CLOSE_CDD 868
+#define REPORT_SAVE_CDD 869
+#define REPORT_FORMAT_EXCLUSION_REASON 870
+#define REPORT_OUTPUT_EXCLUSION_REASON 871
+#define COMMAND_REPORT 872
+#define SCOPE_FIND_FUNIT_FROM_SCOPE 873
+#define SCOPE_FIND_PARAM 874
+#define SCOPE_FIND_SIGNAL 875
+#define SCOPE_FIND_TASK_FUNCTION_NAMEDBLOCK 876
+#define SCOPE_GET_PARENT_FUNIT 877
+#define SCOPE_GET_PARENT_MODULE 878
+#define SCORE_GENERATE_TOP_VPI_MODULE 879
+#define SCORE_GENERATE_TOP_DUMPVARS_MODULE 880
+#define SCORE_GENERATE_PLI_TAB_FILE 881
+#define SCORE_PARSE_DEFINE 882
+#define SCORE_PARSE_METRICS 883
+#define SCORE_PARSE_ARGS 884
+#define COMMAND_SCORE 885
+#define SEARCH_INIT 886
+#define SEARCH_ADD_INCLUDE_PATH 887
+#define SEARCH_ADD_DIRECTORY_PATH 888
+#define SEARCH_ADD_FILE 889
+#define SEARCH_ADD_NO_SCORE_FUNIT 890
+#define SEARCH_ADD_EXTENSIONS 891
+#define SEARCH_FREE_LISTS 892
+#define SIM_CURRENT_THREAD 893
+#define SIM_THREAD_POP_HEAD 894
+#define SIM_THREAD_INSERT_INTO_DELAY_QUEUE 895
+#define SIM_THREAD_PUSH 896
+#define SIM_EXPR_CHANGED 897
+#define SIM_FANOUT_CHANGED 898
+#define SIM_ALLOC_THREAD 899
+#define SIM_CREATE_THREAD 900
+#define SIM_ADD_THREAD 901
+#define SIM_KILL_THREAD 902
+#define SIM_KILL_THREAD_WITH_FUNIT 903
+#define SIM_ADD_STATICS 904
+#define SIM_EXPRESSION 905
+#define SIM_THREAD 906
+#define SIM_SIMULATE 907
+#define SIM_INITIALIZE 908
+#define SIM_STOP 909
+#define SIM_FINISH 910
+#define SIM_ADD_NONBLOCK_ASSIGN 911
+#define SIM_PERFORM_NBA 912
+#define SIM_CHECKPOINT_WRITE_THREAD 913
+#define SIM_CHECKPOINT_WRITE 914
+#define SIM_CHECKPOINT_READ_THREAD 915
+#define SIM_CHECKPOINT_READ 916
+#define SIM_DEALLOC 917
+#define STATISTIC_CREATE 918
+#define STATISTIC_IS_EMPTY 919
+#define STATISTIC_DEALLOC 920
+#define STATEMENT_CREATE 921
+#define STATEMENT_QUEUE_ADD 922
+#define STATEMENT_QUEUE_COMPARE 923
+#define STATEMENT_SIZE_ELEMENTS 924
+#define STATEMENT_DB_WRITE 925
+#define STATEMENT_DB_WRITE_TREE 926
+#define STATEMENT_DB_WRITE_EXPR_TREE 927
+#define STATEMENT_DB_READ 928
+#define STATEMENT_ASSIGN_EXPR_IDS 929
+#define STATEMENT_CONNECT 930
+#define STATEMENT_GET_LAST_LINE_HELPER 931
+#define STATEMENT_GET_LAST_LINE 932
+#define STATEMENT_FIND_RHS_SIGS 933
+#define STATEMENT_FIND_STATEMENT 934
+#define STATEMENT_FIND_STATEMENT_BY_POSITION 935
+#define STATEMENT_CONTAINS_EXPR_CALLING_STMT 936
+#define STATEMENT_ADD_TO_STMT_LINK 937
+#define STATEMENT_DEALLOC_RECURSIVE 938
+#define STATEMENT_DEALLOC 939
+#define STATIC_EXPR_GEN_UNARY 940
+#define STATIC_EXPR_GEN 941
+#define STATIC_EXPR_GEN_TERNARY 942
+#define STATIC_EXPR_CALC_LSB_AND_WIDTH_PRE 943
+#define STATIC_EXPR_CALC_LSB_AND_WIDTH_POST 944
+#define STATIC_EXPR_DEALLOC 945
+#define STMT_BLK_ADD_TO_REMOVE_LIST 946
+#define STMT_BLK_REMOVE 947
+#define STMT_BLK_SPECIFY_REMOVAL_REASON 948
+#define STRUCT_UNION_LENGTH 949
+#define STRUCT_UNION_ADD_MEMBER 950
+#define STRUCT_UNION_ADD_MEMBER_VOID 951
+#define STRUCT_UNION_ADD_MEMBER_SIG 952
+#define STRUCT_UNION_ADD_MEMBER_TYPEDEF 953
+#define STRUCT_UNION_ADD_MEMBER_ENUM 954
+#define STRUCT_UNION_ADD_MEMBER_STRUCT_UNION 955
+#define STRUCT_UNION_CREATE 956
+#define STRUCT_UNION_MEMBER_DEALLOC 957
+#define STRUCT_UNION_DEALLOC 958
+#define STRUCT_UNION_DEALLOC_LIST 959
+#define SYMTABLE_ADD_SYM_SIG 960
+#define SYMTABLE_ADD_SYM_EXP 961
+#define SYMTABLE_ADD_SYM_FSM 962
+#define SYMTABLE_INIT 963
+#define SYMTABLE_CREATE 964
+#define SYMTABLE_GET_TABLE 965
+#define SYMTABLE_ADD_SIGNAL 966
+#define SYMTABLE_ADD_EXPRESSION 967
+#define SYMTABLE_ADD_MEMORY 968
+#define SYMTABLE_ADD_FSM 969
+#define SYMTABLE_SET_VALUE 970
+#define SYMTABLE_SET_REAL 971
+#define SYMTABLE_ASSIGN 972
+#define SYMTABLE_DEALLOC 973
+#define SYS_TASK_UNIFORM 974
+#define SYS_TASK_RTL_DIST_UNIFORM 975
+#define SYS_TASK_SRANDOM 976
+#define SYS_TASK_GET_RANDOM_SEED 977
+#define SYS_TASK_RANDOM 978
+#define SYS_TASK_URANDOM 979
+#define SYS_TASK_URANDOM_RANGE 980
+#define SYS_TASK_REALTOBITS 981
+#define SYS_TASK_BITSTOREAL 982
+#define SYS_TASK_SHORTREALTOBITS 983
+#define SYS_TASK_BITSTOSHORTREAL 984
+#define SYS_TASK_ITOR 985
+#define SYS_TASK_RTOI 986
+#define SYS_TASK_STORE_PLUSARGS 987
+#define SYS_TASK_TEST_PLUSARG 988
+#define SYS_TASK_VALUE_PLUSARGS 989
+#define SYS_TASK_DEALLOC 990
+#define TCL_FUNC_GET_RACE_REASON_MSGS 991
+#define TCL_FUNC_GET_FUNIT_LIST 992
+#define TCL_FUNC_GET_INSTANCES 993
+#define TCL_FUNC_GET_INSTANCE_LIST 994
+#define TCL_FUNC_IS_FUNIT 995
+#define TCL_FUNC_GET_FUNIT 996
+#define TCL_FUNC_GET_INST 997
+#define TCL_FUNC_GET_FUNIT_NAME 998
+#define TCL_FUNC_GET_FILENAME 999
+#define TCL_FUNC_INST_SCOPE 1000
+#define TCL_FUNC_GET_FUNIT_START_AND_END 1001
+#define TCL_FUNC_COLLECT_UNCOVERED_LINES 1002
+#define TCL_FUNC_COLLECT_COVERED_LINES 1003
+#define TCL_FUNC_COLLECT_RACE_LINES 1004
+#define TCL_FUNC_COLLECT_UNCOVERED_TOGGLES 1005
+#define TCL_FUNC_COLLECT_COVERED_TOGGLES 1006
+#define TCL_FUNC_COLLECT_UNCOVERED_MEMORIES 1007
+#define TCL_FUNC_COLLECT_COVERED_MEMORIES 1008
+#define TCL_FUNC_GET_TOGGLE_COVERAGE 1009
+#define TCL_FUNC_GET_MEMORY_COVERAGE 1010
+#define TCL_FUNC_COLLECT_UNCOVERED_COMBS 1011
+#define TCL_FUNC_COLLECT_COVERED_COMBS 1012
+#define TCL_FUNC_GET_COMB_EXPRESSION 1013
+#define TCL_FUNC_GET_COMB_COVERAGE 1014
+#define TCL_FUNC_COLLECT_UNCOVERED_FSMS 1015
+#define TCL_FUNC_COLLECT_COVERED_FSMS 1016
+#define TCL_FUNC_GET_FSM_COVERAGE 1017
+#define TCL_FUNC_COLLECT_UNCOVERED_ASSERTIONS 1018
+#define TCL_FUNC_COLLECT_COVERED_ASSERTIONS 1019
+#define TCL_FUNC_GET_ASSERT_COVERAGE 1020
+#define TCL_FUNC_OPEN_CDD 1021
+#define TCL_FUNC_CLOSE_CDD 1022
+#define TCL_FUNC_SAVE_CDD 1023
+#define TCL_FUNC_MERGE_CDD 1024
+#define TCL_FUNC_GET_LINE_SUMMARY 1025
+#define TCL_FUNC_GET_TOGGLE_SUMMARY 1026
+#define TCL_FUNC_GET_MEMORY_SUMMARY 1027
+#define TCL_FUNC_GET_COMB_SUMMARY 1028
+#define TCL_FUNC_GET_FSM_SUMMARY 1029
+#define TCL_FUNC_GET_ASSERT_SUMMARY 1030
+#define TCL_FUNC_PREPROCESS_VERILOG 1031
+#define TCL_FUNC_GET_SCORE_PATH 1032
+#define TCL_FUNC_GET_INCLUDE_PATHNAME 1033
+#define TCL_FUNC_GET_GENERATION 1034
+#define TCL_FUNC_SET_LINE_EXCLUDE 1035
+#define TCL_FUNC_SET_TOGGLE_EXCLUDE 1036
+#define TCL_FUNC_SET_MEMORY_EXCLUDE 1037
+#define TCL_FUNC_SET_COMB_EXCLUDE 1038
+#define TCL_FUNC_FSM_EXCLUDE 1039
+#define TCL_FUNC_SET_ASSERT_EXCLUDE 1040
+#define TCL_FUNC_GENERATE_REPORT 1041
+#define TCL_FUNC_INITIALIZE 1042
+#define TOGGLE_GET_STATS 1043
+#define TOGGLE_COLLECT 1044
+#define TOGGLE_GET_COVERAGE 1045
+#define TOGGLE_GET_FUNIT_SUMMARY 1046
+#define TOGGLE_GET_INST_SUMMARY 1047
+#define TOGGLE_DISPLAY_INSTANCE_SUMMARY 1048
+#define TOGGLE_INSTANCE_SUMMARY 1049
+#define TOGGLE_DISPLAY_FUNIT_SUMMARY 1050
+#define TOGGLE_FUNIT_SUMMARY 1051
+#define TOGGLE_DISPLAY_VERBOSE 1052
+#define TOGGLE_INSTANCE_VERBOSE 1053
+#define TOGGLE_FUNIT_VERBOSE 1054
+#define TOGGLE_REPORT 1055
+#define TREE_ADD 1056
+#define TREE_FIND 1057
+#define TREE_REMOVE 1058
+#define TREE_DEALLOC 1059
+#define CHECK_OPTION_VALUE 1060
+#define IS_VARIABLE 1061
+#define IS_FUNC_UNIT 1062
+#define IS_LEGAL_FILENAME 1063
+#define GET_BASENAME 1064
+#define GET_DIRNAME 1065
+#define GET_ABSOLUTE_PATH 1066
+#define GET_RELATIVE_PATH 1067
+#define DIRECTORY_EXISTS 1068
+#define DIRECTORY_NAME_ADD 1069
+#define DIRECTORY_LOAD 1070
+#define FILE_EXISTS 1071
+#define UTIL_READLINE 1072
+#define GET_QUOTED_STRING 1073
+#define SUBSTITUTE_ENV_VARS 1074
+#define SCOPE_EXTRACT_FRONT 1075
+#define SCOPE_EXTRACT_BACK 1076
+#define SCOPE_EXTRACT_SCOPE 1077
+#define SCOPE_GEN_PRINTABLE 1078
+#define SCOPE_COMPARE 1079
+#define SCOPE_HASH 1080
+#define SCOPE_LOCAL 1081
+#define CONVERT_FILE_TO_MODULE 1082
+#define VFILE_INDEX_DEALLOC 1083
+#define VFILE_INDEX_CREATE 1084
+#define VFILE_INDEX_CLEAR 1085
+#define GET_NEXT_VFILE 1086
+#define GEN_SPACE 1087
+#define REMOVE_UNDERSCORES 1088
+#define GET_FUNIT_TYPE 1089
+#define CALC_MISS_PERCENT 1090
+#define READ_COMMAND_FILE 1091
+#define CONVERT_STR_TO_UINT64 1092
+#define CONVERT_STR_TO_REAL 1093
+#define CONVERT_INT_TO_STR 1094
+#define CALC_NUM_BITS_TO_STORE 1095
+#define VCD_CALC_INDEX 1096
+#define VCD_ID_HASH 1097
+#define VCD_ID_FILTER_BUILD 1098
+#define VCD_ID_FILTER_DEALLOC 1099
+#define VCD_ID_USED 1100
+#define VCD_GETCH_FETCH 1101
+#define VCD_GET_TOKEN 1102
+#define VCD_SYNC_END 1103
+#define VCD_PARSE_DEF_VAR 1104
+#define VCD_PARSE_DEF 1105
+#define VCD_PARSE_SIM_VECTOR 1106
+#define VCD_PARSE_SIM_REAL 1107
+#define VCD_SHARD_FIND_TIME 1108
+#define VCD_SHARD_INDEX 1109
+#define VCD_SHARD_START 1110
+#define VCD_PARSE_SIM 1111
+#define VCD_PARSE 1112
+#define VECTOR_GET_WRITABLE_ROW 1113
+#define VECTOR_INIT_ULONG 1114
+#define VECTOR_INT_R64 1115
+#define VECTOR_INT_R32 1116
+#define VECTOR_CREATE 1117
+#define VECTOR_COPY 1118
+#define VECTOR_COPY_RANGE 1119
+#define VECTOR_CLONE 1120
+#define VECTOR_DB_WRITE 1121
+#define VECTOR_DB_READ 1122
+#define VECTOR_DB_MERGE 1123
+#define VECTOR_MERGE 1124
+#define VECTOR_CHECKPOINT_WRITE 1125
+#define VECTOR_CHECKPOINT_READ 1126
+#define VECTOR_GET_EVAL_A 1127
+#define VECTOR_GET_EVAL_B 1128
+#define VECTOR_GET_EVAL_C 1129
+#define VECTOR_GET_EVAL_D 1130
+#define VECTOR_GET_EVAL_AB_COUNT 1131
+#define VECTOR_GET_EVAL_ABC_COUNT 1132
+#define VECTOR_GET_EVAL_ABCD_COUNT 1133
+#define VECTOR_GET_TOGGLE01_ULONG 1134
+#define VECTOR_GET_TOGGLE10_ULONG 1135
+#define VECTOR_DISPLAY_TOGGLE01_ULONG 1136
+#define VECTOR_DISPLAY_TOGGLE10_ULONG 1137
+#define VECTOR_TOGGLE_COUNT 1138
+#define VECTOR_MEM_RW_COUNT 1139
+#define VECTOR_SET_ASSIGNED 1140
+#define VECTOR_SET_COVERAGE_AND_ASSIGN 1141
+#define VECTOR_GET_SIGN_EXTEND_VECTOR_ULONG 1142
+#define VECTOR_SIGN_EXTEND_ULONG 1143
+#define VECTOR_LSHIFT_ULONG 1144
+#define VECTOR_RSHIFT_ULONG 1145
+#define VECTOR_SET_VALUE 1146
+#define VECTOR_SET_MEM_RD 1147
+#define VECTOR_PART_SELECT_PULL 1148
+#define VECTOR_PART_SELECT_PUSH 1149
+#define VECTOR_SET_UNARY_EVALS 1150
+#define VECTOR_SET_AND_COMB_EVALS 1151
+#define VECTOR_SET_OR_COMB_EVALS 1152
+#define VECTOR_SET_OTHER_COMB_EVALS 1153
+#define VECTOR_IS_UKNOWN 1154
+#define VECTOR_IS_NOT_ZERO 1155
+#define VECTOR_SET_TO_X 1156
+#define VECTOR_TO_INT 1157
+#define VECTOR_TO_UINT64 1158
+#define VECTOR_TO_REAL64 1159
+#define VECTOR_TO_SIM_TIME 1160
+#define VECTOR_FROM_INT 1161
+#define VECTOR_FROM_UINT64 1162
+#define VECTOR_FROM_REAL64 1163
+#define VECTOR_SET_STATIC 1164
+#define VECTOR_TO_STRING 1165
+#define VECTOR_FROM_STRING_FIXED 1166
+#define VECTOR_FROM_STRING 1167
+#define VECTOR_CHANGED_RANGE 1168
+#define VECTOR_VCD_ASSIGN 1169
+#define VECTOR_VCD_ASSIGN_REAL 1170
+#define VECTOR_VCD_ASSIGN2 1171
+#define VECTOR_BITWISE_AND_OP 1172
+#define VECTOR_BITWISE_NAND_OP 1173
+#define VECTOR_BITWISE_OR_OP 1174
+#define VECTOR_BITWISE_NOR_OP 1175
+#define VECTOR_BITWISE_XOR_OP 1176
+#define VECTOR_BITWISE_NXOR_OP 1177
+#define VECTOR_OP_LT 1178
+#define VECTOR_OP_LE 1179
+#define VECTOR_OP_GT 1180
+#define VECTOR_OP_GE 1181
+#define VECTOR_OP_EQ 1182
+#define VECTOR_CEQ_ULONG 1183
+#define VECTOR_HASH_ULONG 1184
+#define VECTOR_OP_CEQ 1185
+#define VECTOR_OP_CXEQ 1186
+#define VECTOR_OP_CZEQ 1187
+#define VECTOR_OP_NE 1188
+#define VECTOR_OP_CNE 1189
+#define VECTOR_OP_LOR 1190
+#define VECTOR_OP_LAND 1191
+#define VECTOR_OP_LSHIFT 1192
+#define VECTOR_OP_RSHIFT 1193
+#define VECTOR_OP_ARSHIFT 1194
+#define VECTOR_OP_ADD 1195
+#define VECTOR_OP_NEGATE 1196
+#define VECTOR_OP_SUBTRACT 1197
+#define VECTOR_OP_MULTIPLY 1198
+#define VECTOR_OP_DIVIDE 1199
+#define VECTOR_OP_MODULUS 1200
+#define VECTOR_OP_INC 1201
+#define VECTOR_OP_DEC 1202
+#define VECTOR_UNARY_INV 1203
+#define VECTOR_UNARY_AND 1204
+#define VECTOR_UNARY_NAND 1205
+#define VECTOR_UNARY_OR 1206
+#define VECTOR_UNARY_NOR 1207
+#define VECTOR_UNARY_XOR 1208
+#define VECTOR_UNARY_NXOR 1209
+#define VECTOR_UNARY_NOT 1210
+#define VECTOR_OP_EXPAND 1211
+#define VECTOR_OP_LIST 1212
+#define VECTOR_OP_CLOG2 1213
+#define VECTOR_DEALLOC_VALUE 1214
+#define VECTOR_DEALLOC 1215
+#define SYM_VALUE_STORE 1216
+#define ADD_SYM_VALUES_TO_SIM 1217
+#define COVERED_ROSYNCH 1218
+#define COVERED_VALUE_CHANGE_BIN 1219
+#define COVERED_VALUE_CHANGE_REAL 1220
+#define COVERED_END_OF_SIM 1221
+#define COVERED_CB_ERROR_HANDLER 1222
+#define GEN_NEXT_SYMBOL 1223
+#define COVERED_CREATE_VALUE_CHANGE_CB 1224
+#define COVERED_PARSE_TASK_FUNC 1225
+#define COVERED_PARSE_SIGNALS 1226
+#define COVERED_PARSE_INSTANCE 1227
+#define COVERED_SIM_CALLTF 1228
+#define COVERED_REGISTER 1229
+#define VSIGNAL_INIT 1230
+#define VSIGNAL_CREATE 1231
+#define VSIGNAL_DEALLOC_FANOUTS 1232
+#define VSIGNAL_CREATE_VEC 1233
+#define VSIGNAL_DUPLICATE 1234
+#define VSIGNAL_DB_WRITE 1235
+#define VSIGNAL_DB_READ 1236
+#define VSIGNAL_DB_MERGE 1237
+#define VSIGNAL_MERGE 1238
+#define VSIGNAL_FANOUT_RANGE 1239
+#define VSIGNAL_CREATE_FANOUTS 1240
+#define VSIGNAL_PROPAGATE_RANGE 1241
+#define VSIGNAL_PROPAGATE 1242
+#define VSIGNAL_MARK_CHANGED 1243
+#define VSIGNAL_VCD_ASSIGN 1244
+#define VSIGNAL_VCD_ASSIGN_REAL 1245
+#define VSIGNAL_ADD_EXPRESSION 1246
+#define VSIGNAL_FROM_STRING 1247
+#define VSIGNAL_CALC_WIDTH_FOR_EXPR 1248
+#define VSIGNAL_CALC_LSB_FOR_EXPR 1249
+#define VSIGNAL_DEALLOC 1250
+#define PPCACHE_READ_FILE 1251
+#define PPCACHE_HASH_FILE 1252
+#define PPCACHE_ENTRY_NAME 1253
+#define PPCACHE_RESOLVE_INCLUDE 1254
+#define PPCACHE_CHECK_INCLUDE 1255
+#define PPCACHE_LOAD_ENTRY 1256
+#define PPCACHE_LOOKUP 1257
+#define PPCACHE_STORE 1258
+#define DUMPPIPE_CONSUME 1259
+#define DUMPPIPE_RUN 1260
+#define CHECKPOINT_WRITE_DATA 1261
+#define CHECKPOINT_READ_DATA 1262
+#define CHECKPOINT_PTR_MAP_CREATE 1263
+#define CHECKPOINT_PTR_MAP_FIND 1264
+#define CHECKPOINT_FUNITS_CREATE 1265
+#define CHECKPOINT_FUNITS_DEALLOC 1266
+#define CHECKPOINT_WRITE_FUNIT 1267
+#define CHECKPOINT_READ_FUNIT 1268
+#define CHECKPOINT_EXPRESSION_DIM 1269
+#define CHECKPOINT_WRITE_EXPRESSION 1270
+#define CHECKPOINT_READ_EXPRESSION 1271
+#define CHECKPOINT_WRITE_FSM 1272
+#define CHECKPOINT_READ_FSM 1273
+#define CHECKPOINT_WRITE_DESIGN 1274
+#define CHECKPOINT_READ_DESIGN 1275
+#define CHECKPOINT_DUE 1276
+#define CHECKPOINT_WRITE 1277
+#define CHECKPOINT_READ_HEADER 1278
+#define CHECKPOINT_INITIALIZE 1279
+#define SHARD_FORK 1280
+#define SHARD_STARTED 1281
+#define SHARD_DB_NAME 1282
+#define SHARD_EXIT 1283
+#define SHARD_DEALLOC 1284
+#define SHARD_MERGE 1285
+#define SHARD_ABORT 1286
 
 extern profiler profiles[NUM_PROFILES];
 #endif
@@ -41,7 +41,7 @@ unsigned int             flag_global_generation      = GENERATION_SV;
 int                      generate_expr_mode          = 0;
 bool                     cli_debug_mode              = FALSE;
 bool                     flag_use_command_line_debug = FALSE;
-struct exception_context the_exception_context[1];
+THREAD_LOCAL struct exception_context the_exception_context[1];
 str_link*                merge_in_head               = NULL;
 str_link*                merge_in_tail               = NULL;
 char*                    cdd_message                 = NULL;
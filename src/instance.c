@@ -486,87 +486,284 @@ static funit_inst* instance_find_by_funit_name_if_one(
 }
 
 /*!
- \return Returns the pointer to the signal that contains the same exclusion ID.
+ Counts the number of signals, expressions and FSM tables in the given instance tree (used to size the
+ exclusion ID index arrays).
+*/
+static void instance_count_exclusion_ids(
+            funit_inst*   root,      /*!< Pointer to root instance */
+  /*@out@*/ unsigned int* sig_num,   /*!< Incremented by the number of signals found */
+  /*@out@*/ unsigned int* exp_num,   /*!< Incremented by the number of expressions found */
+  /*@out@*/ unsigned int* fsm_num    /*!< Incremented by the number of FSM tables found */
+) { PROFILE(INSTANCE_COUNT_EXCLUSION_IDS);
+
+  funit_inst* child;
+
+  if( root->funit != NULL ) {
+    *sig_num += root->funit->sig_size;
+    *exp_num += root->funit->exp_size;
+    *fsm_num += root->funit->fsm_size;
+  }
+
+  child = root->child_head;
+  while( child != NULL ) {
+    instance_count_exclusion_ids( child, sig_num, exp_num, fsm_num );
+    child = child->next;
+  }
+
+  PROFILE_END;
 
- Recursively searches the given instance tree to find the signal that has the same
- exclusion ID as the one specified.
+}
+
+/*!
+ Adds the exclusion IDs of all signals, expressions and FSM tables in the given instance tree to the
+ given index.  The instance tree is traversed in the same order that it was previously searched so that
+ the order field of each entry reflects which object would have been found first.
 */
-vsignal* instance_find_signal_by_exclusion_id(
-            funit_inst* root,        /*!< Pointer to root instance */
-            int         id,          /*!< Exclusion ID to search for */
-  /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing this signal */
-) { PROFILE(INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID);
- 
-  vsignal* sig = NULL;  /* Pointer to found signal */
+static void instance_gather_exclusion_ids(
+            funit_inst*   root,   /*!< Pointer to root instance */
+            excl_index*   index,  /*!< Pointer to exclusion ID index to populate */
+  /*@out@*/ unsigned int* order   /*!< Running count of entries added to the index */
+) { PROFILE(INSTANCE_GATHER_EXCLUSION_IDS);
 
-  if( root != NULL ) {
+  funit_inst* child;
 
-    if( (root->funit != NULL) &&
-        (root->funit->sigs != NULL) &&
-        (root->funit->sigs[0]->id <= id) &&
-        (root->funit->sigs[root->funit->sig_size-1]->id >= id) ) {
+  if( root->funit != NULL ) {
 
-      unsigned int i = 0;
+    func_unit*   funit = root->funit;
+    unsigned int i;
 
-      while( (i < root->funit->sig_size) && (root->funit->sigs[i]->id != id) ) i++;
-      assert( i < root->funit->sig_size );
-      sig          = root->funit->sigs[i];
-      *found_funit = root->funit;
+    for( i=0; i<funit->sig_size; i++ ) {
+      excl_id* entry = &(index->sigs[index->sig_num++]);
+      entry->id    = funit->sigs[i]->id;
+      entry->num   = 1;
+      entry->order = (*order)++;
+      entry->obj   = funit->sigs[i];
+      entry->funit = funit;
+    }
 
-    } else {
+    for( i=0; i<funit->exp_size; i++ ) {
+      excl_id* entry = &(index->exps[index->exp_num++]);
+      entry->id    = funit->exps[i]->id;
+      entry->num   = 1;
+      entry->order = (*order)++;
+      entry->obj   = funit->exps[i];
+      entry->funit = funit;
+    }
 
-      funit_inst* child = root->child_head;
-      while( (child != NULL) && ((sig = instance_find_signal_by_exclusion_id( child, id, found_funit )) == NULL) ) {
-        child = child->next;
+    for( i=0; i<funit->fsm_size; i++ ) {
+      fsm_table* table = funit->fsms[i]->table;
+      if( table->num_arcs > 0 ) {
+        excl_id* entry = &(index->arcs[index->arc_num++]);
+        entry->id    = table->id;
+        entry->num   = table->num_arcs;
+        entry->order = (*order)++;
+        entry->obj   = table;
+        entry->funit = funit;
       }
-
     }
-    
+
+  }
+
+  child = root->child_head;
+  while( child != NULL ) {
+    instance_gather_exclusion_ids( child, index, order );
+    child = child->next;
   }
 
   PROFILE_END;
 
-  return( sig );
+}
+
+/*!
+ \return Returns a negative value, zero or a positive value if the left entry should be placed before,
+         at the same place or after the right entry in an exclusion ID index.
+*/
+static int instance_compare_exclusion_ids(
+  const void* left,  /*!< Pointer to left excl_id entry */
+  const void* right  /*!< Pointer to right excl_id entry */
+) {
+
+  const excl_id* l = (const excl_id*)left;
+  const excl_id* r = (const excl_id*)right;
+
+  if( l->id != r->id ) {
+    return( (l->id < r->id) ? -1 : 1 );
+  }
+
+  return( (l->order < r->order) ? -1 : ((l->order > r->order) ? 1 : 0) );
 
 }
 
 /*!
- \return Returns the pointer to the expression that contains the same exclusion ID. 
-                                        
- Recursively searches the given instance tree to find the expression that has the same
- exclusion ID as the one specified.
+ \return Returns the number of entries remaining in the given array.
+
+ Sorts the given exclusion ID array and removes all entries that duplicate the ID of a previous entry
+ (the same functional unit may be instantiated many times).
 */
-expression* instance_find_expression_by_exclusion_id(
-            funit_inst* root,        /*!< Pointer to root instance */
-            int         id,          /*!< Exclusion ID to search for */
-  /*@out@*/ func_unit** found_funit  /*!< Pointer to functional unit containing this expression */
-) { PROFILE(INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID); 
-    
-  expression* exp = NULL;  /* Pointer to found expression */
-    
-  if( root != NULL ) {
+static unsigned int instance_sort_exclusion_ids(
+  excl_id*     ids,  /*!< Array of exclusion ID entries to sort */
+  unsigned int num   /*!< Number of entries in the array */
+) { PROFILE(INSTANCE_SORT_EXCLUSION_IDS);
 
-    if( (root->funit != NULL) &&
-        (root->funit->exps != NULL) && 
-        (root->funit->exps[0]->id <= id) && 
-        (root->funit->exps[root->funit->exp_size-1]->id >= id) ) {
+  unsigned int i;
+  unsigned int j = 0;
 
-      unsigned int i = 0;
+  if( num > 1 ) {
+    qsort( ids, num, sizeof( excl_id ), instance_compare_exclusion_ids );
+  }
 
-      while( (i < root->funit->exp_size) && (root->funit->exps[i]->id != id) ) i++;
-      assert( i < root->funit->exp_size );
-      exp          = root->funit->exps[i];
-      *found_funit = root->funit;
+  for( i=0; i<num; i++ ) {
+    if( (j == 0) || (ids[j-1].id != ids[i].id) ) {
+      ids[j++] = ids[i];
+    }
+  }
 
-    } else {
+  PROFILE_END;
 
-      funit_inst* child = root->child_head;
-      while( (child != NULL) && ((exp = instance_find_expression_by_exclusion_id( child, id, found_funit )) == NULL) ) {
-        child = child->next;
-      }
+  return( j );
 
+}
+
+/*!
+ \return Returns a pointer to the entry in the given sorted array with the greatest ID that is less than
+         or equal to the given ID if one exists; otherwise, returns NULL.
+*/
+static const excl_id* instance_search_exclusion_ids(
+  const excl_id* ids,  /*!< Sorted array of exclusion ID entries to search */
+  unsigned int   num,  /*!< Number of entries in the array */
+  int            id    /*!< Exclusion ID to search for */
+) { PROFILE(INSTANCE_SEARCH_EXCLUSION_IDS);
+
+  unsigned int lo = 0;
+  unsigned int hi = num;
+
+  while( lo < hi ) {
+    unsigned int mid = lo + ((hi - lo) / 2);
+    if( ids[mid].id <= id ) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
+  }
+
+  PROFILE_END;
+
+  return( (lo == 0) ? NULL : &(ids[lo - 1]) );
+
+}
+
+/*!
+ \return Returns a pointer to the newly created exclusion ID index for the given list of instance trees.
+
+ Gathers the exclusion IDs of all signals, expressions and FSM state transitions found in the given instance
+ trees into sorted arrays so that each exclusion ID can be resolved without searching the instance trees.
+*/
+excl_index* instance_exclusion_index_create(
+  inst_link* head  /*!< Pointer to head of instance tree list to index */
+) { PROFILE(INSTANCE_EXCLUSION_INDEX_CREATE);
+
+  excl_index*  index   = (excl_index*)malloc_safe( sizeof( excl_index ) );
+  unsigned int sig_num = 0;
+  unsigned int exp_num = 0;
+  unsigned int fsm_num = 0;
+  unsigned int order   = 0;
+  inst_link*   instl;
+
+  instl = head;
+  while( instl != NULL ) {
+    instance_count_exclusion_ids( instl->inst, &sig_num, &exp_num, &fsm_num );
+    instl = instl->next;
+  }
+
+  index->sigs    = (sig_num > 0) ? (excl_id*)malloc_safe_nolimit( sizeof( excl_id ) * sig_num ) : NULL;
+  index->sig_num = 0;
+  index->exps    = (exp_num > 0) ? (excl_id*)malloc_safe_nolimit( sizeof( excl_id ) * exp_num ) : NULL;
+  index->exp_num = 0;
+  index->arcs    = (fsm_num > 0) ? (excl_id*)malloc_safe_nolimit( sizeof( excl_id ) * fsm_num ) : NULL;
+  index->arc_num = 0;
+
+  instl = head;
+  while( instl != NULL ) {
+    instance_gather_exclusion_ids( instl->inst, index, &order );
+    instl = instl->next;
+  }
+
+  /* Sort the arrays and shrink them to the number of unique IDs */
+  index->sig_num = instance_sort_exclusion_ids( index->sigs, index->sig_num );
+  index->sigs    = (excl_id*)realloc_safe_nolimit( index->sigs, (sizeof( excl_id ) * sig_num), (sizeof( excl_id ) * index->sig_num) );
+  index->exp_num = instance_sort_exclusion_ids( index->exps, index->exp_num );
+  index->exps    = (excl_id*)realloc_safe_nolimit( index->exps, (sizeof( excl_id ) * exp_num), (sizeof( excl_id ) * index->exp_num) );
+  index->arc_num = instance_sort_exclusion_ids( index->arcs, index->arc_num );
+  index->arcs    = (excl_id*)realloc_safe_nolimit( index->arcs, (sizeof( excl_id ) * fsm_num), (sizeof( excl_id ) * index->arc_num) );
+
+  PROFILE_END;
+
+  return( index );
+
+}
+
+/*!
+ Deallocates all memory associated with the given exclusion ID index.
+*/
+void instance_exclusion_index_dealloc(
+  excl_index* index  /*!< Pointer to exclusion ID index to deallocate */
+) { PROFILE(INSTANCE_EXCLUSION_INDEX_DEALLOC);
+
+  if( index != NULL ) {
+    free_safe( index->sigs, (sizeof( excl_id ) * index->sig_num) );
+    free_safe( index->exps, (sizeof( excl_id ) * index->exp_num) );
+    free_safe( index->arcs, (sizeof( excl_id ) * index->arc_num) );
+    free_safe( index, sizeof( excl_index ) );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the pointer to the signal that contains the same exclusion ID.
+
+ Searches the given exclusion ID index to find the signal that has the same exclusion ID as the one
+ specified.
+*/
+vsignal* instance_find_signal_by_exclusion_id(
+            const excl_index* index,       /*!< Pointer to exclusion ID index */
+            int               id,          /*!< Exclusion ID to search for */
+  /*@out@*/ func_unit**       found_funit  /*!< Pointer to functional unit containing this signal */
+) { PROFILE(INSTANCE_FIND_SIGNAL_BY_EXCLUSION_ID);
+ 
+  vsignal*       sig   = NULL;  /* Pointer to found signal */
+  const excl_id* entry = instance_search_exclusion_ids( index->sigs, index->sig_num, id );
+
+  if( (entry != NULL) && (entry->id == id) ) {
+    sig          = (vsignal*)entry->obj;
+    *found_funit = entry->funit;
+  }
+
+  PROFILE_END;
+
+  return( sig );
+
+}
+
+/*!
+ \return Returns the pointer to the expression that contains the same exclusion ID. 
+                                        
+ Searches the given exclusion ID index to find the expression that has the same exclusion ID as the one
+ specified.
+*/
+expression* instance_find_expression_by_exclusion_id(
+            const excl_index* index,       /*!< Pointer to exclusion ID index */
+            int               id,          /*!< Exclusion ID to search for */
+  /*@out@*/ func_unit**       found_funit  /*!< Pointer to functional unit containing this expression */
+) { PROFILE(INSTANCE_FIND_EXPRESSION_BY_EXCLUSION_ID); 
     
+  expression*    exp   = NULL;  /* Pointer to found expression */
+  const excl_id* entry = instance_search_exclusion_ids( index->exps, index->exp_num, id );
+
+  if( (entry != NULL) && (entry->id == id) ) {
+    exp          = (expression*)entry->obj;
+    *found_funit = entry->funit;
   }
   
   PROFILE_END; 
@@ -580,32 +777,18 @@ expression* instance_find_expression_by_exclusion_id(
          given exclusion ID (if one is found); otherwise, returns -1.
 */
 int instance_find_fsm_arc_index_by_exclusion_id(
-            funit_inst* root,
-            int         id,
-  /*@out@*/ fsm_table** found_fsm,
-  /*@out@*/ func_unit** found_funit
+            const excl_index* index,       /*!< Pointer to exclusion ID index */
+            int               id,          /*!< Exclusion ID to search for */
+  /*@out@*/ fsm_table**       found_fsm,   /*!< Pointer to FSM table containing the state transition */
+  /*@out@*/ func_unit**       found_funit  /*!< Pointer to functional unit containing the FSM table */
 ) { PROFILE(INSTANCE_FIND_FSM_ARC_INDEX_BY_EXCLUSION_ID);
 
-  int arc_index = -1;  /* Index of found FSM arc */
-
-  if( root != NULL ) {
-
-    unsigned int i = 0;
-
-    if( root->funit != NULL ) {
-      while( (i < root->funit->fsm_size) && ((arc_index = arc_find_arc_by_exclusion_id( root->funit->fsms[i]->table, id )) == -1) ) i++;
-    }
-
-    if( arc_index != -1 ) {
-      *found_fsm   = root->funit->fsms[i]->table;
-      *found_funit = root->funit;
-    } else {
-      funit_inst* child = root->child_head;
-      while( (child != NULL) && ((arc_index = instance_find_fsm_arc_index_by_exclusion_id( child, id, found_fsm, found_funit )) == -1) ) {
-        child = child->next;
-      }
-    }
+  int            arc_index = -1;  /* Index of found FSM arc */
+  const excl_id* entry     = instance_search_exclusion_ids( index->arcs, index->arc_num, id );
 
+  if( (entry != NULL) && ((arc_index = arc_find_arc_by_exclusion_id( (fsm_table*)entry->obj, id )) != -1) ) {
+    *found_fsm   = (fsm_table*)entry->obj;
+    *found_funit = entry->funit;
   }
 
   PROFILE_END;
@@ -76,26 +76,36 @@ funit_inst* instance_find_by_funit(
   /*@out@*/ int*             ignore
 );
 
+/*! \brief Creates an exclusion ID index for the given list of instance trees */
+excl_index* instance_exclusion_index_create(
+  inst_link* head
+);
+
+/*! \brief Deallocates the given exclusion ID index */
+void instance_exclusion_index_dealloc(
+  excl_index* index
+);
+
 /*! \brief Returns signal that matches the given exclusion ID */
 vsignal* instance_find_signal_by_exclusion_id(
-            funit_inst* root,
-            int         id,
-  /*@out@*/ func_unit** found_funit
+            const excl_index* index,
+            int               id,
+  /*@out@*/ func_unit**       found_funit
 );
 
 /*! \brief Returns expression that matches the given exclusion ID */
 expression* instance_find_expression_by_exclusion_id(
-            funit_inst* root,
-            int         id,
-  /*@out@*/ func_unit** found_funit
+            const excl_index* index,
+            int               id,
+  /*@out@*/ func_unit**       found_funit
 );
 
 /*! \brief Returns FSM that matches the given exclusion ID */
 int instance_find_fsm_arc_index_by_exclusion_id(
-            funit_inst* root,
-            int         id,
-  /*@out@*/ fsm_table** found_fsm,
-  /*@out@*/ func_unit** found_funit
+            const excl_index* index,
+            int               id,
+  /*@out@*/ fsm_table**       found_fsm,
+  /*@out@*/ func_unit**       found_funit
 );
 
 /*! \brief Copies the given from_inst as a child of the given to_inst */
@@ -29,6 +29,7 @@
 #include "lxt2_read.h"
 #include "symtable.h"
 #include "db.h"
+#include "dumppipe.h"
 #include "util.h"
 
 
@@ -38,6 +39,10 @@ extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
 extern char**     curr_inst_scope;
 extern int        curr_inst_scope_size;
+extern uint64     score_start_time;
+extern uint64     score_end_time;
+extern bool       checkpoint_resumed;
+extern uint64     checkpoint_resume_time;
 
 
 /*! Specifies the last timestamp simulated */
@@ -46,6 +51,9 @@ static lxtint64_t vcd_prevtime = 0;
 /*! Specifies the vcd_prevtime value has been assigned by the simulator */
 static bool vcd_prevtime_valid = FALSE;
 
+/*! Specifies that the remaining value changes are not simulated */
+static bool vcd_done = FALSE;
+
 /*! Specifies when we are handling dumping */
 static bool vcd_blackout;
 
@@ -76,7 +84,7 @@ static char* vcdid(
 }
 
 /*!
- \throws anonymous db_do_timestep
+ \throws anonymous db_do_dump_timestep
 */
 static void vcd_callback(
   struct lxt2_rd_trace** lt,
@@ -87,10 +95,15 @@ static void vcd_callback(
 
   struct lxt2_rd_geometry *g = lxt2_rd_get_fac_geometry( *lt, *pnt_facidx );
 
+  /* Value changes up to the checkpoint that we resumed from have already been simulated */
+  bool skip = checkpoint_resumed && (*pnt_time <= checkpoint_resume_time);
+
   /* If this is a new timestamp, perform a simulation */
-  if( (vcd_prevtime != *pnt_time) || !vcd_prevtime_valid ) {
+  if( !skip && !vcd_done && ((vcd_prevtime != *pnt_time) || !vcd_prevtime_valid) ) {
     if( vcd_prevtime_valid ) {
-      (void)db_do_timestep( vcd_prevtime, FALSE );
+      vcd_done = !db_do_dump_timestep( vcd_prevtime, *pnt_time, 0 );
+    } else {
+      vcd_done = (*pnt_time > score_end_time);
     }
     vcd_prevtime       = *pnt_time;
     vcd_prevtime_valid = TRUE;
@@ -108,7 +121,11 @@ static void vcd_callback(
     }	
   }
 
-  if( g->flags & LXT2_RD_SYM_F_DOUBLE ) {
+  if( vcd_done || skip ) {
+
+    /* The value changes after the end of simulation are ignored */
+
+  } else if( g->flags & LXT2_RD_SYM_F_DOUBLE ) {
 
     db_set_symbol_string( vcdid( *pnt_facidx ), *pnt_value );
 
@@ -131,7 +148,40 @@ static void vcd_callback(
 }
 
 /*!
- \throws anonymous db_do_timestep Throw Throw Throw lxt2_rd_iter_blocks
+ \throws anonymous db_do_dump_timestep lxt2_rd_iter_blocks
+
+ Reads all value changes from the LXT file, simulating each timestep.
+*/
+static void lxt_simulate(
+  void* lt  /*!< Pointer to LXT read structure */
+) { PROFILE(LXT_SIMULATE);
+
+  uint64 start_time = score_start_time;
+
+  /* When resuming from a checkpoint, only the timesteps after it need to be read */
+  if( checkpoint_resumed && (start_time <= checkpoint_resume_time) ) {
+    start_time = checkpoint_resume_time + 1;
+  }
+
+  /* Skip the blocks that are entirely outside of the scored time window */
+  if( (start_time > 0) || (score_end_time != 0xffffffffffffffffLL) ) {
+    (void)lxt2_rd_limit_time_range( (struct lxt2_rd_trace*)lt, start_time, score_end_time );
+  }
+
+  /* Perform simulation */
+  (void)lxt2_rd_iter_blocks( (struct lxt2_rd_trace*)lt, vcd_callback, NULL );
+
+  /* Perform last simulation if necessary */
+  if( vcd_prevtime_valid && !vcd_done ) {
+    (void)db_do_dump_timestep( vcd_prevtime, 0xffffffffffffffffLL, 0 );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw Throw Throw dumppipe_run
 
  Main LXT parsing function.  Reads in an LXT-style dumpfile, tells Covered about signal information
  and simulation results.
@@ -153,7 +203,7 @@ void lxt_parse(
 
     numfacs = lxt2_rd_get_num_facs( lt );
 
-    (void)lxt2_rd_set_fac_process_mask_all( lt );
+    (void)lxt2_rd_clr_fac_process_mask_all( lt );
     (void)lxt2_rd_set_max_block_mem_usage( lt, 0 ); /* no need to cache blocks */
 
     /* Create initial symbol table */
@@ -169,6 +219,8 @@ void lxt_parse(
       /* Get symbol information */
       for( i=0; i<numfacs; i++ ) {
 
+        bool bound = FALSE;  /* Set to TRUE if the symbol is used by the design */
+
         g       = lxt2_rd_get_fac_geometry( lt, i );
         newindx = lxt2_rd_get_alias_root( lt, i );
 
@@ -182,7 +234,7 @@ void lxt_parse(
 
         if( g->flags & LXT2_RD_SYM_F_DOUBLE ) {
 
-          db_assign_symbol( netname, vcdid( newindx ), 63, 0 );
+          bound = db_assign_symbol( netname, vcdid( newindx ), 63, 0 );
 
         } else if( g->flags & LXT2_RD_SYM_F_STRING ) {
 
@@ -192,16 +244,21 @@ void lxt_parse(
 
           if( g->len == 1 ) {
             if( g->msb != 0 ) {
-              db_assign_symbol( netname, vcdid( newindx ), g->msb, g->msb );
+              bound = db_assign_symbol( netname, vcdid( newindx ), g->msb, g->msb );
             } else {
-              db_assign_symbol( netname, vcdid( newindx ), 0, 0 );
+              bound = db_assign_symbol( netname, vcdid( newindx ), 0, 0 );
             }
           } else {
-            db_assign_symbol( netname, vcdid( newindx ), g->msb, g->lsb );
+            bound = db_assign_symbol( netname, vcdid( newindx ), g->msb, g->lsb );
           }
 
         }
 
+        /* Only read the value changes of facilities that are used by the design */
+        if( bound ) {
+          (void)lxt2_rd_set_fac_process_mask( lt, newindx );
+        }
+
       }
 
       /* Check to see that at least one instance was found */
@@ -213,12 +270,7 @@ void lxt_parse(
       }
 
       /* Perform simulation */
-      (void)lxt2_rd_iter_blocks( lt, vcd_callback, NULL );
-
-      /* Perform last simulation if necessary */
-      if( vcd_prevtime_valid ) {
-        (void)db_do_timestep( vcd_prevtime, FALSE );
-      }
+      dumppipe_run( lxt_simulate, lt );
 
     } Catch_anonymous {
       assert( curr_inst_scope_size == 1 );
@@ -46,7 +46,7 @@
 /*!
  Exception context structure used by cexcept.h for throwing and catching exceptions.
 */
-struct exception_context the_exception_context[1];
+THREAD_LOCAL struct exception_context the_exception_context[1];
 
 
 extern char  user_msg[USER_MSG_LENGTH];
@@ -24,6 +24,7 @@
 #include <unistd.h>
 
 #include "binding.h"
+#include "checkpoint.h"
 #include "db.h"
 #include "defines.h"
 #include "fsm_var.h"
@@ -36,6 +37,7 @@
 #include "parser_misc.h"
 #include "race.h"
 #include "score.h"
+#include "shard.h"
 #include "sim.h"
 #include "stmt_blk.h"
 #include "util.h"
@@ -55,9 +57,9 @@ extern sig_range curr_prange;
 extern sig_range curr_urange;
 extern bool      instance_specified;
 extern char*     top_module;
-extern char*     ppfilename;
 extern bool      debug_mode;
 extern char*     dumpvars_file;
+extern int       shard_id;
 
 /*!
  \return Returns the number of characters read from this line.
@@ -119,7 +121,7 @@ void parse_design(
 
       Try {
 
-        /* Parse the design -- if we catch an exception, remove the temporary ppfilename */
+        /* Parse the design */
         parser_ret = VLparse();
 
         if( (parser_ret != 0) || (error_count > 0) ) {
@@ -128,7 +130,6 @@ void parse_design(
         }
 
       } Catch_anonymous {
-        (void)unlink( ppfilename );
         parser_dealloc_sig_range( &curr_urange, FALSE );
         parser_dealloc_sig_range( &curr_prange, FALSE );
         Throw 0;
@@ -272,6 +273,9 @@ void parse_and_score_dumpfile(
 
     /* Read in contents of specified database file */
     (void)db_read( db, READ_MODE_NO_MERGE );
+
+    /* Mark the 2-state signals that were parsed in this run (must be done before the expressions are bound to them) */
+    db_mark_2state_signals();
   
     /* Bind expressions to signals/functional units */
     bind_perform( TRUE, 0 );
@@ -281,6 +285,9 @@ void parse_and_score_dumpfile(
       sim_initialize();
     }
 
+    /* Restore the simulation state if we are resuming from a checkpoint */
+    checkpoint_initialize( dump_file, dump_mode );
+
 #ifdef DEBUG_MODE
     if( debug_mode ) {
       unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "========  Reading in VCD dumpfile %s  ========\n", dump_file );
@@ -299,25 +306,45 @@ void parse_and_score_dumpfile(
                 (dump_mode == DUMP_FMT_LXT) ||
                 (dump_mode == DUMP_FMT_FST) );
     }
-    
-    /* Flush any pending statement trees that are waiting for delay */
-    (void)db_do_timestep( 0, TRUE );
+
+    /* If the dumpfile was scored in shards by other processes, this process did not simulate anything */
+    if( !shard_started() ) {
+
+      /* Flush any pending statement trees that are waiting for delay */
+      (void)db_do_timestep( 0, TRUE );
 
 #ifdef DEBUG_MODE
-    if( debug_mode ) {
-      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "========  Writing database %s  ========\n", db );
-      assert( rv < USER_MSG_LENGTH );
-      print_output( user_msg, DEBUG, __FILE__, __LINE__ );
-    }
+      if( debug_mode ) {
+        unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "========  Writing database %s  ========\n", db );
+        assert( rv < USER_MSG_LENGTH );
+        print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+      }
 #endif
 
-    /* Indicate that this CDD contains scored information */
-    info_set_scored();
+      /* Indicate that this CDD contains scored information */
+      info_set_scored();
 
-    /* Write contents to database file */
-    db_write( db, FALSE, FALSE );
+      /* Write contents to database file (a shard process writes its own CDD file) */
+      if( shard_id >= 0 ) {
+        char* shard_db = shard_db_name( db, shard_id );
+        Try {
+          db_write( shard_db, FALSE, FALSE );
+        } Catch_anonymous {
+          free_safe( shard_db, (strlen( shard_db ) + 1) );
+          Throw 0;
+        }
+        free_safe( shard_db, (strlen( shard_db ) + 1) );
+      } else {
+        db_write( db, FALSE, FALSE );
+      }
+
+    }
 
   } Catch_anonymous {
+    if( shard_id >= 0 ) {
+      shard_exit( TRUE );
+    }
+    shard_abort( db );
     sim_dealloc();
     Throw 0;
   }
@@ -325,6 +352,16 @@ void parse_and_score_dumpfile(
   /* Deallocate simulator stuff */
   sim_dealloc();
 
+  /* A shard process is done once its CDD file is written */
+  if( shard_id >= 0 ) {
+    shard_exit( FALSE );
+  }
+
+  /* Merge the coverage of the shards into the output CDD file */
+  if( shard_started() ) {
+    shard_merge( db );
+  }
+
   PROFILE_END;
 
 }
@@ -149,6 +149,11 @@ bool curr_handled = TRUE;
 */
 bool curr_mba = FALSE;
 
+/*!
+ Specifies if the current register variable list is of a 2-state type (bit, byte, int, etc.).
+*/
+bool curr_2state = FALSE;
+
 /*!
  Specifies if current range should be flagged as packed or not.
 */
@@ -521,7 +526,7 @@ description
     {
       str_link* strl = $2;
       while( strl != NULL ) {
-        db_add_signal( strl->str, SSUPPL_TYPE_DECL_REG, &curr_prange, NULL, curr_signed, FALSE, strl->suppl, strl->suppl2, TRUE );
+        db_add_signal( strl->str, SSUPPL_TYPE_DECL_REG, &curr_prange, NULL, curr_signed, FALSE, FALSE, strl->suppl, strl->suppl2, TRUE );
         strl = strl->next;
       }
       str_link_delete_list( $2 );
@@ -609,7 +614,7 @@ list_of_port_declarations
   | list_of_port_declarations ',' IDENTIFIER
     {
       if( $1 != NULL ) {
-        db_add_signal( $3, $1->type, $1->prange, $1->urange, curr_signed, curr_mba, @3.first_line, @3.first_column, TRUE );
+        db_add_signal( $3, $1->type, $1->prange, $1->urange, curr_signed, FALSE, curr_mba, @3.first_line, @3.first_column, TRUE );
       }
       $$ = $1;
       FREE_TEXT( $3 );
@@ -1648,7 +1653,7 @@ list_of_variables
   : IDENTIFIER
     {
       if( ignore_mode == 0 ) {
-        db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @1.first_line, @1.first_column, curr_handled );
+        db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, curr_mba, @1.first_line, @1.first_column, curr_handled );
       }
       FREE_TEXT( $1 );
     }
@@ -1659,7 +1664,7 @@ list_of_variables
         if( !parser_check_generation( GENERATION_SV ) ) {
           VLerror( "Unpacked array specified for net type in block that was specified to not allow SystemVerilog syntax" );
         } else {
-          db_add_signal( $1, curr_sig_type, &curr_prange, &curr_urange, curr_signed, curr_mba, @1.first_line, @1.first_column, curr_handled );
+          db_add_signal( $1, curr_sig_type, &curr_prange, &curr_urange, curr_signed, FALSE, curr_mba, @1.first_line, @1.first_column, curr_handled );
         }
       }
       FREE_TEXT( $1 );
@@ -1667,7 +1672,7 @@ list_of_variables
   | list_of_variables ',' IDENTIFIER
     {
       if( ignore_mode == 0 ) {
-        db_add_signal( $3, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @3.first_line, @3.first_column, curr_handled );
+        db_add_signal( $3, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, curr_mba, @3.first_line, @3.first_column, curr_handled );
       }
       FREE_TEXT( $3 );
     }
@@ -1677,7 +1682,7 @@ list_of_variables
         if( !parser_check_generation( GENERATION_SV ) ) {
           VLerror( "Unpacked array specified for net type in block that was specified to not allow SystemVerilog syntax" );
         } else {
-          db_add_signal( $3, curr_sig_type, &curr_prange, &curr_urange, curr_signed, curr_mba, @3.first_line, @3.first_column, curr_handled );
+          db_add_signal( $3, curr_sig_type, &curr_prange, &curr_urange, curr_signed, FALSE, curr_mba, @3.first_line, @3.first_column, curr_handled );
         }
       }
       FREE_TEXT( $3 );
@@ -2645,7 +2650,7 @@ module_item
         Try {
           if( db_add_function_task_namedblock( ($3 ? FUNIT_AFUNCTION : FUNIT_FUNCTION), $6, @6.orig_fname, @6.incl_fname, @6.first_line, @6.first_column ) ) {
             generate_top_mode--;
-            db_add_signal( $6, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, @6.first_line, @6.first_column, TRUE );
+            db_add_signal( $6, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, FALSE, @6.first_line, @6.first_column, TRUE );
             generate_top_mode++;
           } else {
             ignore_mode++;
@@ -2771,7 +2776,7 @@ module_item
     {
       str_link* strl = $3;
       while( strl != NULL ) {
-        db_add_signal( strl->str, SSUPPL_TYPE_DECL_REG, &curr_prange, NULL, curr_signed, FALSE, strl->suppl, strl->suppl2, TRUE );
+        db_add_signal( strl->str, SSUPPL_TYPE_DECL_REG, &curr_prange, NULL, curr_signed, FALSE, FALSE, strl->suppl, strl->suppl2, TRUE );
         strl = strl->next;
       }
       str_link_delete_list( $3 );
@@ -2952,7 +2957,7 @@ expression_assignment_list
           if( ($1 == 1) && !parser_check_generation( GENERATION_SV ) ) {
             VLerror( "Variables declared in FOR initialization block that is specified to not allow SystemVerilog syntax" );
           } else if( ($1 == 1) || (db_find_signal( $2, TRUE ) == NULL) ) {
-            db_add_signal( $2, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @2.first_line, @2.first_column, TRUE );
+            db_add_signal( $2, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, curr_mba, @2.first_line, @2.first_column, TRUE );
           }
           tmp = db_create_expression( NULL, NULL, EXP_OP_SIG, TRUE, @2.first_line, @2.ppfline, @2.pplline, @2.first_column, (@2.last_column - 1), $2, in_static_expr );
         } Catch_anonymous {
@@ -2981,7 +2986,7 @@ expression_assignment_list
           if( ($3 == 1) && !parser_check_generation( GENERATION_SV ) ) {
             VLerror( "Variables declared in FOR initialization block that is specified to not allow SystemVerilog syntax" );
           } else if( ($3 == 1) || (db_find_signal( $4, TRUE ) == NULL) ) {
-            db_add_signal( $4, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @4.first_line, @4.first_column, TRUE );
+            db_add_signal( $4, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, curr_mba, @4.first_line, @4.first_column, TRUE );
           }
           tmp = db_create_expression( NULL, NULL, EXP_OP_SIG, TRUE, @4.first_line, @4.ppfline, @4.pplline, @4.first_column, (@4.last_column - 1), $4, in_static_expr );
         } Catch_anonymous {
@@ -4524,8 +4529,12 @@ block_item_decl
       curr_mba      = FALSE;
       curr_handled  = TRUE;
       curr_sig_type = SSUPPL_TYPE_DECL_REG;
+      curr_2state   = TRUE;
     }
     register_variable_list ';'
+    {
+      curr_2state = FALSE;
+    }
   | attribute_list_opt K_logic signed_opt range_opt
     {
       curr_mba      = FALSE;
@@ -4546,17 +4555,25 @@ block_item_decl
       curr_mba      = FALSE;
       curr_handled  = TRUE;
       curr_sig_type = SSUPPL_TYPE_DECL_REG;
+      curr_2state   = TRUE;
       parser_implicitly_set_curr_range( 7, 0, TRUE );
     }
     register_variable_list ';'
+    {
+      curr_2state = FALSE;
+    }
   | attribute_list_opt K_shortint unsigned_opt
     {
       curr_mba      = FALSE;
       curr_handled  = TRUE;
       curr_sig_type = SSUPPL_TYPE_DECL_REG;
+      curr_2state   = TRUE;
       parser_implicitly_set_curr_range( 15, 0, TRUE );
     }
     register_variable_list ';'
+    {
+      curr_2state = FALSE;
+    }
   | attribute_list_opt K_integer unsigned_opt
     {
       curr_signed   = TRUE;
@@ -4571,17 +4588,25 @@ block_item_decl
       curr_mba      = FALSE;
       curr_handled  = TRUE;
       curr_sig_type = SSUPPL_TYPE_DECL_REG;
+      curr_2state   = TRUE;
       parser_implicitly_set_curr_range( 31, 0, TRUE );
     }
     register_variable_list ';'
+    {
+      curr_2state = FALSE;
+    }
   | attribute_list_opt K_longint unsigned_opt
     {
       curr_mba      = FALSE;
       curr_handled  = TRUE;
       curr_sig_type = SSUPPL_TYPE_DECL_REG;
+      curr_2state   = TRUE;
       parser_implicitly_set_curr_range( 63, 0, TRUE );
     }
     register_variable_list ';'
+    {
+      curr_2state = FALSE;
+    }
   | attribute_list_opt K_time
     {
       curr_signed   = FALSE;
@@ -4650,10 +4675,12 @@ block_item_decl
   | attribute_list_opt K_bit error ';'
     {
       VLerror( "Syntax error in bit variable list" );
+      curr_2state = FALSE;
     }
   | attribute_list_opt K_byte error ';'
     {
       VLerror( "Syntax error in byte variable list" );
+      curr_2state = FALSE;
     }
   | attribute_list_opt K_logic error ';'
     {
@@ -4666,6 +4693,7 @@ block_item_decl
   | attribute_list_opt K_shortint error ';'
     {
       VLerror( "Syntax error in shortint variable list" );
+      curr_2state = FALSE;
     }
   | attribute_list_opt K_integer error ';'
     {
@@ -4674,10 +4702,12 @@ block_item_decl
   | attribute_list_opt K_int error ';'
     {
       VLerror( "Syntax error in int variable list" );
+      curr_2state = FALSE;
     }
   | attribute_list_opt K_longint error ';'
     {
       VLerror( "Syntax error in longint variable list" );
+      curr_2state = FALSE;
     }
   | attribute_list_opt K_time error ';'
     {
@@ -5163,7 +5193,7 @@ register_variable
   : IDENTIFIER
     {
       if( ignore_mode == 0 ) {
-        db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @1.first_line, @1.first_column, TRUE );
+        db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, curr_2state, curr_mba, @1.first_line, @1.first_column, TRUE );
       }
       FREE_TEXT( $1 );
     }
@@ -5174,7 +5204,7 @@ register_variable
           VLerror( "Register declaration with initialization found in block that is specified to not allow Verilog-2001 syntax" );
           expression_dealloc( $3, FALSE );
         } else {
-          db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, curr_mba, @1.first_line, @1.first_column, TRUE );
+          db_add_signal( $1, curr_sig_type, &curr_prange, NULL, curr_signed, curr_2state, curr_mba, @1.first_line, @1.first_column, TRUE );
           if( $3 != NULL ) {
             expression* exp = NULL;
             statement*  stmt;
@@ -5200,7 +5230,7 @@ register_variable
       if( ignore_mode == 0 ) {
         /* Unpacked dimensions are now handled */
         curr_packed = TRUE;
-        db_add_signal( $1, SSUPPL_TYPE_MEM, &curr_prange, &curr_urange, curr_signed, TRUE, @1.first_line, @1.first_column, TRUE );
+        db_add_signal( $1, SSUPPL_TYPE_MEM, &curr_prange, &curr_urange, curr_signed, curr_2state, TRUE, @1.first_line, @1.first_column, TRUE );
       }
       FREE_TEXT( $1 );
     }
@@ -5433,7 +5463,7 @@ net_decl_assign
   : IDENTIFIER '=' expression
     {
       if( (ignore_mode == 0) && ($1 != NULL) ) {
-        db_add_signal( $1, SSUPPL_TYPE_DECL_NET, &curr_prange, NULL, curr_signed, FALSE, @1.first_line, @1.first_column, TRUE );
+        db_add_signal( $1, SSUPPL_TYPE_DECL_NET, &curr_prange, NULL, curr_signed, FALSE, FALSE, @1.first_line, @1.first_column, TRUE );
         if( (info_suppl.part.excl_assign == 0) && ($3 != NULL) ) {
           expression* tmp = NULL;
           statement*  stmt;
@@ -5464,7 +5494,7 @@ net_decl_assign
   | delay1 IDENTIFIER '=' expression
     {
       if( (ignore_mode == 0) && ($2 != NULL) ) {
-        db_add_signal( $2, SSUPPL_TYPE_DECL_NET, &curr_prange, NULL, FALSE, FALSE, @2.first_line, @2.first_column, TRUE );
+        db_add_signal( $2, SSUPPL_TYPE_DECL_NET, &curr_prange, NULL, FALSE, FALSE, FALSE, @2.first_line, @2.first_column, TRUE );
         if( (info_suppl.part.excl_assign == 0) && ($4 != NULL) ) {
           expression* tmp = NULL;
           statement*  stmt;
@@ -6209,7 +6239,7 @@ enum_variable
   : IDENTIFIER
     {
       if( ignore_mode == 0 ) {
-        db_add_signal( $1, SSUPPL_TYPE_ENUM, &curr_prange, NULL, curr_signed, FALSE, @1.first_line, @1.first_column, TRUE );
+        db_add_signal( $1, SSUPPL_TYPE_ENUM, &curr_prange, NULL, curr_signed, FALSE, FALSE, @1.first_line, @1.first_column, TRUE );
         Try {
           db_add_enum( db_find_signal( $1, FALSE ), NULL );
         } Catch_anonymous {
@@ -6221,7 +6251,7 @@ enum_variable
   | IDENTIFIER '=' static_expr
     {
       if( ignore_mode == 0 ) {
-        db_add_signal( $1, SSUPPL_TYPE_ENUM, &curr_prange, NULL, curr_signed, FALSE, @1.first_line, @1.first_column, TRUE );
+        db_add_signal( $1, SSUPPL_TYPE_ENUM, &curr_prange, NULL, curr_signed, FALSE, FALSE, @1.first_line, @1.first_column, TRUE );
         Try {
           db_add_enum( db_find_signal( $1, FALSE ), $3 );
         } Catch_anonymous {
@@ -208,7 +208,7 @@ void parser_create_function_decl(
   if( ignore_mode == 0 ) {
     Try {
       if( db_add_function_task_namedblock( (automatic ? FUNIT_AFUNCTION : FUNIT_FUNCTION), name, orig_fname, incl_fname, first_line, first_column ) ) {
-        db_add_signal( name, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, first_line, first_column, TRUE );
+        db_add_signal( name, curr_sig_type, &curr_prange, NULL, curr_signed, FALSE, FALSE, first_line, first_column, TRUE );
       } else {
         ignore_mode++;
       }
@@ -278,7 +278,7 @@ port_info* parser_create_inline_port(
 
     if( ignore_mode == 0 ) {
 
-      db_add_signal( name, sig_type, &curr_prange, NULL, curr_signed, FALSE, first_line, first_column, TRUE );
+      db_add_signal( name, sig_type, &curr_prange, NULL, curr_signed, FALSE, FALSE, first_line, first_column, TRUE );
 
       pi            = (port_info*)malloc_safe( sizeof( port_info ) );
       pi->type      = sig_type;
@@ -0,0 +1,589 @@
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     ppcache.c
+ \date     10/18/2026
+
+ \par
+ The preprocessor cache keeps the preprocessed contents of each Verilog file read by the score command in the
+ directory specified with the -ppcache option so that later score runs on unchanged source can skip the
+ preprocessor.  Each cache entry is named by a hash of everything that the preprocessed contents depend on when
+ the file is opened:  the name and contents of the file, the include search path and the currently defined macros.
+ Since the files that a file includes are only known after it has been preprocessed, the entry also stores the
+ `include name of each included file along with the path that it was resolved to and a hash of its contents.
+ Before the entry is used, each name is resolved again against the current include search path and the entry is
+ only used if every name still resolves to the same file and the contents of that file have not changed.
+
+ \par
+ Along with the preprocessed contents, an entry stores the macros that are defined at the end of the file.  When
+ an entry is used, these replace the current macro definitions so that the files following it are preprocessed
+ exactly as if the file had been run through the preprocessor.
+
+ \par
+ Entries are written to a temporary file in the cache directory and renamed into place once they are complete so
+ that score runs sharing a cache directory never see a partially written entry.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <assert.h>
+
+#include "defines.h"
+#include "ppcache.h"
+#include "tree.h"
+#include "util.h"
+
+
+/*!
+ Version of the cache entry format.  This must be incremented whenever the format of an entry or the output of the
+ preprocessor changes.
+*/
+#define PPCACHE_VERSION 2
+
+
+extern str_link* inc_paths_head;
+extern tnode*    def_table;
+extern char*     ppcache_dir;
+extern char      user_msg[USER_MSG_LENGTH];
+extern bool      debug_mode;
+
+
+/*!
+ \return Returns the given hash value updated with the given data.
+
+ Adds the given data to the given FNV-1a hash value.
+*/
+static uint64 ppcache_hash(
+  uint64       hash,  /*!< Current hash value */
+  const char*  data,  /*!< Pointer to data to add to the hash */
+  unsigned int len    /*!< Number of bytes of data to add to the hash */
+) {
+
+  unsigned int i;
+
+  for( i=0; i<len; i++ ) {
+    hash ^= (unsigned char)data[i];
+    hash *= 0x100000001b3LL;
+  }
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns the given hash value updated with the given define tree.
+
+ Adds the names and values of the given define tree to the given hash value in sorted order so that the
+ hash does not depend on the order in which the macros were defined.
+*/
+static uint64 ppcache_hash_defines(
+  uint64       hash,  /*!< Current hash value */
+  const tnode* node   /*!< Pointer to define tree node to add to the hash */
+) {
+
+  if( node != NULL ) {
+    hash = ppcache_hash_defines( hash, node->left );
+    hash = ppcache_hash( hash, node->name,  (strlen( node->name )  + 1) );
+    hash = ppcache_hash( hash, node->value, (strlen( node->value ) + 1) );
+    hash = ppcache_hash_defines( hash, node->right );
+  }
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns a pointer to the NUL-terminated contents of the given file if it could be read; otherwise,
+         returns NULL.  The returned buffer is size + 1 bytes long.
+*/
+static char* ppcache_read_file(
+  const char*   fname,  /*!< Name of file to read */
+  unsigned int* size    /*!< Set to the number of bytes read from the file */
+) { PROFILE(PPCACHE_READ_FILE);
+
+  char* contents = NULL;
+  FILE* file;
+
+  if( (file = fopen( fname, "rb" )) != NULL ) {
+
+    long fsize;
+
+    if( (fseek( file, 0, SEEK_END ) == 0) && ((fsize = ftell( file )) >= 0) && (fseek( file, 0, SEEK_SET ) == 0) ) {
+      *size    = (unsigned int)fsize;
+      contents = (char*)malloc_safe_nolimit( *size + 1 );
+      if( fread( contents, 1, *size, file ) == *size ) {
+        contents[*size] = '\0';
+      } else {
+        free_safe( contents, (*size + 1) );
+        contents = NULL;
+      }
+    }
+
+    (void)fclose( file );
+
+  }
+
+  PROFILE_END;
+
+  return( contents );
+
+}
+
+/*!
+ \return Returns TRUE if the given file could be read; otherwise, returns FALSE.
+
+ Calculates the hash of the contents of the given file and stores it as a string in the given hash parameter.
+*/
+static bool ppcache_hash_file(
+  const char* fname,  /*!< Name of file to hash */
+  char*       hash    /*!< Set to the hash string of the file (must be at least PPCACHE_KEY_SIZE characters) */
+) { PROFILE(PPCACHE_HASH_FILE);
+
+  bool         retval = FALSE;
+  char*        contents;
+  unsigned int size;
+
+  if( (contents = ppcache_read_file( fname, &size )) != NULL ) {
+    unsigned int rv = snprintf( hash, PPCACHE_KEY_SIZE, "%016" FMT64 "x", ppcache_hash( 0xcbf29ce484222325LL, contents, size ) );
+    assert( rv < PPCACHE_KEY_SIZE );
+    free_safe( contents, (size + 1) );
+    retval = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns the name of the cache entry file for the given key.  The returned string must be deallocated
+         by the caller.
+*/
+static char* ppcache_entry_name(
+  const char* key  /*!< Cache key of entry */
+) { PROFILE(PPCACHE_ENTRY_NAME);
+
+  unsigned int slen  = strlen( ppcache_dir ) + strlen( key ) + 5;
+  char*        ename = (char*)malloc_safe( slen );
+  unsigned int rv    = snprintf( ename, slen, "%s/%s.pp", ppcache_dir, key );
+
+  assert( rv < slen );
+
+  PROFILE_END;
+
+  return( ename );
+
+}
+
+/*!
+ \return Returns TRUE if an unsigned value followed by the given terminating character was read from the
+         given entry position; otherwise, returns FALSE.
+
+ Reads a decimal value from the given position of a cache entry and advances the position past its terminating
+ character.
+*/
+static bool ppcache_read_uint(
+  const char**  ptr,    /*!< Pointer to current position in entry */
+  const char*   end,    /*!< Pointer to end of entry */
+  char          term,   /*!< Character that must follow the value */
+  unsigned int* value   /*!< Set to the read value */
+) {
+
+  bool          valid = FALSE;
+  char*         next;
+  unsigned long val;
+
+  if( (*ptr < end) && isdigit( (unsigned char)**ptr ) ) {
+    val = strtoul( *ptr, &next, 10 );
+    if( (next < end) && (*next == term) && (val == (unsigned int)val) ) {
+      *value = (unsigned int)val;
+      *ptr   = next + 1;
+      valid  = TRUE;
+    }
+  }
+
+  return( valid );
+
+}
+
+/*!
+ \return Returns TRUE if the given `include name could be resolved to a readable file; otherwise, returns FALSE.
+
+ Resolves the given `include name to a file path the same way that the preprocessor does:  absolute names are
+ used as is, and other names are searched for in each directory of the include search path in order.
+*/
+static bool ppcache_resolve_include(
+  const char* name,  /*!< Name of included file as specified in the `include directive */
+  char*       path   /*!< Set to the path that the name resolves to (must be at least 4096 characters) */
+) { PROFILE(PPCACHE_RESOLVE_INCLUDE);
+
+  FILE* file = NULL;
+
+  if( name[0] == '/' ) {
+
+    if( strlen( name ) < 4096 ) {
+      strcpy( path, name );
+      file = fopen( path, "r" );
+    }
+
+  } else {
+
+    const str_link* curr = inc_paths_head;
+
+    while( (curr != NULL) && (file == NULL) ) {
+      unsigned int rv = snprintf( path, 4096, "%s/%s", curr->str, name );
+      if( rv < 4096 ) {
+        file = fopen( path, "r" );
+      }
+      curr = curr->next;
+    }
+
+  }
+
+  if( file != NULL ) {
+    (void)fclose( file );
+  }
+
+  PROFILE_END;
+
+  return( file != NULL );
+
+}
+
+/*!
+ \return Returns TRUE if the included file at the given position of a cache entry still resolves to the same file
+         and that file has not changed since the entry was written; otherwise, returns FALSE.
+
+ Reads an included file line (hash of the file contents, length of the `include name, the `include name and the
+ path that it was resolved to) from the given position of a cache entry.  The name is resolved against the current
+ include search path, and the resulting path and the hash of its current contents are compared to the recorded ones.
+*/
+static bool ppcache_check_include(
+  const char** ptr,  /*!< Pointer to current position in entry */
+  const char*  end   /*!< Pointer to end of entry */
+) { PROFILE(PPCACHE_CHECK_INCLUDE);
+
+  bool         valid = FALSE;
+  const char*  nl    = (const char*)memchr( *ptr, '\n', (end - *ptr) );
+  const char*  curr  = *ptr + PPCACHE_KEY_SIZE;
+  unsigned int name_len;
+
+  if( (nl != NULL) && ((nl - *ptr) > PPCACHE_KEY_SIZE) && ((*ptr)[PPCACHE_KEY_SIZE - 1] == ' ') &&
+      ppcache_read_uint( &curr, nl, ' ', &name_len ) && (name_len > 0) && (name_len < (unsigned int)(nl - curr)) ) {
+
+    unsigned int plen = nl - (curr + name_len);
+    char*        name = (char*)malloc_safe_nolimit( name_len + 1 );
+    char*        path = (char*)malloc_safe_nolimit( plen + 1 );
+    char         rpath[4096];
+    char         hash[PPCACHE_KEY_SIZE];
+
+    memcpy( name, curr, name_len );
+    name[name_len] = '\0';
+    memcpy( path, (curr + name_len), plen );
+    path[plen] = '\0';
+
+    valid = ppcache_resolve_include( name, rpath ) && (strcmp( rpath, path ) == 0) &&
+            ppcache_hash_file( path, hash ) && (strncmp( hash, *ptr, (PPCACHE_KEY_SIZE - 1) ) == 0);
+
+    free_safe( name, (name_len + 1) );
+    free_safe( path, (plen + 1) );
+
+  }
+
+  if( nl != NULL ) {
+    *ptr = nl + 1;
+  }
+
+  PROFILE_END;
+
+  return( valid );
+
+}
+
+/*!
+ \return Returns TRUE if the given cache entry is valid and its included files have not changed; otherwise,
+         returns FALSE.
+
+ Loads the given cache entry.  If the entry is valid, the define table is replaced with the macros stored in the
+ entry and a newly allocated copy of the preprocessed contents (terminated by two NUL characters) is returned
+ in the buf parameter.
+*/
+static bool ppcache_load_entry(
+  const char*   ptr,   /*!< Pointer to start of entry */
+  const char*   end,   /*!< Pointer to end of entry */
+  char**        buf,   /*!< Set to the preprocessed contents of the entry */
+  unsigned int* size   /*!< Set to the size of buf (including the terminating characters) */
+) { PROFILE(PPCACHE_LOAD_ENTRY);
+
+  bool         valid;
+  tnode*       defs = NULL;  /* Define table stored in the entry */
+  char         header[32];
+  unsigned int num;
+  unsigned int i;
+  unsigned int rv;
+
+  rv = snprintf( header, 32, "COVERED_PPCACHE %d\n", PPCACHE_VERSION );
+  assert( rv < 32 );
+
+  /* Check the entry format version */
+  if( (valid = (((unsigned int)(end - ptr) >= rv) && (strncmp( ptr, header, rv ) == 0))) ) {
+    ptr += rv;
+  }
+
+  /* Make sure that none of the included files have changed */
+  valid = valid && ppcache_read_uint( &ptr, end, '\n', &num );
+  for( i=0; valid && (i<num); i++ ) {
+    valid = ppcache_check_include( &ptr, end );
+  }
+
+  /* Read the macros defined at the end of the file */
+  valid = valid && ppcache_read_uint( &ptr, end, '\n', &num );
+  for( i=0; valid && (i<num); i++ ) {
+    unsigned int name_len;
+    unsigned int value_len;
+    /* Reject lengths that do not fit in the rest of the entry before allocating (without overflowing the sum) */
+    if( (valid = (ppcache_read_uint( &ptr, end, ' ', &name_len ) && ppcache_read_uint( &ptr, end, '\n', &value_len ) &&
+                  (name_len < (unsigned int)(end - ptr)) && (value_len < ((unsigned int)(end - ptr) - name_len)) &&
+                  (ptr[name_len + value_len] == '\n'))) ) {
+      char* name  = (char*)malloc_safe_nolimit( name_len + 1 );
+      char* value = (char*)malloc_safe_nolimit( value_len + 1 );
+      memcpy( name, ptr, name_len );
+      name[name_len] = '\0';
+      memcpy( value, (ptr + name_len), value_len );
+      value[value_len] = '\0';
+      (void)tree_add( name, value, TRUE, &defs );
+      free_safe( name, (name_len + 1) );
+      free_safe( value, (value_len + 1) );
+      ptr += name_len + value_len + 1;
+    }
+  }
+
+  /* Read the preprocessed contents */
+  valid = valid && ppcache_read_uint( &ptr, end, '\n', &num ) && ((unsigned int)(end - ptr) == num);
+
+  if( valid ) {
+
+    *size = num + 2;
+    *buf  = (char*)malloc_safe_nolimit( *size );
+    memcpy( *buf, ptr, num );
+    (*buf)[num]     = '\0';
+    (*buf)[num + 1] = '\0';
+
+    tree_dealloc( def_table );
+    def_table = defs;
+
+  } else {
+
+    tree_dealloc( defs );
+
+  }
+
+  PROFILE_END;
+
+  return( valid );
+
+}
+
+/*!
+ \return Returns TRUE if the preprocessed contents of the given file were found in the cache; otherwise,
+         returns FALSE.
+
+ Calculates the cache key for the given file from its name and contents, the include search path and the
+ currently defined macros and looks up the matching cache entry.  If a valid entry is found, its preprocessed
+ contents are returned and the define table is updated to the state that it would be in after preprocessing
+ the file.  The key is returned so that the caller can store the preprocessed contents if they were not found
+ (the key is set to the empty string if the file could not be read).
+*/
+bool ppcache_lookup(
+  const char*   fname,  /*!< Name of Verilog file to get preprocessed contents for */
+  char*         key,    /*!< Set to the cache key of the file (must be at least PPCACHE_KEY_SIZE characters) */
+  char**        buf,    /*!< Set to the preprocessed contents of the file (terminated by two NUL characters) if found */
+  unsigned int* size    /*!< Set to the size of buf (including the terminating characters) if found */
+) { PROFILE(PPCACHE_LOOKUP);
+
+  bool         found = FALSE;
+  char*        contents;
+  unsigned int contents_size;
+
+  key[0] = '\0';
+
+  if( (contents = ppcache_read_file( fname, &contents_size )) != NULL ) {
+
+    uint64          hash = 0xcbf29ce484222325LL;
+    const str_link* strl;
+    char*           ename;
+    char*           entry;
+    unsigned int    entry_size;
+    unsigned int    rv;
+
+    /* Calculate the key of the file */
+    hash = ppcache_hash( hash, fname, (strlen( fname ) + 1) );
+    for( strl=inc_paths_head; strl!=NULL; strl=strl->next ) {
+      hash = ppcache_hash( hash, strl->str, (strlen( strl->str ) + 1) );
+    }
+    hash = ppcache_hash( hash, "", 1 );
+    hash = ppcache_hash_defines( hash, def_table );
+    hash = ppcache_hash( hash, contents, contents_size );
+
+    free_safe( contents, (contents_size + 1) );
+
+    rv = snprintf( key, PPCACHE_KEY_SIZE, "%016" FMT64 "x", hash );
+    assert( rv < PPCACHE_KEY_SIZE );
+
+    /* Load the matching entry, if it exists */
+    ename = ppcache_entry_name( key );
+    if( (entry = ppcache_read_file( ename, &entry_size )) != NULL ) {
+      found = ppcache_load_entry( entry, (entry + entry_size), buf, size );
+      free_safe( entry, (entry_size + 1) );
+    }
+    free_safe( ename, (strlen( ename ) + 1) );
+
+#ifdef DEBUG_MODE
+    if( debug_mode ) {
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Preprocessor cache %s for file %s (key: %s)", (found ? "hit" : "miss"), fname, key );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+    }
+#endif
+
+  }
+
+  PROFILE_END;
+
+  return( found );
+
+}
+
+/*!
+ Writes the names and values of the given define tree to the given cache entry file.
+*/
+static void ppcache_write_defines(
+  FILE*        out,  /*!< Pointer to cache entry file */
+  const tnode* node  /*!< Pointer to define tree node to write */
+) {
+
+  if( node != NULL ) {
+    fprintf( out, "%u %u\n%s%s\n", (unsigned int)strlen( node->name ), (unsigned int)strlen( node->value ), node->name, node->value );
+    ppcache_write_defines( out, node->left );
+    ppcache_write_defines( out, node->right );
+  }
+
+}
+
+/*!
+ \return Returns the number of nodes in the given define tree.
+*/
+static unsigned int ppcache_count_defines(
+  const tnode* node  /*!< Pointer to define tree node to count */
+) {
+
+  return( (node == NULL) ? 0 : (ppcache_count_defines( node->left ) + 1 + ppcache_count_defines( node->right )) );
+
+}
+
+/*!
+ Stores the given preprocessed contents in the cache entry for the given key along with the hashes of the given
+ included files and the currently defined macros.  Failing to write the entry only causes a warning to be
+ output since the cache is only used to improve performance.
+*/
+void ppcache_store(
+  const char*     key,        /*!< Cache key returned by ppcache_lookup */
+  const str_link* incl_head,  /*!< Pointer to head of list of files included by the preprocessed file (str is the
+                                   resolved path and str2 is the `include name) */
+  const char*     buf,        /*!< Preprocessed contents (terminated by two NUL characters) */
+  unsigned int    size        /*!< Size of buf (including the terminating characters) */
+) { PROFILE(PPCACHE_STORE);
+
+  if( key[0] != '\0' ) {
+
+    char*        ename = ppcache_entry_name( key );
+    unsigned int tlen  = strlen( ename ) + 8;
+    char*        tname = (char*)malloc_safe( tlen );
+    bool         ok    = FALSE;
+    int          fd;
+    unsigned int rv;
+
+    rv = snprintf( tname, tlen, "%s.XXXXXX", ename );
+    assert( rv < tlen );
+
+    /* Write the entry to a temporary file so that other score runs never see a partial entry */
+    if( (fd = mkstemp( tname )) != -1 ) {
+
+      FILE* out;
+
+      if( (out = fdopen( fd, "wb" )) != NULL ) {
+
+        const str_link* strl;
+        unsigned int    num = 0;
+
+        ok = TRUE;
+
+        fprintf( out, "COVERED_PPCACHE %d\n", PPCACHE_VERSION );
+
+        for( strl=incl_head; strl!=NULL; strl=strl->next ) {
+          num++;
+        }
+        fprintf( out, "%u\n", num );
+        for( strl=incl_head; strl!=NULL; strl=strl->next ) {
+          char hash[PPCACHE_KEY_SIZE];
+          if( ppcache_hash_file( strl->str, hash ) ) {
+            fprintf( out, "%s %u %s%s\n", hash, (unsigned int)strlen( strl->str2 ), strl->str2, strl->str );
+          } else {
+            ok = FALSE;
+          }
+        }
+
+        fprintf( out, "%u\n", ppcache_count_defines( def_table ) );
+        ppcache_write_defines( out, def_table );
+
+        fprintf( out, "%u\n", (size - 2) );
+        ok = ok && (fwrite( buf, 1, (size - 2), out ) == (size - 2)) && !ferror( out );
+        ok = (fclose( out ) == 0) && ok;
+
+      } else {
+
+        (void)close( fd );
+
+      }
+
+      /* Move the entry into place, replacing any entry written by another score run */
+      ok = ok && (rename( tname, ename ) == 0);
+
+      if( !ok ) {
+        (void)unlink( tname );
+      }
+
+    }
+
+    if( !ok ) {
+      rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to write preprocessor cache entry %s", ename );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, WARNING, __FILE__, __LINE__ );
+    }
+
+    free_safe( tname, tlen );
+    free_safe( ename, (strlen( ename ) + 1) );
+
+  }
+
+  PROFILE_END;
+
+}
+
@@ -0,0 +1,51 @@
+#ifndef __PPCACHE_H__
+#define __PPCACHE_H__
+
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     ppcache.h
+ \date     10/18/2026
+ \brief    Contains functions for caching preprocessed Verilog files across score runs.
+*/
+
+#include "defines.h"
+
+
+/*!
+ Number of characters needed to store a preprocessor cache key (including the terminating NUL character).
+*/
+#define PPCACHE_KEY_SIZE 17
+
+
+/*! \brief Retrieves the preprocessed contents of the given file from the preprocessor cache. */
+bool ppcache_lookup(
+  const char*   fname,
+  char*         key,
+  char**        buf,
+  unsigned int* size
+);
+
+/*! \brief Stores the preprocessed contents of a file in the preprocessor cache. */
+void ppcache_store(
+  const char*     key,
+  const str_link* incl_head,
+  const char*     buf,
+  unsigned int    size
+);
+
+#endif
+
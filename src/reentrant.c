@@ -21,174 +21,201 @@
 
 #include <assert.h>
 
+#include "checkpoint.h"
 #include "defines.h"
 #include "reentrant.h"
 #include "util.h"
+#include "vector.h"
 
 
 extern const exp_info exp_op_info[EXP_OP_NUM];
 
 
 /*!
- \return Returns the total number of bits in all signals in this functional unit and all parents
-         within the same reentrant task/function.
+ Number of frame stack words needed to hold a single real value.
+*/
+#define REENTRANT_REAL_WORDS  ((sizeof( double ) + (sizeof( ulong ) - 1)) / sizeof( ulong ))
 
- Recursively iterates up the functional unit tree keeping track of the total number of bits needed
- to store all information in the current reentrant task/function.
+/*!
+ Preallocated word region that all reentrant frames are carved from.  Frames are pushed and popped
+ from this region in stack order, so no memory is allocated per task/function call once the stack
+ has grown to the maximum call depth of the design.
 */
-static int reentrant_count_afu_bits(
-  func_unit* funit  /*!< Pointer to current function to count the bits of */
-) { PROFILE(REENTRANT_COUNT_AFU_BITS);
+static ulong* ren_stack = NULL;
 
-  int bits = 0;  /* Number of bits in this functional unit and all parent functional units in the reentrant task/function */
+/*!
+ Number of words allocated in the ren_stack region.
+*/
+static unsigned int ren_stack_size = 0;
 
-  if( (funit->suppl.part.type == FUNIT_ATASK) || (funit->suppl.part.type == FUNIT_AFUNCTION) || (funit->suppl.part.type == FUNIT_ANAMED_BLOCK) ) {
+/*!
+ Index of the first unused word in the ren_stack region.
+*/
+static unsigned int ren_stack_top = 0;
 
-    unsigned int i;
+/*!
+ Pointer to the frame at the top of the reentrant frame stack.
+*/
+static reentrant* ren_top = NULL;
 
-    /* Count the number of signal bits in this functional unit */
-    for( i=0; i<funit->sig_size; i++ ) {
-      vsignal* sig = funit->sigs[i];
-      switch( sig->value->suppl.part.data_type ) {
-        case VDATA_UL  :  bits += (sig->value->width * 2) + 1;  break;
-        case VDATA_R64 :  bits += 64;  break;
-        case VDATA_R32 :  bits += 32;  break;
-        default        :  assert( 0 );  break;
-      }
+/*!
+ Pointer to list of frame structures that are available for reuse.
+*/
+static reentrant* ren_free_head = NULL;
+
+
+/*!
+ Makes sure that the frame stack has room for at least the given number of words above the current
+ top of the stack, growing the region if necessary.
+*/
+static void reentrant_stack_reserve(
+  unsigned int words  /*!< Number of words that will be pushed onto the frame stack */
+) { PROFILE(REENTRANT_STACK_RESERVE);
+
+  if( (ren_stack_top + words) > ren_stack_size ) {
+
+    unsigned int new_size = (ren_stack_size == 0) ? 1024 : ren_stack_size;
+
+    while( (ren_stack_top + words) > new_size ) {
+      new_size <<= 1;
     }
 
-    /* Count the number of expression bits in this functional unit */
-    for( i=0; i<funit->exp_size; i++ ) {
-      expression* exp = funit->exps[i];
-      if( (EXPR_OWNS_VEC( exp->op ) == 1) && (EXPR_IS_STATIC( exp ) == 0) ) {
-        bits += (exp->value->width * 2);
+    ren_stack      = (ulong*)realloc_safe_nolimit( ren_stack, (sizeof( ulong ) * ren_stack_size), (sizeof( ulong ) * new_size) );
+    ren_stack_size = new_size;
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Pushes the current value of the given vector onto the top of the frame stack.
+*/
+static void reentrant_store_vector(
+  const vector* vec  /*!< Pointer to vector to store */
+) { PROFILE(REENTRANT_STORE_VECTOR);
+
+  switch( vec->suppl.part.data_type ) {
+    case VDATA_UL :
+      {
+        unsigned int size = UL_DIV( vec->width - 1 ) + 1;
+        unsigned int i;
+        reentrant_stack_reserve( size * 2 );
+        for( i=0; i<size; i++ ) {
+          ulong* entry = vec->value.ul[i];
+          ren_stack[ren_stack_top++] = entry[VTYPE_INDEX_VAL_VALL];
+          ren_stack[ren_stack_top++] = entry[VTYPE_INDEX_VAL_VALH];
+        }
       }
-      bits += ((ESUPPL_BITS_TO_STORE % 2) == 0) ? ESUPPL_BITS_TO_STORE : (ESUPPL_BITS_TO_STORE + 1);
-    }
+      break;
+    case VDATA_R64 :
+      reentrant_stack_reserve( REENTRANT_REAL_WORDS );
+      memcpy( (ren_stack + ren_stack_top), &(vec->value.r64->val), sizeof( double ) );
+      ren_stack_top += REENTRANT_REAL_WORDS;
+      break;
+    case VDATA_R32 :
+      {
+        double real = (double)vec->value.r32->val;
+        reentrant_stack_reserve( REENTRANT_REAL_WORDS );
+        memcpy( (ren_stack + ren_stack_top), &real, sizeof( double ) );
+        ren_stack_top += REENTRANT_REAL_WORDS;
+      }
+      break;
+    default :  assert( 0 );  break;
+  }
 
-    /* If the current functional unit is a named block, gather the bits in the parent functional unit */
-    if( funit->suppl.part.type == FUNIT_ANAMED_BLOCK ) {
-      bits += reentrant_count_afu_bits( funit->parent );
-    }
+  PROFILE_END;
+
+}
 
+/*!
+ \return Returns the index of the frame stack word following the restored vector value.
+
+ Restores the value of the given vector from the frame stack, starting at the given word.  If
+ the restore parameter is FALSE, the stored value is skipped over without being assigned.
+*/
+static unsigned int reentrant_restore_vector(
+  vector*      vec,      /*!< Pointer to vector to restore */
+  unsigned int curr,     /*!< Index of the frame stack word that the vector value starts at */
+  bool         restore   /*!< Set to TRUE to assign the stored value to the vector */
+) { PROFILE(REENTRANT_RESTORE_VECTOR);
+
+  switch( vec->suppl.part.data_type ) {
+    case VDATA_UL :
+      {
+        unsigned int size = UL_DIV( vec->width - 1 ) + 1;
+        if( restore ) {
+          unsigned int i;
+          for( i=0; i<size; i++ ) {
+            ulong* entry = vector_get_writable_row( vec, i );
+            entry[VTYPE_INDEX_VAL_VALL] = ren_stack[curr++];
+            entry[VTYPE_INDEX_VAL_VALH] = ren_stack[curr++];
+          }
+        } else {
+          curr += (size * 2);
+        }
+      }
+      break;
+    case VDATA_R64 :
+      if( restore ) {
+        memcpy( &(vec->value.r64->val), (ren_stack + curr), sizeof( double ) );
+      }
+      curr += REENTRANT_REAL_WORDS;
+      break;
+    case VDATA_R32 :
+      if( restore ) {
+        double real;
+        memcpy( &real, (ren_stack + curr), sizeof( double ) );
+        vec->value.r32->val = (float)real;
+      }
+      curr += REENTRANT_REAL_WORDS;
+      break;
+    default :  assert( 0 );  break;
   }
 
   PROFILE_END;
 
-  return( bits );
+  return( curr );
 
 }
 
 /*!
- Recursively gathers all signal data bits to store and stores them in the given reentrant
- structure.
+ Recursively pushes the signal and expression values of the functional units in a reentrant task/function
+ onto the top of the frame stack.
 */
-static void reentrant_store_data_bits(
-  func_unit*   funit,    /*!< Pointer to current functional unit to traverse */
-  reentrant*   ren,      /*!< Pointer to reentrant structure to populate */
-  unsigned int curr_bit  /*!< Current bit to store (should be started at a value of 0) */
-) { PROFILE(REENTRANT_STORE_DATA_BITS);
+static void reentrant_store_data(
+  func_unit* funit  /*!< Pointer to current functional unit to traverse */
+) { PROFILE(REENTRANT_STORE_DATA);
 
   if( (funit->suppl.part.type == FUNIT_ATASK) || (funit->suppl.part.type == FUNIT_AFUNCTION) || (funit->suppl.part.type == FUNIT_ANAMED_BLOCK) ) {
 
     unsigned int i;
 
-    /* Walk through the signal list in the reentrant functional unit, compressing and saving vector values */
+    /* Walk through the signal list in the reentrant functional unit, saving vector values and the set bit */
     for( i=0; i<funit->sig_size; i++ ) {
       vsignal* sig = funit->sigs[i];
-      switch( sig->value->suppl.part.data_type ) {
-        case VDATA_UL :
-          {
-            unsigned int i;
-            for( i=0; i<sig->value->width; i++ ) {
-              ulong* entry = sig->value->value.ul[UL_DIV(i)];
-              ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
-              curr_bit++;
-              ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALH] >> UL_MOD(i)) & 0x1) << (curr_bit & 0x7));
-              curr_bit++;
-            }
-            ren->data[curr_bit>>3] |= sig->value->suppl.part.set << (curr_bit & 0x7);
-            curr_bit++;
-            /* Clear the set bit */
-            sig->value->suppl.part.set = 0;
-          }
-          break;
-        case VDATA_R64 :
-          {
-            uint64       real_bits = sys_task_realtobits( sig->value->value.r64->val );
-            unsigned int i;
-            for( i=0; i<64; i++ ) {
-              ren->data[curr_bit>>3] |= (real_bits & 0x1) << (curr_bit & 0x7);
-              real_bits >>= 1;
-              curr_bit++;
-            }
-          }
-          break;
-        case VDATA_R32 :
-          {
-            uint64       real_bits = sys_task_realtobits( (double)sig->value->value.r32->val );
-            unsigned int i;
-            for( i=0; i<32; i++ ) {
-              ren->data[curr_bit>>3] |= (real_bits & 0x1) << (curr_bit & 0x7);
-              real_bits >>= 1;
-              curr_bit++;
-            }
-          }
-          break;
-        default :  assert( 0 );
+      reentrant_store_vector( sig->value );
+      if( sig->value->suppl.part.data_type == VDATA_UL ) {
+        reentrant_stack_reserve( 1 );
+        ren_stack[ren_stack_top++] = sig->value->suppl.part.set;
+        /* Clear the set bit */
+        sig->value->suppl.part.set = 0;
       }
     }
 
-    /* Walk through expression list in the reentrant functional unit, compressing and saving vector and supplemental values */
+    /* Walk through expression list in the reentrant functional unit, saving vector and supplemental values */
     for( i=0; i<funit->exp_size; i++ ) {
-      expression*  exp = funit->exps[i];
-      unsigned int j;
+      expression* exp = funit->exps[i];
       if( (EXPR_OWNS_VEC( exp->op ) == 1) && (EXPR_IS_STATIC( exp ) == 0) ) {
-        switch( exp->value->suppl.part.data_type ) {
-          case VDATA_UL :
-            {
-              for( j=0; j<exp->value->width; j++ ) {
-                ulong* entry = exp->value->value.ul[UL_DIV(j)];
-                ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALL] >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
-                curr_bit++;
-                ren->data[curr_bit>>3] |= (((entry[VTYPE_INDEX_VAL_VALH] >> UL_MOD(j)) & 0x1) << (curr_bit & 0x7));
-                curr_bit++;
-              }
-            }
-            break;
-          case VDATA_R64 :
-            {
-              uint64 real_bits = sys_task_realtobits( exp->value->value.r64->val );
-              for( j=0; j<64; j++ ) {
-                ren->data[curr_bit>>3] |= (real_bits & 0x1) << (curr_bit & 0x7);
-                real_bits >>= 1;
-                curr_bit++;
-              }
-            }
-            break;
-          case VDATA_R32 :
-            {
-              uint64 real_bits = sys_task_realtobits( (double)exp->value->value.r32->val );
-              for( j=0; j<32; j++ ) {
-                ren->data[curr_bit>>3] |= (real_bits & 0x1) << (curr_bit & 0x7);
-                real_bits >>= 1;
-                curr_bit++;
-              }
-            }
-            break;
-          default :  assert( 0 );  break;
-        }
-      }
-      for( j=0; j<(((ESUPPL_BITS_TO_STORE % 2) == 0) ? ESUPPL_BITS_TO_STORE : (ESUPPL_BITS_TO_STORE + 1)); j++ ) {
-        switch( j ) {
-          case 0 :  ren->data[curr_bit>>3] |= (exp->suppl.part.left_changed  << (curr_bit & 0x7));  break;
-          case 1 :  ren->data[curr_bit>>3] |= (exp->suppl.part.right_changed << (curr_bit & 0x7));  break;
-          case 2 :  ren->data[curr_bit>>3] |= (exp->suppl.part.eval_t        << (curr_bit & 0x7));  break;
-          case 3 :  ren->data[curr_bit>>3] |= (exp->suppl.part.eval_f        << (curr_bit & 0x7));  break;
-          case 4 :  ren->data[curr_bit>>3] |= (exp->suppl.part.prev_called   << (curr_bit & 0x7));  break;
-        }
-        curr_bit++;
+        reentrant_store_vector( exp->value );
       }
+      reentrant_stack_reserve( 1 );
+      ren_stack[ren_stack_top++] = ((ulong)exp->suppl.part.left_changed  << 0) |
+                                   ((ulong)exp->suppl.part.right_changed << 1) |
+                                   ((ulong)exp->suppl.part.eval_t        << 2) |
+                                   ((ulong)exp->suppl.part.eval_f        << 3) |
+                                   ((ulong)exp->suppl.part.prev_called   << 4);
       /* Clear supplemental bits that have been saved off */
       exp->suppl.part.left_changed  = 0;
       exp->suppl.part.right_changed = 0;
@@ -197,9 +224,9 @@ static void reentrant_store_data_bits(
       exp->suppl.part.prev_called   = 0;
     }
 
-    /* If the current functional unit is a named block, store the bits in the parent functional unit */
+    /* If the current functional unit is a named block, store the values in the parent functional unit */
     if( funit->suppl.part.type == FUNIT_ANAMED_BLOCK ) {
-      reentrant_store_data_bits( funit->parent, ren, curr_bit );
+      reentrant_store_data( funit->parent );
     }
 
   }
@@ -211,128 +238,46 @@ static void reentrant_store_data_bits(
 /*!
  Recursively restores the signal and expression values of the functional units in a reentrant task/function.
 */
-static void reentrant_restore_data_bits(
-  func_unit*   funit,     /*!< Pointer to current functional unit to restore */
-  reentrant*   ren,       /*!< Pointer to reentrant structure containing bits to restore */
-  unsigned int curr_bit,  /*!< Current bit in reentrant structure to restore */
-  expression*  expr       /*!< Pointer to expression to exclude from updating */
-) { PROFILE(REENTRANT_RESTORE_DATA_BITS);
+static void reentrant_restore_data(
+  func_unit*   funit,  /*!< Pointer to current functional unit to restore */
+  unsigned int curr,   /*!< Index of current frame stack word to restore */
+  expression*  expr    /*!< Pointer to expression to exclude from updating */
+) { PROFILE(REENTRANT_RESTORE_DATA);
 
   if( (funit->suppl.part.type == FUNIT_ATASK) || (funit->suppl.part.type == FUNIT_AFUNCTION) || (funit->suppl.part.type == FUNIT_ANAMED_BLOCK) ) {
 
     unsigned int i;
-    unsigned int j;
-
-    /* Walk through each bit in the compressed data array and assign it back to its signal */
-    for( j=0; j<funit->sig_size; j++ ) {
-      vsignal* sig = funit->sigs[j];
-      switch( sig->value->suppl.part.data_type ) {
-        case VDATA_UL :
-          {
-            for( i=0; i<sig->value->width; i++ ) {
-              ulong* entry = sig->value->value.ul[UL_DIV(i)];
-              if( UL_MOD(i) == 0 ) {
-                entry[VTYPE_INDEX_VAL_VALL] = 0;
-                entry[VTYPE_INDEX_VAL_VALH] = 0;
-              }
-              entry[VTYPE_INDEX_VAL_VALL] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
-              curr_bit++;
-              entry[VTYPE_INDEX_VAL_VALH] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
-              curr_bit++;
-            }
-            sig->value->suppl.part.set = (ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1;
-            curr_bit++;
-          }
-          break;
-        case VDATA_R64 :
-          {
-            uint64 real_bits = 0;
-            for( i=0; i<64; i++ ) {
-              real_bits |= (uint64)ren->data[curr_bit>>3] << (i - curr_bit);
-              curr_bit++;
-            }
-            sig->value->value.r64->val = sys_task_bitstoreal( real_bits );
-          }
-          break;
-        case VDATA_R32 :
-          {
-            uint64 real_bits = 0;
-            for( i=0; i<32; i++ ) {
-              real_bits |= (uint64)ren->data[curr_bit>>3] << (i - curr_bit);
-              curr_bit++;
-            }
-            sig->value->value.r32->val = (float)sys_task_bitstoreal( real_bits );
-          }
-          break;
-        default :  assert( 0 );  break;
+
+    /* Walk through each signal and assign its stored value back */
+    for( i=0; i<funit->sig_size; i++ ) {
+      vsignal* sig = funit->sigs[i];
+      curr = reentrant_restore_vector( sig->value, curr, TRUE );
+      if( sig->value->suppl.part.data_type == VDATA_UL ) {
+        sig->value->suppl.part.set = ren_stack[curr++] & 0x1;
       }
     }
 
-    /* Walk through each bit in the compressed data array and assign it back to its expression */
-    for( j=0; j<funit->exp_size; j++ ) {
-      expression* exp = funit->exps[j];
-      if( exp == expr ) {
-        curr_bit += (expr->value->width * 2);
-      } else {
-        if( (EXPR_OWNS_VEC( exp->op ) == 1) && (EXPR_IS_STATIC( exp ) == 0) ) {
-          switch( exp->value->suppl.part.data_type ) {
-            case VDATA_UL :
-              {
-                for( i=0; i<exp->value->width; i++ ) {
-                  ulong* entry = exp->value->value.ul[UL_DIV(i)];
-                  if( UL_MOD(i) == 0 ) {
-                    entry[VTYPE_INDEX_VAL_VALL] = 0;
-                    entry[VTYPE_INDEX_VAL_VALH] = 0;
-                  }
-                  entry[VTYPE_INDEX_VAL_VALL] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
-                  curr_bit++;
-                  entry[VTYPE_INDEX_VAL_VALH] |= (ulong)((ren->data[curr_bit>>3] >> (curr_bit & 0x7)) & 0x1) << UL_MOD(i);
-                  curr_bit++;
-                }
-              }
-              break;
-            case VDATA_R64 :
-              {
-                uint64 real_bits = 0;
-                for( i=0; i<64; i++ ) {
-                  real_bits |= (uint64)ren->data[curr_bit>>3] << (i - curr_bit);
-                  curr_bit++;
-                }
-                exp->value->value.r64->val = sys_task_bitstoreal( real_bits );
-              }
-              break;
-            case VDATA_R32 :
-              {
-                uint64 real_bits = 0;
-                for( i=0; i<32; i++ ) {
-                  real_bits |= (uint64)ren->data[curr_bit>>3] << (i - curr_bit);
-                  curr_bit++;
-                }
-                exp->value->value.r32->val = (float)sys_task_bitstoreal( real_bits );
-              }
-              break;
-            default :  assert( 0 );
-          }
-        }
-      }
-      for( i=0; i<(((ESUPPL_BITS_TO_STORE % 2) == 0) ? ESUPPL_BITS_TO_STORE : (ESUPPL_BITS_TO_STORE + 1)); i++ ) {
-        switch( i ) {
-          case 0 :  exp->suppl.part.left_changed  = (ren->data[curr_bit>>3] >> (curr_bit & 0x7));  break;
-          case 1 :  exp->suppl.part.right_changed = (ren->data[curr_bit>>3] >> (curr_bit & 0x7));  break;
-          case 2 :  exp->suppl.part.eval_t        = (ren->data[curr_bit>>3] >> (curr_bit & 0x7));  break;
-          case 3 :  exp->suppl.part.eval_f        = (ren->data[curr_bit>>3] >> (curr_bit & 0x7));  break;
-          case 4 :  exp->suppl.part.prev_called   = (ren->data[curr_bit>>3] >> (curr_bit & 0x7));  break;
-        }
-        curr_bit++;
+    /* Walk through each expression and assign its stored value back */
+    for( i=0; i<funit->exp_size; i++ ) {
+      expression* exp  = funit->exps[i];
+      ulong       bits;
+      if( (EXPR_OWNS_VEC( exp->op ) == 1) && (EXPR_IS_STATIC( exp ) == 0) ) {
+        curr = reentrant_restore_vector( exp->value, curr, (exp != expr) );
       }
+      bits = ren_stack[curr++];
+      exp->suppl.part.left_changed  = (bits >> 0) & 0x1;
+      exp->suppl.part.right_changed = (bits >> 1) & 0x1;
+      exp->suppl.part.eval_t        = (bits >> 2) & 0x1;
+      exp->suppl.part.eval_f        = (bits >> 3) & 0x1;
+      exp->suppl.part.prev_called   = (bits >> 4) & 0x1;
     }
 
     /*
-     If the current functional unit is a named block, restore the rest of the bits for the parent functional units
+     If the current functional unit is a named block, restore the rest of the values for the parent functional units
      in this reentrant task/function.
     */
     if( funit->suppl.part.type == FUNIT_ANAMED_BLOCK ) {
-      reentrant_restore_data_bits( funit->parent, ren, curr_bit, expr );
+      reentrant_restore_data( funit->parent, curr, expr );
     }
 
   }
@@ -342,43 +287,37 @@ static void reentrant_restore_data_bits(
 }
 
 /*!
- \return Returns a pointer to the newly created reentrant structure.
+ \return Returns a pointer to the newly pushed reentrant frame (or NULL if there is nothing to store).
 
- Allocates and initializes the reentrant structure for the given functional unit,
- compressing and packing the bits into the given data structure.
+ Pushes a new frame onto the reentrant frame stack for the given functional unit, saving the current
+ value of all of its signals and expressions.
 */
 reentrant* reentrant_create(
   func_unit* funit  /*!< Pointer to functional unit to create a new reentrant structure for */
 ) { PROFILE(REENTRANT_CREATE);
 
-  reentrant*   ren  = NULL;  /* Pointer to newly created reentrant structure */
-  int          data_size;    /* Number of uint8s needed to store the given functional unit */
-  unsigned int bits = 0;     /* Number of bits needed to store signal values */
-  int          i;            /* Loop iterator */
+  reentrant*   ren  = NULL;           /* Pointer to newly created reentrant structure */
+  unsigned int base = ren_stack_top;  /* Index of the first word of the new frame */
 
-  /* Get size needed to store data */
-  bits = reentrant_count_afu_bits( funit );
+  /* Save the current functional unit values onto the top of the frame stack */
+  reentrant_store_data( funit );
 
-  /* Calculate data size */
-  data_size = ((bits & 0x7) == 0) ? (bits >> 3) : ((bits >> 3) + 1);
+  /* If there is data stored, create a frame structure for it */
+  if( ren_stack_top > base ) {
 
-  /* If there is data to store, allocate the needed memory and populate it */
-  if( data_size > 0 ) {
-
-    /* Allocate the structure */
-    ren = (reentrant*)malloc_safe( sizeof( reentrant ) );
-
-    /* Set the data size */
-    ren->data_size = data_size;
-
-    /* Allocate and initialize memory for data */
-    ren->data = (uint8*)malloc_safe( sizeof( uint8 ) * ren->data_size );
-    for( i=0; i<data_size; i++ ) {
-      ren->data[i] = 0;
+    /* Reuse a frame structure from the free list, if one is available */
+    if( ren_free_head != NULL ) {
+      ren           = ren_free_head;
+      ren_free_head = ren->prev;
+    } else {
+      ren = (reentrant*)malloc_safe( sizeof( reentrant ) );
     }
 
-    /* Walk through the signal list in the reentrant functional unit, compressing and saving vector values */
-    reentrant_store_data_bits( funit, ren, 0 );
+    ren->base     = base;
+    ren->size     = ren_stack_top - base;
+    ren->released = FALSE;
+    ren->prev     = ren_top;
+    ren_top       = ren;
 
   }
 
@@ -389,8 +328,9 @@ reentrant* reentrant_create(
 }
 
 /*!
- Pops data back into the given functional unit and deallocates all memory associated
- with the given reentrant structure.
+ Pops data back into the given functional unit and releases the given frame.  Since tasks containing delays
+ may return in a different order than they were called, frames that are not at the top of the stack are
+ marked as released and are reclaimed once all of the frames above them have been popped.
 */
 void reentrant_dealloc(
   reentrant*  ren,    /*!< Pointer to the reentrant structure to deallocate from memory */
@@ -400,19 +340,100 @@ void reentrant_dealloc(
 
   if( ren != NULL ) {
 
-    /* If we have data being stored, pop it */
-    if( ren->data_size > 0 ) {
+    /* Assign the stored values back to their signals and expressions */
+    reentrant_restore_data( funit, ren->base, expr );
+
+    /* Release the frame and pop all released frames from the top of the stack */
+    ren->released = TRUE;
+    while( (ren_top != NULL) && ren_top->released ) {
+      reentrant* tmp = ren_top;
+      ren_top       = tmp->prev;
+      ren_stack_top = tmp->base;
+      tmp->prev     = ren_free_head;
+      ren_free_head = tmp;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates the reentrant frame stack and all frame structures.
+*/
+void reentrant_dealloc_all() { PROFILE(REENTRANT_DEALLOC_ALL);
+
+  reentrant* tmp;
+
+  /* Deallocate all frames still on the stack */
+  while( ren_top != NULL ) {
+    tmp     = ren_top;
+    ren_top = tmp->prev;
+    free_safe( tmp, sizeof( reentrant ) );
+  }
+
+  /* Deallocate all frames in the free list */
+  while( ren_free_head != NULL ) {
+    tmp           = ren_free_head;
+    ren_free_head = tmp->prev;
+    free_safe( tmp, sizeof( reentrant ) );
+  }
+
+  /* Deallocate the frame stack region */
+  free_safe( ren_stack, (sizeof( ulong ) * ren_stack_size) );
+  ren_stack      = NULL;
+  ren_stack_size = 0;
+  ren_stack_top  = 0;
+
+  PROFILE_END;
+
+}
+
+#ifndef VPI_ONLY
+/*!
+ \throws anonymous checkpoint_write_data
+
+ Writes the contents of the reentrant frame stack to a simulation checkpoint file.  Frames are written from
+ the bottom of the stack to the top.
+*/
+void reentrant_checkpoint_write(
+  FILE* file  /*!< Pointer to checkpoint file to write to */
+) { PROFILE(REENTRANT_CHECKPOINT_WRITE);
+
+  unsigned int num = 0;
+  unsigned int i;
+  reentrant*   ren;
+  reentrant**  frames = NULL;
+
+  checkpoint_write_data( file, &ren_stack_top, sizeof( ren_stack_top ) );
+  checkpoint_write_data( file, ren_stack, (sizeof( ulong ) * ren_stack_top) );
+
+  for( ren=ren_top; ren!=NULL; ren=ren->prev ) {
+    num++;
+  }
+
+  checkpoint_write_data( file, &num, sizeof( num ) );
 
-      /* Walk through each bit in the compressed data array and assign it back to its signal */
-      reentrant_restore_data_bits( funit, ren, 0, expr );
+  if( num > 0 ) {
 
-      /* Deallocate the data uint8 array */
-      free_safe( ren->data, (sizeof( uint8 ) * ren->data_size) );
+    frames = (reentrant**)malloc_safe_nolimit( sizeof( reentrant* ) * num );
+    for( ren=ren_top, i=num; ren!=NULL; ren=ren->prev ) {
+      frames[--i] = ren;
+    }
 
+    Try {
+      for( i=0; i<num; i++ ) {
+        checkpoint_write_data( file, &(frames[i]->base), sizeof( frames[i]->base ) );
+        checkpoint_write_data( file, &(frames[i]->size), sizeof( frames[i]->size ) );
+        checkpoint_write_data( file, &(frames[i]->released), sizeof( frames[i]->released ) );
+      }
+    } Catch_anonymous {
+      free_safe( frames, (sizeof( reentrant* ) * num) );
+      Throw 0;
     }
 
-    /* Deallocate memory allocated for this reentrant structure */
-    free_safe( ren, sizeof( reentrant ) );
+    free_safe( frames, (sizeof( reentrant* ) * num) );
 
   }
 
@@ -420,3 +441,59 @@ void reentrant_dealloc(
 
 }
 
+/*!
+ \throws anonymous checkpoint_read_data checkpoint_read_data
+
+ Restores the contents of the reentrant frame stack from a simulation checkpoint file.  The frame stack must
+ be empty when this function is called.
+*/
+void reentrant_checkpoint_read(
+  FILE* file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(REENTRANT_CHECKPOINT_READ);
+
+  unsigned int top;
+  unsigned int num;
+  unsigned int i;
+
+  assert( (ren_top == NULL) && (ren_stack_top == 0) );
+
+  checkpoint_read_data( file, &top, sizeof( top ) );
+  reentrant_stack_reserve( top );
+  checkpoint_read_data( file, ren_stack, (sizeof( ulong ) * top) );
+  ren_stack_top = top;
+
+  checkpoint_read_data( file, &num, sizeof( num ) );
+
+  for( i=0; i<num; i++ ) {
+    reentrant* ren = (reentrant*)malloc_safe( sizeof( reentrant ) );
+    ren->prev = ren_top;
+    ren_top   = ren;
+    checkpoint_read_data( file, &(ren->base), sizeof( ren->base ) );
+    checkpoint_read_data( file, &(ren->size), sizeof( ren->size ) );
+    checkpoint_read_data( file, &(ren->released), sizeof( ren->released ) );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to the frame on the reentrant frame stack that starts at the given word (or NULL
+         if there is no such frame).
+*/
+reentrant* reentrant_find(
+  unsigned int base  /*!< Index of the first word of the frame to find */
+) { PROFILE(REENTRANT_FIND);
+
+  reentrant* ren = ren_top;
+
+  while( (ren != NULL) && ((ren->base != base) || ren->released) ) {
+    ren = ren->prev;
+  }
+
+  PROFILE_END;
+
+  return( ren );
+
+}
+#endif
@@ -26,11 +26,25 @@
 #include "defines.h"
 
 
-/*! \brief Allocates and initializes the reentrant structure for the given functional unit */
+/*! \brief Pushes a new reentrant frame for the given functional unit onto the frame stack */
 reentrant* reentrant_create( func_unit* funit );
 
-/*! \brief Deallocates all memory associated with the given reentrant structure */
+/*! \brief Restores the values stored in the given reentrant frame and pops it from the frame stack */
 void reentrant_dealloc( reentrant* ren, func_unit* funit, expression* expr );
 
+/*! \brief Deallocates the reentrant frame stack */
+void reentrant_dealloc_all();
+
+#ifndef VPI_ONLY
+/*! \brief Writes the reentrant frame stack to a simulation checkpoint file */
+void reentrant_checkpoint_write( FILE* file );
+
+/*! \brief Restores the reentrant frame stack from a simulation checkpoint file */
+void reentrant_checkpoint_read( FILE* file );
+
+/*! \brief Finds the reentrant frame that starts at the given frame stack word */
+reentrant* reentrant_find( unsigned int base );
+#endif
+
 #endif
 
@@ -83,12 +83,42 @@ int delay_expr_type = DELAY_EXPR_DEFAULT;
 /*! Name of preprocessor filename to use */
 char* ppfilename = NULL;
 
+/*! Name of directory to cache preprocessed Verilog files in */
+char* ppcache_dir = NULL;
+
 /*! Specifies if -i option was specified */
 bool instance_specified = FALSE;
 
 /*! Specifies timestep increment to display current time */
 uint64 timestep_update = 0;
 
+/*! Specifies the first dumpfile timestep that is scored (set by the -start-time option) */
+uint64 score_start_time = 0;
+
+/*! Specifies the last dumpfile timestep that is scored (set by the -end-time option) */
+uint64 score_end_time = 0xffffffffffffffffLL;
+
+/*! Specifies if the -start-time option was specified */
+static bool start_time_specified = FALSE;
+
+/*! Specifies if the -end-time option was specified */
+static bool end_time_specified = FALSE;
+
+/*! Name of the file to write simulation checkpoints to (set by the -checkpoint option) */
+char* checkpoint_file = NULL;
+
+/*! Number of simulated timesteps between checkpoints (set by the -checkpoint-steps option) */
+uint64 checkpoint_steps = 0;
+
+/*! Number of minutes between checkpoints (set by the -checkpoint-minutes option) */
+unsigned int checkpoint_minutes = 0;
+
+/*! Specifies if scoring should resume from the checkpoint file (set by the -resume option) */
+bool checkpoint_resume = FALSE;
+
+/*! Number of processes that score time windows of a VCD dumpfile in parallel (set by the -vcd-shards option) */
+unsigned int vcd_shards = 0;
+
 /*! Specifies how race conditions should be handled */
 int flag_race_check = WARNING;
 
@@ -172,9 +202,11 @@ extern char      score_run_path[4096];
 extern bool      warnings_suppressed;
 extern str_link* sim_plusargs_head;
 extern str_link* sim_plusargs_tail;
-
+extern str_link* two_state_head;
+extern str_link* two_state_tail;
 
 extern void process_timescale( const char* txt, bool report );
+extern void pplexer_include_cache_clear();
 extern void define_macro( const char* name, const char* value );
 
 
@@ -232,10 +264,31 @@ static void score_usage() {
   printf( "      -v <filename>                Name of specific Verilog file to score.\n" );
   printf( "      -D <define_name>(=<value>)   Defines the specified name to 1 or the specified value.\n" );
   printf( "      -p <filename>                Specifies name of file to use for preprocessor output.\n" );
+  printf( "      -ppcache <directory>         Specifies an existing directory in which to cache the preprocessed contents of each\n" );
+  printf( "                                     Verilog file.  Later score runs that use the same directory skip preprocessing\n" );
+  printf( "                                     files whose contents, include paths and defines have not changed.  The directory\n" );
+  printf( "                                     may be shared by score runs that are running at the same time.\n" );
   printf( "      -P <parameter_scope>=<value> Performs a defparam on the specified parameter with value.\n" );
   printf( "      -T min|typ|max               Specifies value to use in delay expressions of the form min:typ:max.\n" );
   printf( "      -ts <number>                 If design is being scored, specifying this option will output\n" );
   printf( "                                     the current timestep (by increments of <number>) to standard output.\n" );
+  printf( "      -start-time <number>         Only scores the dumpfile value changes from the specified timestep onwards.  The\n" );
+  printf( "                                     signal values at this timestep are taken from the earlier part of the dumpfile.\n" );
+  printf( "                                     The timestep before it is simulated to assign them, so values held just before\n" );
+  printf( "                                     this timestep can still add line, combinational, event and FSM coverage.\n" );
+  printf( "                                     FST and LXT dumpfile blocks that end before this timestep are not decoded.\n" );
+  printf( "      -end-time <number>           Stops scoring the dumpfile after the specified timestep.  The rest of the dumpfile\n" );
+  printf( "                                     is not read.\n" );
+  printf( "      -checkpoint <filename>       Periodically saves the simulation state to the specified file while scoring the\n" );
+  printf( "                                     dumpfile.  Unless -checkpoint-steps or -checkpoint-minutes is specified, a\n" );
+  printf( "                                     checkpoint is saved every 30 minutes.\n" );
+  printf( "      -checkpoint-steps <number>   Saves a checkpoint after every <number> simulated timesteps.\n" );
+  printf( "      -checkpoint-minutes <number> Saves a checkpoint every <number> minutes.\n" );
+  printf( "      -resume                      Continues scoring from the state saved in the -checkpoint file, if it exists.  The\n" );
+  printf( "                                     CDD file, dumpfile and options must be the same as those of the interrupted run.\n" );
+  printf( "      -vcd-shards <number>         Splits the VCD dumpfile into <number> time windows that are scored in parallel by\n" );
+  printf( "                                     separate processes.  The coverage of the windows is merged into the output CDD\n" );
+  printf( "                                     file.  See the User's Guide for the coverage differences at window boundaries.\n" );
   printf( "      -S                           Outputs simulation performance information after scoring has completed.  This\n" );
   printf( "                                     information is currently only useful for the developers of Covered.\n" );
   printf( "      -g (<module>=)[1|2|3]        Selects generation of Verilog syntax that the parser will handle.  If\n" );
@@ -703,6 +756,90 @@ static bool score_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-start-time", argv[i], 11 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( start_time_specified ) {
+          print_output( "Only one -start-time option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          score_start_time     = ato64( argv[i] );
+          start_time_specified = TRUE;
+          score_add_args( argv[i-1], argv[i] );
+          if( end_time_specified && (score_start_time > score_end_time) ) {
+            print_output( "The -end-time value must not be less than the -start-time value", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-end-time", argv[i], 9 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( end_time_specified ) {
+          print_output( "Only one -end-time option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          score_end_time     = ato64( argv[i] );
+          end_time_specified = TRUE;
+          score_add_args( argv[i-1], argv[i] );
+          if( start_time_specified && (score_end_time < score_start_time) ) {
+            print_output( "The -end-time value must not be less than the -start-time value", FATAL, __FILE__, __LINE__ );
+            Throw 0;
+          }
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-checkpoint-steps", argv[i], 17 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( checkpoint_steps != 0 ) {
+          print_output( "Only one -checkpoint-steps option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( (checkpoint_steps = ato64( argv[i] )) == 0 ) {
+          print_output( "The -checkpoint-steps value must be greater than 0", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-checkpoint-minutes", argv[i], 19 ) == 0 ) {
+
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( checkpoint_minutes != 0 ) {
+          print_output( "Only one -checkpoint-minutes option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( (checkpoint_minutes = (unsigned int)atoi( argv[i] )) == 0 ) {
+          print_output( "The -checkpoint-minutes value must be greater than 0", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-checkpoint", argv[i], 11 ) == 0 ) {
+
+      /* The checkpoint options do not change the coverage results so they are not stored in the CDD file */
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( checkpoint_file != NULL ) {
+          print_output( "Only one -checkpoint option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else {
+          checkpoint_file = strdup_safe( argv[i] );
+        }
+      } else {
+        Throw 0;
+      }
+
+    } else if( strncmp( "-resume", argv[i], 7 ) == 0 ) {
+
+      checkpoint_resume = TRUE;
+
     } else if( strncmp( "-t", argv[i], 2 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -863,6 +1000,21 @@ static bool score_parse_args(
         Throw 0;
       }
 
+    } else if( strncmp( "-vcd-shards", argv[i], 11 ) == 0 ) {
+
+      /* The number of shards does not change what is scored so it is not stored in the CDD file */
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( vcd_shards != 0 ) {
+          print_output( "Only one -vcd-shards option may be present on the command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( (vcd_shards = (unsigned int)atoi( argv[i] )) == 0 ) {
+          print_output( "The -vcd-shards value must be greater than 0", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-vcd", argv[i], 4 ) == 0 ) {
 
       if( check_option_value( argc, argv, i ) ) {
@@ -1030,6 +1182,25 @@ static bool score_parse_args(
         Throw 0;
       }
  
+    } else if( strncmp( "-ppcache", argv[i], 8 ) == 0 ) {
+
+      /* The preprocessor cache does not change what is scored so it is not stored in the CDD file */
+      if( check_option_value( argc, argv, i ) ) {
+        i++;
+        if( ppcache_dir != NULL ) {
+          print_output( "Only one -ppcache option is allowed on the score command-line.  Using first value...", WARNING, __FILE__, __LINE__ );
+        } else if( directory_exists( argv[i] ) ) {
+          ppcache_dir = strdup_safe( argv[i] );
+        } else {
+          unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Preprocessor cache directory %s specified for -ppcache option does not exist.", argv[i] );
+          assert( rv < USER_MSG_LENGTH );
+          print_output( user_msg, FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else {
+        Throw 0;
+      }
+
     } else if( strncmp( "-p", argv[i], 2 ) == 0 ) {
       
       if( check_option_value( argc, argv, i ) ) {
@@ -1350,6 +1521,25 @@ void command_score(
       if( output_db == NULL ) {
         output_db = strdup_safe( DFLT_OUTPUT_CDD );
       }
+
+      /* Make sure that the checkpoint options are used together */
+      if( checkpoint_file == NULL ) {
+        if( checkpoint_resume || (checkpoint_steps > 0) || (checkpoint_minutes > 0) ) {
+          print_output( "The -resume, -checkpoint-steps and -checkpoint-minutes options require the -checkpoint option", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+      } else if( (checkpoint_steps == 0) && (checkpoint_minutes == 0) ) {
+        checkpoint_minutes = 30;
+      }
+
+      /* Shards are scored by separate processes which cannot share a checkpoint file */
+      if( (vcd_shards > 1) && (checkpoint_file != NULL) ) {
+        print_output( "The -vcd-shards and -checkpoint options cannot be used together", FATAL, __FILE__, __LINE__ );
+        Throw 0;
+      }
+      if( (vcd_shards > 1) && ((dump_mode == DUMP_FMT_LXT) || (dump_mode == DUMP_FMT_FST)) ) {
+        print_output( "The -vcd-shards option is only used when scoring a VCD dumpfile", WARNING, __FILE__, __LINE__ );
+      }
  
       /* Parse design */
       if( use_files_head != NULL ) {
@@ -1410,6 +1600,9 @@ void command_score(
   /* Deallocate memory for search engine */
   search_free_lists();
 
+  /* Deallocate the contents of included files */
+  pplexer_include_cache_clear();
+
   /* Deallocate memory for defparams */
   defparam_dealloc();
 
@@ -1422,6 +1615,10 @@ void command_score(
   /* Deallocate race ignore string list */
   str_link_delete_list( race_ignore_mod_head );
 
+  /* Deallocate the list of parsed 2-state signals (only used if the dumpfile was not scored) */
+  str_link_delete_list( two_state_head );
+  two_state_head = two_state_tail = NULL;
+
   free_safe( output_db, (strlen( output_db ) + 1) );
   free_safe( dump_file, (strlen( dump_file ) + 1) );
   free_safe( vpi_file, (strlen( vpi_file ) + 1) );
@@ -1429,6 +1626,10 @@ void command_score(
   free_safe( top_module, (strlen( top_module ) + 1) );
   free_safe( ppfilename, (strlen( ppfilename ) + 1) );
   ppfilename = NULL;
+  free_safe( ppcache_dir, (strlen( ppcache_dir ) + 1) );
+  ppcache_dir = NULL;
+  free_safe( checkpoint_file, (strlen( checkpoint_file ) + 1) );
+  checkpoint_file = NULL;
 
   free_safe( directive_filename, (strlen( directive_filename ) + 1) );
   free_safe( top_instance, (strlen( top_instance ) + 1) );
@@ -317,6 +317,7 @@ void search_add_extensions(
 void search_free_lists() { PROFILE(SEARCH_FREE_LISTS);
 
   str_link_delete_list( inc_paths_head );
+  vfile_index_clear();
   str_link_delete_list( use_files_head );
   str_link_delete_list( extensions_head );
   str_link_delete_list( no_score_head );
@@ -0,0 +1,311 @@
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     shard.c
+ \date     10/18/2026
+
+ \par
+ Sharded scoring splits the simulation of a VCD dumpfile into time windows (shards) that are scored at the same
+ time by separate processes.  The VCD reader scans the dumpfile without simulating it, which only leaves the latest
+ value of each signal in the symbol table, and forks a shard process when the scan reaches the start of each
+ window.  The shard process inherits the signal values of the scan, simulates its window and writes its coverage
+ to its own CDD file, named after the output CDD file with a ".shard<index>" suffix.
+
+ \par
+ Once every shard process has finished, the parent process reads the shard CDD files in window order, merging
+ the coverage of each instance with funit_db_merge, and writes the result to the output CDD file.  Since the
+ merge only depends on the order of the windows, the result does not depend on the order in which the shard
+ processes finish.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <assert.h>
+
+#include "binding.h"
+#include "db.h"
+#include "defines.h"
+#include "shard.h"
+#include "util.h"
+
+
+extern char         user_msg[USER_MSG_LENGTH];
+extern db**         db_list;
+extern unsigned int curr_db;
+extern uint64       num_timesteps;
+extern uint64       score_start_time;
+extern uint64       score_end_time;
+
+/*!
+ Index of the shard that is scored by this process, or -1 if this process is not a shard process.
+*/
+int shard_id = -1;
+
+/*!
+ Process IDs of the shard processes started by this process.
+*/
+static pid_t* shard_pids = NULL;
+
+/*!
+ Specifies for each shard process if it simulates the last timestep of the previous shard again.
+*/
+static bool* shard_overlaps = NULL;
+
+/*!
+ Number of elements in the shard_pids and shard_overlaps arrays.
+*/
+static unsigned int shard_num = 0;
+
+
+/*!
+ \return Returns TRUE in the new shard process; otherwise, returns FALSE.
+
+ \throws anonymous Throw
+
+ Starts a process that scores the time window from start_time to end_time of the dumpfile.  The new process
+ continues from the point of the call with the scored time window set accordingly.
+*/
+bool shard_fork(
+  uint64 start_time,  /*!< First timestep of the time window */
+  uint64 end_time,    /*!< Last timestep of the time window */
+  bool   overlap      /*!< Set to TRUE if the shard will also simulate the last timestep of the previous shard */
+) { PROFILE(SHARD_FORK);
+
+  bool  child = FALSE;
+  pid_t pid;
+
+  /* Make sure that buffered output is not written by both processes */
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  if( (pid = fork()) == -1 ) {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Unable to create a process for VCD shard %u", shard_num );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, FATAL, __FILE__, __LINE__ );
+    Throw 0;
+
+  } else if( pid == 0 ) {
+
+    shard_id         = (int)shard_num;
+    score_start_time = start_time;
+    score_end_time   = end_time;
+    child            = TRUE;
+
+    /* The shards started before this one belong to the parent process */
+    free_safe( shard_pids, (sizeof( pid_t ) * shard_num) );
+    free_safe( shard_overlaps, (sizeof( bool ) * shard_num) );
+    shard_pids     = NULL;
+    shard_overlaps = NULL;
+    shard_num      = 0;
+
+  } else {
+
+    shard_pids     = (pid_t*)realloc_safe( shard_pids, (sizeof( pid_t ) * shard_num), (sizeof( pid_t ) * (shard_num + 1)) );
+    shard_overlaps = (bool*)realloc_safe( shard_overlaps, (sizeof( bool ) * shard_num), (sizeof( bool ) * (shard_num + 1)) );
+    shard_pids[shard_num]     = pid;
+    shard_overlaps[shard_num] = overlap;
+    shard_num++;
+
+  }
+
+  PROFILE_END;
+
+  return( child );
+
+}
+
+/*!
+ \return Returns TRUE if this process has started any shard processes; otherwise, returns FALSE.
+*/
+bool shard_started() { PROFILE(SHARD_STARTED);
+
+  bool retval = (shard_num > 0);
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns an allocated string containing the name of the CDD file written by the shard process with
+         the given index.
+*/
+char* shard_db_name(
+  const char*  db,    /*!< Name of output CDD file */
+  unsigned int index  /*!< Index of shard */
+) { PROFILE(SHARD_DB_NAME);
+
+  unsigned int size = strlen( db ) + 20;
+  char*        name = (char*)malloc_safe( size );
+  unsigned int rv   = snprintf( name, size, "%s.shard%u", db, index );
+
+  assert( rv < size );
+
+  PROFILE_END;
+
+  return( name );
+
+}
+
+/*!
+ Ends the current shard process.  The exit status tells the parent process if the shard CDD file was written.
+*/
+void shard_exit(
+  bool error  /*!< Set to TRUE if the shard could not be scored */
+) { PROFILE(SHARD_EXIT);
+
+  (void)fflush( stdout );
+  (void)fflush( stderr );
+
+  PROFILE_END;
+
+  /* The open files and memory are shared with the parent process so nothing else is cleaned up */
+  _exit( error ? 1 : 0 );
+
+}
+
+/*!
+ Removes the shard CDD files and deallocates the shard process arrays.
+*/
+static void shard_dealloc(
+  const char* db  /*!< Name of output CDD file */
+) { PROFILE(SHARD_DEALLOC);
+
+  unsigned int i;
+
+  for( i=0; i<shard_num; i++ ) {
+    char* name = shard_db_name( db, i );
+    (void)remove( name );
+    free_safe( name, (strlen( name ) + 1) );
+  }
+
+  free_safe( shard_pids, (sizeof( pid_t ) * shard_num) );
+  free_safe( shard_overlaps, (sizeof( bool ) * shard_num) );
+  shard_pids     = NULL;
+  shard_overlaps = NULL;
+  shard_num      = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous Throw Throw db_read db_read db_write bind_perform
+
+ Waits for every shard process to finish and merges their CDD files, in time window order, into the given
+ output CDD file.  The current design is replaced by the merged design.  The shard CDD files are removed.
+*/
+void shard_merge(
+  const char* db  /*!< Name of output CDD file */
+) { PROFILE(SHARD_MERGE);
+
+  bool         error     = FALSE;
+  uint64       timesteps = 0;
+  unsigned int i;
+
+  /* Wait for all shards, even if one of them fails, so that no shard CDD file is left behind */
+  for( i=0; i<shard_num; i++ ) {
+    int status;
+    if( (waitpid( shard_pids[i], &status, 0 ) == -1) || !WIFEXITED( status ) || (WEXITSTATUS( status ) != 0) ) {
+      unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Scoring of VCD shard %u failed", i );
+      assert( rv < USER_MSG_LENGTH );
+      print_output( user_msg, FATAL, __FILE__, __LINE__ );
+      error = TRUE;
+    }
+  }
+
+  if( !error ) {
+
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Merging the CDD files of %u VCD shards...", shard_num );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+    Try {
+
+      /* Replace the unscored design with the first shard and merge the rest of the shards into it */
+      db_close();
+
+      for( i=0; i<shard_num; i++ ) {
+        char* name = shard_db_name( db, i );
+        curr_db = 0;
+        Try {
+          (void)db_read( name, ((i == 0) ? READ_MODE_NO_MERGE : READ_MODE_MERGE_INST_MERGE) );
+        } Catch_anonymous {
+          free_safe( name, (strlen( name ) + 1) );
+          Throw 0;
+        }
+        free_safe( name, (strlen( name ) + 1) );
+        timesteps += num_timesteps - (shard_overlaps[i] ? 1 : 0);
+      }
+
+      /* Each shard added the same leading hierarchy so only the one of the first shard is kept */
+      for( i=1; i<db_list[curr_db]->leading_hier_num; i++ ) {
+        free_safe( db_list[curr_db]->leading_hierarchies[i], (strlen( db_list[curr_db]->leading_hierarchies[i] ) + 1) );
+      }
+      db_list[curr_db]->leading_hierarchies = (char**)realloc_safe( db_list[curr_db]->leading_hierarchies, (sizeof( char* ) * db_list[curr_db]->leading_hier_num), sizeof( char* ) );
+      db_list[curr_db]->leading_hier_num    = 1;
+
+      num_timesteps = timesteps;
+
+      bind_perform( TRUE, 0 );
+
+      db_write( db, FALSE, FALSE );
+
+    } Catch_anonymous {
+      error = TRUE;
+    }
+
+  }
+
+  shard_dealloc( db );
+
+  if( error ) {
+    Throw 0;
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Stops all shard processes that were started by this process and removes their CDD files.  Called when the
+ scoring of the dumpfile fails in the parent process.
+*/
+void shard_abort(
+  const char* db  /*!< Name of output CDD file */
+) { PROFILE(SHARD_ABORT);
+
+  unsigned int i;
+
+  for( i=0; i<shard_num; i++ ) {
+    int status;
+    (void)kill( shard_pids[i], SIGTERM );
+    (void)waitpid( shard_pids[i], &status, 0 );
+  }
+
+  shard_dealloc( db );
+
+  PROFILE_END;
+
+}
+
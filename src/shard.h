@@ -0,0 +1,60 @@
+#ifndef __SHARD_H__
+#define __SHARD_H__
+
+/*
+ Copyright (c) 2026 The Covered contributors
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program;
+ if not, write to the Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+*/
+
+/*!
+ \file     shard.h
+ \date     10/18/2026
+ \brief    Contains functions for scoring time windows of a dumpfile in parallel processes.
+*/
+
+#include "defines.h"
+
+
+/*! \brief Starts a process that scores the given time window of the dumpfile. */
+bool shard_fork(
+  uint64 start_time,
+  uint64 end_time,
+  bool   overlap
+);
+
+/*! \brief Returns TRUE if this process has started any shard processes. */
+bool shard_started();
+
+/*! \brief Returns the name of the CDD file that the shard process of the given index writes. */
+char* shard_db_name(
+  const char*  db,
+  unsigned int index
+);
+
+/*! \brief Ends a shard process. */
+void shard_exit(
+  bool error
+);
+
+/*! \brief Waits for all shard processes and merges their CDD files into the given CDD file. */
+void shard_merge(
+  const char* db
+);
+
+/*! \brief Stops all shard processes and removes their CDD files. */
+void shard_abort(
+  const char* db
+);
+
+#endif
+
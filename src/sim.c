@@ -86,6 +86,7 @@
 #include "cli.h"
 #endif
 #endif
+#include "checkpoint.h"
 #include "defines.h"
 #include "expr.h"
 #include "func_unit.h"
@@ -584,17 +585,53 @@ void sim_expr_changed(
 }
 
 /*!
- \return Returns a pointer to the newly allocated and initialized thread
+ Performs the same work as \ref sim_expr_changed for an expression that uses a changed signal, following the
+ path to the root expression that was precomputed in the given fan-out.  Each step sets the changed bits of a
+ parent expression, stopping at the first parent whose bit is already set, and the root statement's threads
+ are pushed onto the active queue if the root expression was reached.
+*/
+void sim_fanout_changed(
+  const exp_fanout* fanout,  /*!< Pointer to fan-out of the changed signal to the expression */
+  const sim_time*   time     /*!< Specifies current simulation time for the thread to push */
+) { PROFILE(SIM_FANOUT_CHANGED);
 
- Allocates a new thread for simulation purposes and initializes the thread structure with
- everything that can be done at time 0.  This function does not place the thread into any
- queues (this is left to the sim_add_thread function).
+  const exp_path* step = fanout->path;
+  const exp_path* end  = fanout->path + fanout->depth;
+
+#ifdef DEBUG_MODE
+  if( debug_mode ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "In sim_fanout_changed, expr %d, op %s, line %d, depth: %u, time: %" FMT64 "u",
+                                fanout->expr->id, expression_string_op( fanout->expr->op ), fanout->expr->line, fanout->depth, time->full );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+  }
+#endif
+
+  /* Set my left_changed bit to indicate to sim_expression that it should evaluate me */
+  fanout->expr->suppl.part.left_changed = 1;
+
+  /* If the bit we need to set is already set, the rest of the path is set and the thread has been pushed */
+  while( (step < end) && ((step->expr->suppl.all & step->test) == 0) ) {
+    step->expr->suppl.all |= step->set;
+    step++;
+  }
+
+  /* If we reached the root expression, push our thread onto the active queue */
+  if( (step == end) && (fanout->stmt != NULL) ) {
+    funit_push_threads( fanout->stmt->funit, fanout->stmt, time );
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to an unused thread from the all pool
+
+ Takes the next unused thread from the all pool, allocating a new thread and adding it to the
+ end of the pool if all threads are in use.
 */
-static thread* sim_create_thread(
-  thread*    parent,  /*!< Pointer to parent thread (if one exists) of the newly created thread */
-  statement* stmt,    /*!< Pointer to the statement that is the head statement of the thread's block */
-  func_unit* funit    /*!< Pointer to functional unit containing the new thread */
-) { PROFILE(SIM_CREATE_THREAD);
+static thread* sim_alloc_thread() { PROFILE(SIM_ALLOC_THREAD);
 
   thread* thr;  /* Pointer to newly allocated thread */
 
@@ -623,6 +660,27 @@ static thread* sim_create_thread(
 
   }
 
+  PROFILE_END;
+
+  return( thr );
+
+}
+
+/*!
+ \return Returns a pointer to the newly allocated and initialized thread
+
+ Allocates a new thread for simulation purposes and initializes the thread structure with
+ everything that can be done at time 0.  This function does not place the thread into any
+ queues (this is left to the sim_add_thread function).
+*/
+static thread* sim_create_thread(
+  thread*    parent,  /*!< Pointer to parent thread (if one exists) of the newly created thread */
+  statement* stmt,    /*!< Pointer to the statement that is the head statement of the thread's block */
+  func_unit* funit    /*!< Pointer to functional unit containing the new thread */
+) { PROFILE(SIM_CREATE_THREAD);
+
+  thread* thr = sim_alloc_thread();  /* Pointer to newly allocated thread */
+
   /* Initialize the contents of the thread */
   thr->funit           = funit;
   thr->parent          = parent;
@@ -1276,6 +1334,262 @@ void sim_perform_nba(
 
 }
 
+#ifndef VPI_ONLY
+/*!
+ \return Returns a negative value if the first thread has an earlier functional unit list position than the
+         second; a positive value if it has a later position; otherwise, returns 0.
+*/
+static int sim_checkpoint_compare_position(
+  const void* a,  /*!< Pointer to first thread position to compare */
+  const void* b   /*!< Pointer to second thread position to compare */
+) {
+
+  unsigned int pa = ((const ckpt_ptr*)a)->index;
+  unsigned int pb = ((const ckpt_ptr*)b)->index;
+
+  return( (pa < pb) ? -1 : ((pa > pb) ? 1 : 0) );
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data checkpoint_write_funit
+
+ Writes the contents of the given thread to a simulation checkpoint file.  Pointers to other threads are
+ written as indices into the list of threads in use.
+*/
+static void sim_checkpoint_write_thread(
+  FILE*           file,  /*!< Pointer to checkpoint file to write to */
+  const thread*   thr,   /*!< Pointer to thread to write */
+  const ckpt_ptr* map,   /*!< Sorted pointer table of the threads in use */
+  unsigned int    num    /*!< Number of threads in use */
+) { PROFILE(SIM_CHECKPOINT_WRITE_THREAD);
+
+  int          links[3];
+  int          stmt_id = (thr->curr != NULL) ? thr->curr->exp->id : 0;
+  int          ren     = (thr->ren != NULL) ? (int)thr->ren->base : -1;
+  unsigned int pos     = funit_get_thread_position( thr->funit, thr );
+
+  links[0] = checkpoint_ptr_map_find( map, num, thr->parent );
+  links[1] = checkpoint_ptr_map_find( map, num, thr->queue_prev );
+  links[2] = checkpoint_ptr_map_find( map, num, thr->queue_next );
+
+  checkpoint_write_funit( file, thr->funit );
+  checkpoint_write_funit( file, ((thr->curr != NULL) ? thr->curr->funit : NULL) );
+  checkpoint_write_data( file, &stmt_id, sizeof( stmt_id ) );
+  checkpoint_write_data( file, links, sizeof( links ) );
+  checkpoint_write_data( file, &ren, sizeof( ren ) );
+  checkpoint_write_data( file, &(thr->suppl.all), sizeof( thr->suppl.all ) );
+  checkpoint_write_data( file, &(thr->active_children), sizeof( thr->active_children ) );
+  checkpoint_write_data( file, &(thr->curr_time.lo), sizeof( thr->curr_time.lo ) );
+  checkpoint_write_data( file, &(thr->curr_time.hi), sizeof( thr->curr_time.hi ) );
+  checkpoint_write_data( file, &(thr->curr_time.full), sizeof( thr->curr_time.full ) );
+  checkpoint_write_data( file, &(thr->curr_time.final), sizeof( thr->curr_time.final ) );
+  checkpoint_write_data( file, &pos, sizeof( pos ) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_write_data checkpoint_write_data sim_checkpoint_write_thread
+
+ Writes all threads that are in use and the contents of the active and delayed thread queues to a simulation
+ checkpoint file.  Checkpoints are only taken between timesteps, so the non-blocking assignment queue is empty.
+*/
+void sim_checkpoint_write(
+  FILE* file  /*!< Pointer to checkpoint file to write to */
+) { PROFILE(SIM_CHECKPOINT_WRITE);
+
+  unsigned int num  = 0;
+  unsigned int i;
+  thread*      thr;
+  thread**     thrs = NULL;
+  ckpt_ptr*    map  = NULL;
+  int          queues[4];
+
+  assert( nba_queue_curr_size == 0 );
+
+  /* The threads in use are at the front of the all pool */
+  for( thr=all_head; thr!=all_next; thr=thr->all_next ) {
+    num++;
+  }
+
+  if( num > 0 ) {
+    thrs = (thread**)malloc_safe_nolimit( sizeof( thread* ) * num );
+    for( thr=all_head, i=0; thr!=all_next; thr=thr->all_next, i++ ) {
+      thrs[i] = thr;
+    }
+    map = checkpoint_ptr_map_create( (void* const*)thrs, num );
+  }
+
+  queues[0] = checkpoint_ptr_map_find( map, num, active_head );
+  queues[1] = checkpoint_ptr_map_find( map, num, active_tail );
+  queues[2] = checkpoint_ptr_map_find( map, num, delayed_head );
+  queues[3] = checkpoint_ptr_map_find( map, num, delayed_tail );
+
+  Try {
+
+    checkpoint_write_data( file, &num, sizeof( num ) );
+    checkpoint_write_data( file, queues, sizeof( queues ) );
+
+    for( i=0; i<num; i++ ) {
+      sim_checkpoint_write_thread( file, thrs[i], map, num );
+    }
+
+  } Catch_anonymous {
+    free_safe( map, (sizeof( ckpt_ptr ) * num) );
+    free_safe( thrs, (sizeof( thread* ) * num) );
+    Throw 0;
+  }
+
+  free_safe( map, (sizeof( ckpt_ptr ) * num) );
+  free_safe( thrs, (sizeof( thread* ) * num) );
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns the position of the thread in its functional unit thread list.
+
+ \throws anonymous checkpoint_read_funit checkpoint_read_funit checkpoint_read_data Throw Throw
+
+ Restores the contents of the given thread from a simulation checkpoint file.
+*/
+static unsigned int sim_checkpoint_read_thread(
+  FILE*        file,  /*!< Pointer to checkpoint file to read from */
+  thread*      thr,   /*!< Pointer to thread to restore */
+  thread**     thrs,  /*!< Array of restored threads */
+  unsigned int num    /*!< Number of elements in the thrs array */
+) { PROFILE(SIM_CHECKPOINT_READ_THREAD);
+
+  func_unit*   funit;
+  int          stmt_id;
+  int          links[3];
+  int          ren;
+  unsigned int pos;
+  unsigned int i;
+
+  thr->funit = checkpoint_read_funit( file );
+  funit      = checkpoint_read_funit( file );
+  checkpoint_read_data( file, &stmt_id, sizeof( stmt_id ) );
+  checkpoint_read_data( file, links, sizeof( links ) );
+  checkpoint_read_data( file, &ren, sizeof( ren ) );
+  checkpoint_read_data( file, &(thr->suppl.all), sizeof( thr->suppl.all ) );
+  checkpoint_read_data( file, &(thr->active_children), sizeof( thr->active_children ) );
+  checkpoint_read_data( file, &(thr->curr_time.lo), sizeof( thr->curr_time.lo ) );
+  checkpoint_read_data( file, &(thr->curr_time.hi), sizeof( thr->curr_time.hi ) );
+  checkpoint_read_data( file, &(thr->curr_time.full), sizeof( thr->curr_time.full ) );
+  checkpoint_read_data( file, &(thr->curr_time.final), sizeof( thr->curr_time.final ) );
+  checkpoint_read_data( file, &pos, sizeof( pos ) );
+
+  /* Find the current statement from the ID of its expression */
+  thr->curr = NULL;
+  if( funit != NULL ) {
+    expression* exp = funit_lookup_expression( stmt_id, funit );
+    if( (exp == NULL) || !ESUPPL_IS_ROOT( exp->suppl ) ) {
+      print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+    thr->curr = exp->parent->stmt;
+  }
+
+  for( i=0; i<3; i++ ) {
+    if( links[i] >= (int)num ) {
+      print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+  }
+
+  thr->parent     = (links[0] < 0) ? NULL : thrs[links[0]];
+  thr->queue_prev = (links[1] < 0) ? NULL : thrs[links[1]];
+  thr->queue_next = (links[2] < 0) ? NULL : thrs[links[2]];
+  thr->ren        = (ren < 0) ? NULL : reentrant_find( ren );
+
+  PROFILE_END;
+
+  return( pos );
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data checkpoint_read_data sim_checkpoint_read_thread Throw
+
+ Replaces the threads that were created when the design was read with the threads stored in a simulation
+ checkpoint file, restoring the active and delayed thread queues and the thread list of each functional unit.
+ The reentrant frame stack must be restored before this function is called.
+*/
+void sim_checkpoint_read(
+  FILE* file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(SIM_CHECKPOINT_READ);
+
+  unsigned int num;
+  unsigned int i;
+  thread*      thr;
+  thread**     thrs = NULL;
+  ckpt_ptr*    pos  = NULL;
+  int          queues[4];
+
+  /* Remove the threads that were created when the design was read */
+  for( thr=all_head; thr!=all_next; thr=thr->all_next ) {
+    funit_delete_thread( thr->funit, thr );
+  }
+  all_next     = all_head;
+  active_head  = active_tail  = NULL;
+  delayed_head = delayed_tail = NULL;
+
+  checkpoint_read_data( file, &num, sizeof( num ) );
+  checkpoint_read_data( file, queues, sizeof( queues ) );
+
+  for( i=0; i<4; i++ ) {
+    if( queues[i] >= (int)num ) {
+      print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+  }
+
+  if( num > 0 ) {
+
+    thrs = (thread**)malloc_safe_nolimit( sizeof( thread* ) * num );
+    pos  = (ckpt_ptr*)malloc_safe_nolimit( sizeof( ckpt_ptr ) * num );
+
+    for( i=0; i<num; i++ ) {
+      thrs[i] = sim_alloc_thread();
+    }
+
+    Try {
+      for( i=0; i<num; i++ ) {
+        pos[i].ptr   = thrs[i];
+        pos[i].index = sim_checkpoint_read_thread( file, thrs[i], thrs, num );
+      }
+    } Catch_anonymous {
+      free_safe( pos, (sizeof( ckpt_ptr ) * num) );
+      free_safe( thrs, (sizeof( thread* ) * num) );
+      Throw 0;
+    }
+
+    /* Add the threads to their functional unit thread lists in their original order */
+    qsort( pos, num, sizeof( ckpt_ptr ), sim_checkpoint_compare_position );
+    for( i=0; i<num; i++ ) {
+      thr = (thread*)pos[i].ptr;
+      funit_add_thread( thr->funit, thr );
+    }
+
+    active_head  = (queues[0] < 0) ? NULL : thrs[queues[0]];
+    active_tail  = (queues[1] < 0) ? NULL : thrs[queues[1]];
+    delayed_head = (queues[2] < 0) ? NULL : thrs[queues[2]];
+    delayed_tail = (queues[3] < 0) ? NULL : thrs[queues[3]];
+
+    free_safe( pos, (sizeof( ckpt_ptr ) * num) );
+    free_safe( thrs, (sizeof( thread* ) * num) );
+
+  }
+
+  PROFILE_END;
+
+}
+#endif
+
 /*!
  Deallocates all allocated memory for simulation code.
 */
@@ -1300,6 +1614,9 @@ void sim_dealloc() { PROFILE(SIM_DEALLOC);
   /* Deallocate the non-blocking assignment queue */
   free_safe( nba_queue, (sizeof( nonblock_assign ) * nba_queue_size) );
 
+  /* Deallocate the reentrant frame stack */
+  reentrant_dealloc_all();
+
 #ifdef DEBUG_MODE
 #ifndef VPI_ONLY
   /* Clear CLI debug mode */
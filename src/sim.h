@@ -58,6 +58,12 @@ void sim_expr_changed(
   const sim_time* time
 );
 
+/*! \brief Adds the statement of a changed signal's expression to pre-simulation statement queue using its precomputed fan-out. */
+void sim_fanout_changed(
+  const exp_fanout* fanout,
+  const sim_time*   time
+);
+
 /*! \brief Creates a thread for the given statement and adds it to the thread simulation queue. */
 thread* sim_add_thread(
   thread*         parent,
@@ -119,6 +125,18 @@ void sim_perform_nba(
   const sim_time* time
 );
 
+#ifndef VPI_ONLY
+/*! \brief Writes the threads and thread queues to a simulation checkpoint file. */
+void sim_checkpoint_write(
+  FILE* file
+);
+
+/*! \brief Restores the threads and thread queues from a simulation checkpoint file. */
+void sim_checkpoint_read(
+  FILE* file
+);
+#endif
+
 /*! \brief Deallocates all memory for simulator */
 void sim_dealloc();
 
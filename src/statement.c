@@ -104,6 +104,7 @@
 #include "defines.h"
 #include "statement.h"
 #include "expr.h"
+#include "func_unit.h"
 #include "util.h"
 #include "link.h"
 #include "sim.h"
@@ -440,7 +441,7 @@ void statement_db_read(
     } else {
 
       /* Find associated root expression */
-      expression* exp = exp_link_find( id, curr_funit->exps, curr_funit->exp_size );
+      expression* exp = funit_lookup_expression( id, curr_funit );
       assert( exp != NULL );
 
       stmt = statement_create( exp, curr_funit );
@@ -251,6 +251,7 @@ static void symtable_init(
   symtab->size     = (msb - lsb) + 2;
   symtab->value    = (char*)malloc_safe( symtab->size );
   symtab->value[0] = '\0';
+  symtab->real_set = FALSE;
 
   PROFILE_END;
 
@@ -271,6 +272,7 @@ symtable* symtable_create() { PROFILE(SYMTABLE_CREATE);
   symtab->entry.sig  = NULL;
   symtab->entry_type = 0;
   symtab->value      = NULL;
+  symtab->real_set   = FALSE;
   for( i=0; i<94; i++ ) {
     symtab->table[i] = NULL;
   }
@@ -474,13 +476,14 @@ void symtable_set_value(
 
   if( (curr != NULL) && (curr->value != NULL) ) {
 
-    if( curr->value[0] != '\0' ) {
+    if( (curr->value[0] != '\0') || curr->real_set ) {
       set = TRUE;
     }
 
     /* printf( "strlen( value ): %d, curr->size: %d\n", strlen( value ), curr->size ); */
     assert( strlen( value ) < curr->size );     /* Useful for debugging but not necessary */
     strcpy( curr->value, value );
+    curr->real_set = FALSE;
 
     if( !set ) {
 
@@ -497,10 +500,66 @@ void symtable_set_value(
 }
 
 /*!
- \throws anonymous vsignal_vcd_assign
+ Performs a binary search of the specified tree to find all matching symtable entries.
+ When the signal is found, the specified real value is stored in binary form in the symtable
+ entry so that it does not need to be converted to and from a string.  Expression and FSM
+ entries only take string values so the value is stored in string form for these.
+*/
+void symtable_set_real(
+  const char* sym,   /*!< Name of symbol to find in the table */
+  double      value  /*!< Real value to set symtable entry to when match found */
+) { PROFILE(SYMTABLE_SET_REAL);
+
+  symtable*   curr;  /* Pointer to current symtable */
+  const char* ptr;   /* Pointer to current character in symbol */
+
+  assert( vcd_symtab != NULL );
+  assert( sym[0] != '\0' );
+
+  curr = vcd_symtab;
+  ptr  = sym;
+
+  while( (curr != NULL) && (*ptr != '\0') ) {
+    curr = curr->table[(int)(*ptr) - 33];
+    ptr++;
+  }
+
+  if( (curr != NULL) && (curr->value != NULL) ) {
+
+    if( curr->entry_type == 1 ) {
+
+      /* Place in postsim queue if this entry has not been set this timestep yet */
+      if( (curr->value[0] == '\0') && !curr->real_set ) {
+        timestep_tab[postsim_size] = curr;
+        postsim_size++;
+      }
+
+      curr->value[0] = '\0';
+      curr->real     = value;
+      curr->real_set = TRUE;
+
+    } else {
+
+      char         str[32];
+      unsigned int rv = snprintf( str, 32, "%.17g", value );
+      assert( rv < 32 );
+      symtable_set_value( sym, str );
+
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous vsignal_vcd_assign vsignal_vcd_assign_real
 
  Traverses simulation symentry array, assigning stored string value to the
- stored signal.
+ stored signal.  Signal changes are propagated in a second pass so that a signal
+ that is split across several VCD symbols (or assigned through several aliases)
+ only propagates its change to its expressions once per timestep.
 */
 void symtable_assign(
   const sim_time* time  /*!< Pointer to current simulation time structure */
@@ -509,12 +568,17 @@ void symtable_assign(
   symtable* curr;  /* Pointer to current symtable entry */
   int       i;     /* Loop iterator */
 
+  /* Assign all values for this timestep */
   for( i=0; i<postsim_size; i++ ) {
     curr = timestep_tab[i];
     if( curr->entry_type == 1 ) {
       sym_sig* sig = curr->entry.sig;
       while( sig != NULL ) {
-        vsignal_vcd_assign( sig->sig, curr->value, sig->msb, sig->lsb, time );
+        if( curr->real_set ) {
+          vsignal_vcd_assign_real( sig->sig, curr->real );
+        } else {
+          vsignal_vcd_assign( sig->sig, curr->value, sig->msb, sig->lsb );
+        }
         sig = sig->next;
       }
     } else if( curr->entry_type == 2 ) {
@@ -527,6 +591,22 @@ void symtable_assign(
       fsm_vcd_assign( curr->entry.table, curr->value );
     }
     curr->value[0] = '\0';
+    curr->real_set = FALSE;
+  }
+
+  /* Propagate each changed signal once, only to the expressions reading the bits that changed */
+  for( i=0; i<postsim_size; i++ ) {
+    curr = timestep_tab[i];
+    if( curr->entry_type == 1 ) {
+      sym_sig* sig = curr->entry.sig;
+      while( sig != NULL ) {
+        if( sig->sig->suppl.part.vcd_changed == 1 ) {
+          sig->sig->suppl.part.vcd_changed = 0;
+          vsignal_propagate_range( sig->sig, sig->sig->changed_lsb, sig->sig->changed_msb, time );
+        }
+        sig = sig->next;
+      }
+    }
   }
   postsim_size = 0;
 
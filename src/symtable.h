@@ -66,6 +66,12 @@ void symtable_set_value(
   const char* value
 );
 
+/*! \brief Sets all matching symtable entries to specified real value */
+void symtable_set_real(
+  const char* sym,
+  double      value
+);
+
 /*! \brief Assigns stored values to all associated signals stored in specified symbol table. */
 void symtable_assign(
   const sim_time* time
@@ -202,6 +202,17 @@ void sys_task_srandom(
 
 }
 
+/*!
+ \return Returns the current global seed value.
+*/
+long sys_task_get_random_seed() { PROFILE(SYS_TASK_GET_RANDOM_SEED);
+
+  PROFILE_END;
+
+  return( random_seed );
+
+}
+
 /*!
  \return Returns a randomly generated signed value
 */
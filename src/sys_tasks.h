@@ -30,6 +30,9 @@ void sys_task_srandom(
   long seed
 );
 
+/*! \brief Returns the current global seed value. */
+long sys_task_get_random_seed();
+
 /*! \brief Performs $random system task call. */
 long sys_task_random(
   long* seed
@@ -62,6 +62,7 @@ extern str_link*    score_args_head;
 extern str_link*    score_args_tail;
 extern void         reset_pplexer( const char* filename, FILE* out );
 extern int          PPVLlex( void );
+extern void         pplexer_include_cache_clear();
 extern str_link*    merge_in_head;
 extern str_link*    merge_in_tail;
 extern int          merge_in_num;
@@ -2147,6 +2148,9 @@ int tcl_func_preprocess_verilog(
     } else {
       reset_pplexer( argv[1], out );
       PPVLlex();
+
+      /* Do not keep included files around since they may change before the next file is preprocessed */
+      pplexer_include_cache_clear();
     }
 
   } Catch_anonymous {
@@ -35,11 +35,151 @@
 #include "util.h"
 
 
+/*!
+ \return Returns the height of the subtree rooted at the given node.
+*/
+static int tree_height(
+  const tnode* node  /*!< Pointer to subtree root (may be NULL) */
+) {
+
+  return( (node == NULL) ? 0 : node->height );
+
+}
+
+/*!
+ Recalculates the height of the given node from the heights of its children.
+*/
+static void tree_update_height(
+  tnode* node  /*!< Pointer to node to update */
+) {
+
+  int lheight = tree_height( node->left );
+  int rheight = tree_height( node->right );
+
+  node->height = ((lheight > rheight) ? lheight : rheight) + 1;
+
+}
+
+/*!
+ Replaces the given node with the given replacement node in the parent of the given node (or the root pointer
+ if the given node is the root of the tree).
+*/
+static void tree_replace(
+  tnode*  node,  /*!< Pointer to node to replace */
+  tnode*  repl,  /*!< Pointer to replacement node (may be NULL) */
+  tnode** root   /*!< Pointer to root of tree */
+) {
+
+  if( node->up == NULL ) {
+    *root = repl;
+  } else if( node->up->left == node ) {
+    node->up->left = repl;
+  } else {
+    assert( node->up->right == node );
+    node->up->right = repl;
+  }
+
+  if( repl != NULL ) {
+    repl->up = node->up;
+  }
+
+}
+
+/*!
+ \return Returns a pointer to the new root of the rotated subtree.
+
+ Performs a left rotation of the subtree rooted at the given node.
+*/
+static tnode* tree_rotate_left(
+  tnode*  node,  /*!< Pointer to root of subtree to rotate */
+  tnode** root   /*!< Pointer to root of tree */
+) {
+
+  tnode* child = node->right;
+
+  node->right = child->left;
+  if( child->left != NULL ) {
+    child->left->up = node;
+  }
+
+  tree_replace( node, child, root );
+  child->left = node;
+  node->up    = child;
+
+  tree_update_height( node );
+  tree_update_height( child );
+
+  return( child );
+
+}
+
+/*!
+ \return Returns a pointer to the new root of the rotated subtree.
+
+ Performs a right rotation of the subtree rooted at the given node.
+*/
+static tnode* tree_rotate_right(
+  tnode*  node,  /*!< Pointer to root of subtree to rotate */
+  tnode** root   /*!< Pointer to root of tree */
+) {
+
+  tnode* child = node->left;
+
+  node->left = child->right;
+  if( child->right != NULL ) {
+    child->right->up = node;
+  }
+
+  tree_replace( node, child, root );
+  child->right = node;
+  node->up     = child;
+
+  tree_update_height( node );
+  tree_update_height( child );
+
+  return( child );
+
+}
+
+/*!
+ Walks from the given node up to the root of the tree, updating node heights and performing rotations
+ wherever the heights of the two subtrees of a node differ by more than one.  This keeps the tree balanced
+ (AVL) so that lookups stay logarithmic even when keys are added in sorted order.
+*/
+static void tree_rebalance(
+  tnode*  node,  /*!< Pointer to lowest node whose subtree changed */
+  tnode** root   /*!< Pointer to root of tree */
+) {
+
+  while( node != NULL ) {
+
+    int balance = tree_height( node->left ) - tree_height( node->right );
+
+    if( balance > 1 ) {
+      if( tree_height( node->left->left ) < tree_height( node->left->right ) ) {
+        (void)tree_rotate_left( node->left, root );
+      }
+      node = tree_rotate_right( node, root );
+    } else if( balance < -1 ) {
+      if( tree_height( node->right->right ) < tree_height( node->right->left ) ) {
+        (void)tree_rotate_right( node->right, root );
+      }
+      node = tree_rotate_left( node, root );
+    } else {
+      tree_update_height( node );
+    }
+
+    node = node->up;
+
+  }
+
+}
+
 /*!
  \return Returns pointer to newly created tree node.
  
  Creates new node for this pairing and adds it to the binary tree
- for quick lookup.
+ for quick lookup.  The tree is rebalanced after the node is added.
 */
 tnode* tree_add(
   const char* key,       /*!< String containing search key for node retrieval */
@@ -54,12 +194,13 @@ tnode* tree_add(
   int    comp;            /* Specifies compare value for string comparison */
 
   /* Allocate memory for tree node and populate */
-  node        = (tnode*)malloc_safe( sizeof( tnode ) );
-  node->name  = strdup_safe( key );
-  node->value = strdup_safe( value );
-  node->left  = NULL;
-  node->right = NULL;
-  node->up    = NULL;
+  node         = (tnode*)malloc_safe( sizeof( tnode ) );
+  node->name   = strdup_safe( key );
+  node->value  = strdup_safe( value );
+  node->left   = NULL;
+  node->right  = NULL;
+  node->up     = NULL;
+  node->height = 1;
 
   /* Add node to tree */
   if( *root == NULL ) {
@@ -89,6 +230,7 @@ tnode* tree_add(
           curr->left = node;
           node->up   = curr;
           placed     = TRUE;
+          tree_rebalance( curr, root );
         } else {
           curr = curr->left;
         }
@@ -99,6 +241,7 @@ tnode* tree_add(
           curr->right = node;
           node->up    = curr;
           placed      = TRUE;
+          tree_rebalance( curr, root );
         } else {
           curr        = curr->right;
         }
@@ -143,8 +286,7 @@ tnode* tree_find(
 
 /*!
  Looks up the specified node (based on key value) and removes it from
- the tree in such a was as to keep the integrity of the tree in check
- for continual quick searching.
+ the tree, rebalancing the tree so that it remains quick to search.
 */
 void tree_remove(
   const char* key,  /*!< Key to search for and remove from tree */
@@ -152,7 +294,8 @@ void tree_remove(
 ) { PROFILE(TREE_REMOVE);
   
   tnode* node;  /* Pointer to found tree node to remove */
-  tnode* tail;  /* Temporary pointer to tail node */
+  tnode* succ;  /* Pointer to node that takes the place of the removed node */
+  tnode* start; /* Pointer to lowest node whose subtree changed */
   
   /* Find undefined identifer string in table */
   node = tree_find( key, *root );
@@ -160,102 +303,37 @@ void tree_remove(
   /* If node is found, restitch the define tree. */
   if( node != NULL ) {
 
-    /* If we are the root node in the tree */
-    if( node->up == NULL ) {
-
-      /* If we have no children */
-      if( (node->left == NULL) && (node->right == NULL) ) {
-
-        *root = NULL;
-
-      } else if( node->left == NULL ) {
-
-        *root = node->right;
-        if( node->right ) {
-          node->right->up = NULL;
-        }
-
-      } else if( node->right == NULL ) {
-
-        assert( node->left != NULL );
-        *root       = node->left;
-        (*root)->up = NULL;
-
-      } else {
-
-        tail = node->left;
-        while( tail->right ) {
-          tail = tail->right;
-        }
-
-        tail->right     = node->right;
-        tail->right->up = tail;
-        *root           = node->left;
-        (*root)->up     = NULL;
-
-      }
-
-    } else if( node->left == NULL ) {
+    if( (node->left == NULL) || (node->right == NULL) ) {
 
-      if( node->up->left == node ) {
-
-        node->up->left = node->right;
-
-      } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->right;
-
-      }
-
-      if( node->right ) {
-        node->right->up = node->up;
-      }
-
-    } else if( node->right == NULL ) {
-
-      assert( node->left != NULL );
-
-      if( node->up->left == node ) {
-
-        node->up->left = node->left;
-
-      } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->left;
-
-      }
-
-      node->left->up = node->up;
+      /* Replace the node with its only child (if it has one) */
+      start = node->up;
+      tree_replace( node, ((node->left != NULL) ? node->left : node->right), root );
 
     } else {
 
-      tail = node->left;
-      assert( (node->left != NULL) && (node->right != NULL) );
-
-      while( tail->right ) {
-        tail = tail->right;
+      /* Replace the node with the smallest node in its right subtree */
+      succ = node->right;
+      while( succ->left != NULL ) {
+        succ = succ->left;
       }
 
-      tail->right     = node->right;
-      tail->right->up = tail;
-
-      if( node->up->left == node ) {
-
-        node->up->left = node->left;
-
+      if( succ->up != node ) {
+        start = succ->up;
+        tree_replace( succ, succ->right, root );
+        succ->right     = node->right;
+        succ->right->up = succ;
       } else {
-
-        assert( node->up->right == node );
-        node->up->right = node->left;
-
+        start = succ;
       }
 
-      node->left->up = node->up;
+      tree_replace( node, succ, root );
+      succ->left     = node->left;
+      succ->left->up = succ;
 
     }
 
+    tree_rebalance( start, root );
+
     free_safe( node->name, (strlen( node->name ) + 1) );
     free_safe( node->value, (strlen( node->value ) + 1) );
     free_safe( node, sizeof( tnode ) );
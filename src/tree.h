@@ -20,7 +20,7 @@
  \file     tree.h
  \author   Trevor Williams  (phase1geo@gmail.com)
  \date     1/4/2003
- \brief    Contains functions for adding, finding, and removing nodes from binary tree.
+ \brief    Contains functions for adding, finding, and removing nodes from a balanced binary tree.
 */
 
 #include "defines.h"
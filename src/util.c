@@ -54,6 +54,7 @@
 #include "obfuscate.h"
 #include "profiler.h"
 #include "vpi.h"
+#include "dumppipe.h"
 
 extern bool        flag_use_command_line_debug;
 #ifndef RUNLIB
@@ -688,6 +689,76 @@ bool directory_exists(
 
 }
 
+/*!
+ \return Returns the FNV-1a hash of the given string.
+*/
+static unsigned int str_hash(
+  const char* str  /*!< String to hash */
+) {
+
+  unsigned int hash = 2166136261u;
+
+  while( *str != '\0' ) {
+    hash = (hash ^ (unsigned char)*(str++)) * 16777619u;
+  }
+
+  return( hash );
+
+}
+
+/*!
+ \return Returns TRUE if the given name was added to the given hash table; otherwise, returns FALSE
+         if the name was already in the table.
+
+ Adds the given name to the given open-addressed hash table of names (which only stores references
+ to the names), growing the table as needed.
+*/
+static bool directory_name_add(
+  char***       names,  /*!< Pointer to hash table of names */
+  unsigned int* size,   /*!< Pointer to number of buckets in the hash table */
+  unsigned int* num,    /*!< Pointer to number of names stored in the hash table */
+  char*         name    /*!< Name to add */
+) { PROFILE(DIRECTORY_NAME_ADD);
+
+  bool         added = FALSE;
+  unsigned int bucket;
+
+  /* Grow the table, if necessary */
+  if( ((*num + 1) * 2) > *size ) {
+    char**       old_names = *names;
+    unsigned int old_size  = *size;
+    unsigned int i;
+    *size  = (old_size == 0) ? 64 : (old_size << 1);
+    *names = (char**)calloc_safe( *size, sizeof( char* ) );
+    for( i=0; i<old_size; i++ ) {
+      if( old_names[i] != NULL ) {
+        bucket = str_hash( old_names[i] ) & (*size - 1);
+        while( (*names)[bucket] != NULL ) {
+          bucket = (bucket + 1) & (*size - 1);
+        }
+        (*names)[bucket] = old_names[i];
+      }
+    }
+    free_safe( old_names, (sizeof( char* ) * old_size) );
+  }
+
+  bucket = str_hash( name ) & (*size - 1);
+  while( ((*names)[bucket] != NULL) && (strcmp( (*names)[bucket], name ) != 0) ) {
+    bucket = (bucket + 1) & (*size - 1);
+  }
+
+  if( (*names)[bucket] == NULL ) {
+    (*names)[bucket] = name;
+    (*num)++;
+    added = TRUE;
+  }
+
+  PROFILE_END;
+
+  return( added );
+
+}
+
 /*!
  \bug Need to order files according to extension first instead of filename.
 
@@ -710,6 +781,10 @@ void directory_load(
   char*           ptr;         /* Pointer to current character in filename */
   unsigned int    tmpchars;    /* Number of characters needed to store full pathname for file */
   char*           tmpfile;     /* Temporary string holder for full pathname of file */
+  char**          names      = NULL;  /* Hash table of the filenames in the file list */
+  unsigned int    names_size = 0;     /* Number of buckets in the names hash table */
+  unsigned int    names_num  = 0;     /* Number of filenames stored in the names hash table */
+  str_link*       strl;        /* Pointer to current filename in the file list */
 
   if( (dir_handle = opendir( dir )) == NULL ) {
 
@@ -722,6 +797,11 @@ void directory_load(
 
     unsigned int rv;
 
+    /* Hash the names already in the file list so that duplicates can be found without searching the list */
+    for( strl=*file_head; strl!=NULL; strl=strl->next ) {
+      (void)directory_name_add( &names, &names_size, &names_num, strl->str );
+    }
+
     while( (dirp = readdir( dir_handle )) != NULL ) {
       ptr = dirp->d_name + strlen( dirp->d_name ) - 1;
       /* Work backwards until a dot is encountered */
@@ -741,7 +821,7 @@ void directory_load(
           tmpfile  = (char*)malloc_safe( tmpchars );
           rv = snprintf( tmpfile, tmpchars, "%s/%s", dir, dirp->d_name );
           assert( rv < tmpchars );
-          if( str_link_find( tmpfile, *file_head ) == NULL ) {
+          if( directory_name_add( &names, &names_size, &names_num, tmpfile ) ) {
             (void)str_link_add( tmpfile, file_head, file_tail );
             (*file_tail)->suppl = 0x1;
           } else {
@@ -754,6 +834,8 @@ void directory_load(
     rv = closedir( dir_handle );
     assert( rv == 0 );
 
+    free_safe( names, (sizeof( char* ) * names_size) );
+
   }
 
   PROFILE_END;
@@ -1083,6 +1165,30 @@ char* scope_gen_printable(
 
 } 
 
+/*!
+ \return Returns a pointer to the first printable character of the given signal/instance name and
+         stores the number of printable characters in the len parameter.
+
+ Calculates the printable portion of the given name without allocating memory.  For escaped names
+ this is the portion between the escape character and the first whitespace character; otherwise,
+ it is the entire string.
+*/
+static const char* scope_printable_span(
+            const char*   str,  /*!< Pointer to signal/instance name */
+  /*@out@*/ unsigned int* len   /*!< Pointer to number of printable characters in the name */
+) {
+
+  if( str[0] == '\\' ) {
+    str++;
+    *len = strcspn( str, " \n\t\r\b" );
+  } else {
+    *len = strlen( str );
+  }
+
+  return( str );
+
+}
+
 /*!
  \return Returns TRUE if the two strings are equal, properly handling the case where one or
          both are escaped names (start with an escape character and end with a space).
@@ -1092,24 +1198,40 @@ bool scope_compare(
   const char* str2   /*!< Pointer to signal/instance name */
 ) { PROFILE(SCOPE_COMPARE);
 
-  bool  retval;    /* Return value for this function */
-  char* new_str1;  /* New form of str1 with escaped sequences removed */
-  char* new_str2;  /* New form of str1 with escaped sequences removed */
+  unsigned int len1;  /* Number of printable characters in str1 */
+  unsigned int len2;  /* Number of printable characters in str2 */
+  const char*  pstr1 = scope_printable_span( str1, &len1 );
+  const char*  pstr2 = scope_printable_span( str2, &len2 );
+  bool         retval;
+
+  /* Perform the compare on the printable portions of the names */
+  retval = (len1 == len2) && (strncmp( pstr1, pstr2, len1 ) == 0);
+
+  PROFILE_END;
 
-  /* Create printable versions of the strings */
-  new_str1 = scope_gen_printable( str1 );
-  new_str2 = scope_gen_printable( str2 );
+  return( retval );
+
+}
+
+/*!
+ \return Returns a hash value for the given signal/instance name that is consistent with scope_compare.
+*/
+unsigned int scope_hash(
+  const char* str  /*!< Pointer to signal/instance name */
+) { PROFILE(SCOPE_HASH);
 
-  /* Perform the compare */
-  retval = (strcmp( new_str1, new_str2 ) == 0);
+  unsigned int len;
+  const char*  pstr = scope_printable_span( str, &len );
+  unsigned int hash = 2166136261u;
 
-  /* Deallocate the memory */
-  free_safe( new_str1, (strlen( new_str1 ) + 1) );
-  free_safe( new_str2, (strlen( new_str2 ) + 1) );
+  /* Calculate the FNV-1a hash of the printable portion of the name */
+  while( len-- > 0 ) {
+    hash = (hash ^ (unsigned char)*(pstr++)) * 16777619u;
+  }
 
   PROFILE_END;
 
-  return( retval );
+  return( hash );
 
 }
 
@@ -1203,10 +1325,161 @@ static void convert_file_to_module(
 
 }
 
+/*!
+ \return Returns the position of the given file in the Verilog file index if it exists in the index;
+         otherwise, returns the number of files in the index.
+*/
+static unsigned int vfile_index_find_pos(
+  const vfile_index* index,  /*!< Pointer to Verilog file index */
+  const str_link*    file    /*!< Pointer to file list element to find */
+) {
+
+  unsigned int bucket = ((unsigned int)((unsigned long)file >> 3) * 2654435761u) & (index->hash_size - 1);
+
+  while( (index->pos_hash[bucket] != 0) && (index->files[index->pos_hash[bucket] - 1] != file) ) {
+    bucket = (bucket + 1) & (index->hash_size - 1);
+  }
+
+  return( (index->pos_hash[bucket] == 0) ? index->num : (index->pos_hash[bucket] - 1) );
+
+}
+
+/*!
+ Deallocates the given Verilog file index.
+*/
+static void vfile_index_dealloc(
+  vfile_index* index  /*!< Pointer to Verilog file index to deallocate */
+) { PROFILE(VFILE_INDEX_DEALLOC);
+
+  if( index != NULL ) {
+
+    unsigned int i;
+
+    for( i=0; i<index->num; i++ ) {
+      free_safe( index->mods[i], (strlen( index->mods[i] ) + 1) );
+    }
+
+    free_safe( index->files,    (sizeof( str_link* ) * index->num) );
+    free_safe( index->next_src, (sizeof( unsigned int ) * (index->num + 1)) );
+    free_safe( index->mods,     (sizeof( char* ) * index->num) );
+    free_safe( index->next_mod, (sizeof( unsigned int ) * index->num) );
+    free_safe( index->mod_hash, (sizeof( unsigned int ) * index->hash_size) );
+    free_safe( index->pos_hash, (sizeof( unsigned int ) * index->hash_size) );
+    free_safe( index, sizeof( vfile_index ) );
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns a pointer to a newly allocated index of the given Verilog file list.
+
+ Derives the module name of each library file once and records, for every position in the list, where the
+ next non-library file is and where the next library file for the same module is.
+*/
+static vfile_index* vfile_index_create(
+  str_link* head  /*!< Pointer to head of Verilog file list to index */
+) { PROFILE(VFILE_INDEX_CREATE);
+
+  vfile_index*  index = (vfile_index*)malloc_safe( sizeof( vfile_index ) );
+  unsigned int* last_mod;  /* For each module name bucket, position plus one of the last library file added */
+  str_link*     curr;
+  unsigned int  i;
+
+  /* Count the files in the list */
+  index->num = 0;
+  for( curr=head; curr!=NULL; curr=curr->next ) {
+    index->num++;
+  }
+
+  index->hash_size = 16;
+  while( (index->num * 2) > index->hash_size ) {
+    index->hash_size <<= 1;
+  }
+
+  index->files    = (str_link**)malloc_safe_nolimit( sizeof( str_link* ) * index->num );
+  index->next_src = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * (index->num + 1) );
+  index->mods     = (char**)malloc_safe_nolimit( sizeof( char* ) * index->num );
+  index->next_mod = (unsigned int*)malloc_safe_nolimit( sizeof( unsigned int ) * index->num );
+  index->mod_hash = (unsigned int*)calloc_safe( index->hash_size, sizeof( unsigned int ) );
+  index->pos_hash = (unsigned int*)calloc_safe( index->hash_size, sizeof( unsigned int ) );
+  last_mod        = (unsigned int*)calloc_safe( index->hash_size, sizeof( unsigned int ) );
+
+  for( i=0, curr=head; curr!=NULL; i++, curr=curr->next ) {
+
+    unsigned int bucket;
+
+    index->files[i]    = curr;
+    index->next_mod[i] = 0;
+    index->mods[i]     = NULL;
+
+    /* Add the file address to the position hash */
+    bucket = ((unsigned int)((unsigned long)curr >> 3) * 2654435761u) & (index->hash_size - 1);
+    while( index->pos_hash[bucket] != 0 ) {
+      bucket = (bucket + 1) & (index->hash_size - 1);
+    }
+    index->pos_hash[bucket] = (i + 1);
+
+    /* Add library files to the module name hash, chaining files with the same module name in list order */
+    if( (curr->suppl & 0x1) == 0x1 ) {
+      char name[256];
+      convert_file_to_module( name, 256, curr->str );
+      index->mods[i] = strdup_safe( name );
+      bucket = str_hash( name ) & (index->hash_size - 1);
+      while( (index->mod_hash[bucket] != 0) && (strcmp( index->mods[index->mod_hash[bucket] - 1], name ) != 0) ) {
+        bucket = (bucket + 1) & (index->hash_size - 1);
+      }
+      if( index->mod_hash[bucket] == 0 ) {
+        index->mod_hash[bucket] = (i + 1);
+      } else {
+        index->next_mod[last_mod[bucket] - 1] = (i + 1);
+      }
+      last_mod[bucket] = (i + 1);
+    }
+
+  }
+
+  /* Calculate the position of the next non-library file for each position */
+  index->next_src[index->num] = index->num;
+  for( i=index->num; i>0; i-- ) {
+    index->next_src[i-1] = ((index->files[i-1]->suppl & 0x1) != 0x1) ? (i - 1) : index->next_src[i];
+  }
+
+  free_safe( last_mod, (sizeof( unsigned int ) * index->hash_size) );
+
+  PROFILE_END;
+
+  return( index );
+
+}
+
+/*!
+ Index of the Verilog file list searched by get_next_vfile (built the first time it is needed).
+*/
+static vfile_index* vfile_idx = NULL;
+
+/*!
+ Deallocates the index built by get_next_vfile.  This must be called whenever the Verilog file list that
+ was searched is changed or deallocated.
+*/
+void vfile_index_clear() { PROFILE(VFILE_INDEX_CLEAR);
+
+  vfile_index_dealloc( vfile_idx );
+  vfile_idx = NULL;
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns pointer to next Verilog file to parse or NULL if no files were found.
 
- Iterates through specified file list, searching for next Verilog file to parse.
+ Searches specified file list, starting at the given file, for the next Verilog file to parse.  This is
+ either the next file that is not a library file or the next library file whose name indicates that it
+ contains the given module, whichever comes first.  The list is indexed the first time that it is searched
+ so that each search is a hash table lookup.
  If a file is a library file (suppl field is 'D'), the name of the module to search
  for is compared with the name of the file.
 */
@@ -1216,19 +1489,42 @@ str_link* get_next_vfile(
 ) { PROFILE(GET_NEXT_VFILE);
 
   str_link* next = NULL;  /* Pointer to next Verilog file to parse */
-  char      name[256];    /* String holder for module name of file */
 
-  while( (curr != NULL) && (next == NULL) ) {
-    if( (curr->suppl & 0x1) != 0x1 ) {
-      next = curr;
-    } else {
-      convert_file_to_module( name, 256, curr->str );
-      if( strcmp( name, mod ) == 0 ) {
-        next = curr;
-      } else {
-        curr = curr->next;
+  if( curr != NULL ) {
+
+    unsigned int pos;
+    unsigned int found;
+    unsigned int bucket;
+
+    /* Index the list if it has not been indexed or if the given file is not in the index */
+    if( (vfile_idx == NULL) || ((pos = vfile_index_find_pos( vfile_idx, curr )) == vfile_idx->num) ) {
+      vfile_index_clear();
+      vfile_idx = vfile_index_create( curr );
+      pos       = 0;
+    }
+
+    /* Find the next non-library file */
+    found = vfile_idx->next_src[pos];
+
+    /* Find the next library file for this module, if it comes before the next non-library file */
+    bucket = str_hash( mod ) & (vfile_idx->hash_size - 1);
+    while( (vfile_idx->mod_hash[bucket] != 0) && (strcmp( vfile_idx->mods[vfile_idx->mod_hash[bucket] - 1], mod ) != 0) ) {
+      bucket = (bucket + 1) & (vfile_idx->hash_size - 1);
+    }
+    if( vfile_idx->mod_hash[bucket] != 0 ) {
+      unsigned int lib = vfile_idx->mod_hash[bucket];
+      while( (lib != 0) && ((lib - 1) < pos) ) {
+        lib = vfile_idx->next_mod[lib - 1];
       }
+      if( (lib != 0) && ((lib - 1) < found) ) {
+        found = (lib - 1);
+      }
+    }
+
+    if( found < vfile_idx->num ) {
+      next = vfile_idx->files[found];
     }
+
   }
 
   /* Specify that the returned file will be parsed */
@@ -1242,6 +1538,32 @@ str_link* get_next_vfile(
 
 }
 
+/*!
+ Adds the given number of bytes (which may be negative) to the current allocation size, updating the largest
+ allocation size.  When the dumpfile decoding thread is available, it allocates memory at the same time as the
+ main thread, so the counters are updated atomically.
+*/
+static void util_add_malloc_size(
+  int64 size  /*!< Number of bytes allocated (negative if deallocated) */
+) {
+
+#ifdef DUMPPIPE_SUPPORTED
+  int64 curr    = __sync_add_and_fetch( &curr_malloc_size, size );
+  int64 largest = largest_malloc_size;
+
+  while( (curr > largest) && !__sync_bool_compare_and_swap( &largest_malloc_size, largest, curr ) ) {
+    largest = largest_malloc_size;
+  }
+#else
+  curr_malloc_size += size;
+
+  if( curr_malloc_size > largest_malloc_size ) {
+    largest_malloc_size = curr_malloc_size;
+  }
+#endif
+
+}
+
 /*!
  \return Pointer to allocated memory.
 
@@ -1259,11 +1581,7 @@ void* malloc_safe1(
 
   assert( size <= MAX_MALLOC_SIZE );
 
-  curr_malloc_size += size;
-
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( size );
 
   obj = malloc( size );
 #ifdef TESTMODE
@@ -1296,11 +1614,7 @@ void* malloc_safe_nolimit1(
 
   void* obj;  /* Object getting malloc address */
 
-  curr_malloc_size += size;
-
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( size );
 
   obj = malloc( size );
 #ifdef TESTMODE
@@ -1350,7 +1664,7 @@ void free_safe2(
 ) {
 
   if( ptr != NULL ) {
-    curr_malloc_size -= size;
+    util_add_malloc_size( -(int64)size );
 #ifdef TESTMODE
     if( test_mode ) {
       printf( "FREE (%p) %d bytes (file: %s, line: %d) - %" FMT64 "d\n", ptr, (int)size, file, line, curr_malloc_size );
@@ -1379,10 +1693,7 @@ char* strdup_safe1(
   int   str_len = strlen( str ) + 1;
 
   assert( str_len <= MAX_MALLOC_SIZE );
-  curr_malloc_size += str_len;
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( str_len );
   new_str = strdup( str );
 #ifdef TESTMODE
   if( test_mode ) {
@@ -1415,11 +1726,7 @@ void* realloc_safe1(
 
   assert( size <= MAX_MALLOC_SIZE );
 
-  curr_malloc_size -= old_size;
-  curr_malloc_size += size;
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( (int64)size - (int64)old_size );
  
   if( size == 0 ) {
     if( ptr != NULL ) {
@@ -1457,11 +1764,7 @@ void* realloc_safe_nolimit1(
 
   void* newptr;
 
-  curr_malloc_size -= old_size;
-  curr_malloc_size += size;
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( (int64)size - (int64)old_size );
 
   if( size == 0 ) {
     if( ptr != NULL ) {
@@ -1503,11 +1806,7 @@ void* calloc_safe1(
 
   assert( total > 0 );
 
-  curr_malloc_size += total;
-
-  if( curr_malloc_size > largest_malloc_size ) {
-    largest_malloc_size = curr_malloc_size;
-  }
+  util_add_malloc_size( total );
 
   obj = calloc( num, size );
 #ifdef TESTMODE
@@ -1856,6 +2155,112 @@ bool convert_str_to_uint64(
 
 }
 
+/*!
+ \return Returns TRUE if a real number was found at the start of the given string; otherwise, returns FALSE.
+
+ Converts the string value of a real VCD value change to a double.  Decimal numbers with up to 19 significant
+ digits whose value and power of ten are both exactly representable as doubles (nearly every value that a
+ simulator writes) are converted with a single multiplication or division, which rounds exactly like strtod.
+ Any other string is handed to strtod.
+*/
+bool convert_str_to_real(
+  const char* str,   /*!< String version of value */
+  double*     value  /*!< Converted value */
+) { PROFILE(CONVERT_STR_TO_REAL);
+
+  static const double pow10[23] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+  bool        found   = FALSE;
+  bool        neg     = FALSE;
+  const char* ptr     = str;
+  uint64      mant    = 0;   /* Significant digits */
+  int         digits  = 0;   /* Number of significant digits in mant */
+  int         zeros   = 0;   /* Number of zero digits not yet added to mant */
+  int         scale   = 0;   /* Power of ten applied to mant */
+  int         exp     = 0;   /* Value of the exponent */
+  bool        exp_neg = FALSE;
+  bool        dot     = FALSE;
+  bool        fast    = TRUE;
+
+  if( (*ptr == '-') || (*ptr == '+') ) {
+    neg = (*ptr == '-');
+    ptr++;
+  }
+
+  /*
+   Integer and fractional digits.  Zero digits are only added to mant once a non-zero digit follows them, so
+   leading and trailing zeros (as in "%.16f" output) do not count as significant digits.
+  */
+  while( ((*ptr >= '0') && (*ptr <= '9')) || ((*ptr == '.') && !dot) ) {
+    if( *ptr == '.' ) {
+      dot = TRUE;
+    } else {
+      if( *ptr == '0' ) {
+        zeros++;
+      } else {
+        if( mant > 0 ) {
+          digits += zeros;
+          for( ; (zeros > 0) && (digits <= 19); zeros-- ) {
+            mant *= 10;
+          }
+        }
+        zeros  = 0;
+        mant   = (mant * 10) + (*ptr - '0');
+        digits++;
+      }
+      scale -= dot ? 1 : 0;
+      found  = TRUE;
+    }
+    ptr++;
+  }
+  scale += (mant > 0) ? zeros : 0;
+
+  /* Exponent, which is only part of the number if it has digits */
+  if( found && ((*ptr == 'e') || (*ptr == 'E')) ) {
+    const char* eptr = ptr + 1;
+    if( (*eptr == '-') || (*eptr == '+') ) {
+      exp_neg = (*eptr == '-');
+      eptr++;
+    }
+    while( (*eptr >= '0') && (*eptr <= '9') ) {
+      if( exp < 10000 ) {
+        exp = (exp * 10) + (*eptr - '0');
+      }
+      eptr++;
+      ptr = eptr;
+    }
+    scale += exp_neg ? -exp : exp;
+  }
+
+  /* Inf, NaN, hexadecimal and long numbers are handled by strtod */
+  if( !found || (digits > 19) || (mant > ((uint64)1 << 53)) || (*ptr == 'x') || (*ptr == 'X') ) {
+    fast = FALSE;
+  } else if( mant == 0 ) {
+    *value = 0.0;
+  } else if( (scale >= 0) && (scale <= 22) ) {
+    *value = (double)mant * pow10[scale];
+  } else if( (scale < 0) && (scale >= -22) ) {
+    *value = (double)mant / pow10[-scale];
+  } else {
+    fast = FALSE;
+  }
+
+  if( fast ) {
+    if( neg ) {
+      *value = -*value;
+    }
+  } else {
+    char* end;
+    *value = strtod( str, &end );
+    found  = (end != str);
+  }
+
+  PROFILE_END;
+
+  return( found );
+
+}
+
 /*!
  \return Returns an allocated string version of the integer value.
 */
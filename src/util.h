@@ -191,6 +191,11 @@ bool scope_compare(
   const char* str2
 );
 
+/*! \brief Calculates a hash value for a signal/instance name that is consistent with scope_compare. */
+unsigned int scope_hash(
+  const char* str
+);
+
 /*! \brief Returns TRUE if specified scope is local (contains no periods). */
 bool scope_local(
   const char* scope
@@ -202,6 +207,9 @@ str_link* get_next_vfile(
   const char* mod
 );
 
+/*! \brief Deallocates the Verilog file list index built by get_next_vfile. */
+void vfile_index_clear();
+
 /*! \brief Performs safe malloc call. */
 /*@only@*/ void* malloc_safe1(
   size_t       size,
@@ -344,6 +352,12 @@ bool convert_str_to_uint64(
   uint64*     value
 );
 
+/*! \brief Converts the string value of a real VCD value change to a double. */
+bool convert_str_to_real(
+  const char* str,
+  double*     value
+);
+
 /*! \brief Converts an integer value to a string, allocating memory for the string. */
 char* convert_int_to_str(
   int value
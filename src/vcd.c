@@ -181,7 +181,7 @@ static void vcd_parse_def_var(
   }
 
   /* For now we will let any type and size slide */
-  db_assign_symbol( ref, id_code, msb, lsb );
+  (void)db_assign_symbol( ref, id_code, msb, lsb );
     
   PROFILE_END;
 
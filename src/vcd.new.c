@@ -34,6 +34,8 @@
 #include "defines.h"
 #include "vcd.new.h"
 #include "db.h"
+#include "dumppipe.h"
+#include "shard.h"
 #include "util.h"
 #include "symtable.h"
 
@@ -69,6 +71,12 @@ extern int        vcd_symtab_size;
 extern symtable** timestep_tab;
 extern char**     curr_inst_scope;
 extern int        curr_inst_scope_size;
+extern uint64     score_start_time;
+extern uint64     score_end_time;
+extern unsigned int vcd_shards;
+extern bool       checkpoint_resumed;
+extern uint64     checkpoint_resume_next_time;
+extern uint64     checkpoint_resume_offset;
 
 /*!
  Pointer to start of VCD read buffer.
@@ -85,6 +93,41 @@ static char* vcd_rdbuf_end = NULL;
 */
 static char* vcd_rdbuf_cur = NULL;
 
+/*!
+ Byte offset in the VCD file of the first character of the read buffer.
+*/
+static uint64 vcd_rdbuf_pos = 0;
+
+/*!
+ Name of the VCD file being parsed.  Needed by the shard processes to open the file again.
+*/
+static const char* vcd_shard_file = NULL;
+
+/*!
+ Start times of the shard time windows after the first one, in increasing order.
+*/
+static uint64* vcd_shard_times = NULL;
+
+/*!
+ Number of elements in the vcd_shard_times array.  The dumpfile is scored in vcd_shard_num + 1 shards.
+*/
+static unsigned int vcd_shard_num = 0;
+
+/*!
+ Index of the next shard time window to start.
+*/
+static unsigned int vcd_shard_next = 0;
+
+/*!
+ First timestep of the first shard time window.
+*/
+static uint64 vcd_shard_start_time = 0;
+
+/*!
+ Last timestep of the last shard time window.
+*/
+static uint64 vcd_shard_end_time = 0;
+
 /*!
  Contains the string version of the next read token.
 */
@@ -100,6 +143,33 @@ static int vcd_yytext_size = 0;
 */
 static int vcd_yylen = 0;
 
+/*!
+ Hash values of the identifier codes that were bound to the design in the definitions section.  Used to
+ build vcd_id_filter once the definitions section has been read.
+*/
+static unsigned int* vcd_id_hashes = NULL;
+
+/*!
+ Number of hash values stored in the vcd_id_hashes array.
+*/
+static unsigned int vcd_id_hash_num = 0;
+
+/*!
+ Allocated number of elements in the vcd_id_hashes array.
+*/
+static unsigned int vcd_id_hash_size = 0;
+
+/*!
+ Bitmap of identifier code hash values that are used by the design.  A value change whose identifier code
+ hashes to a clear bit cannot match any symbol in the symbol table and is skipped without looking it up.
+*/
+static unsigned char* vcd_id_filter = NULL;
+
+/*!
+ Number of bits in the vcd_id_filter bitmap (always a power of two).
+*/
+static unsigned int vcd_id_filter_bits = 0;
+
 
 /*!
  \return Returns a 32-bit value containing the index into the symbol array based off of the
@@ -123,6 +193,91 @@ int vcd_calc_index(
 
 }
 
+/*!
+ \return Returns the hash value of the given VCD identifier code.
+*/
+static unsigned int vcd_id_hash(
+  const char* sym  /*!< VCD identifier code */
+) { PROFILE(VCD_ID_HASH);
+
+  unsigned int hash = 2166136261u;
+
+  while( *sym != '\0' ) {
+    hash = (hash ^ (unsigned char)*sym) * 16777619u;
+    sym++;
+  }
+
+  PROFILE_END;
+
+  return( hash );
+
+}
+
+/*!
+ Builds the identifier code filter bitmap from the hash values of the identifier codes that were bound to the
+ design and deallocates the hash values.  The bitmap has at least 16 bits for each identifier code so that few
+ unused identifier codes get through the filter.
+*/
+static void vcd_id_filter_build() { PROFILE(VCD_ID_FILTER_BUILD);
+
+  unsigned int i;
+
+  vcd_id_filter_bits = 1024;
+  while( vcd_id_filter_bits < (vcd_id_hash_num * 16) ) {
+    vcd_id_filter_bits <<= 1;
+  }
+
+  vcd_id_filter = (unsigned char*)malloc_safe_nolimit( vcd_id_filter_bits / 8 );
+  memset( vcd_id_filter, 0, (vcd_id_filter_bits / 8) );
+
+  for( i=0; i<vcd_id_hash_num; i++ ) {
+    unsigned int bit = vcd_id_hashes[i] & (vcd_id_filter_bits - 1);
+    vcd_id_filter[bit >> 3] |= (1 << (bit & 0x7));
+  }
+
+  free_safe( vcd_id_hashes, (sizeof( unsigned int ) * vcd_id_hash_size) );
+  vcd_id_hashes    = NULL;
+  vcd_id_hash_num  = 0;
+  vcd_id_hash_size = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ Deallocates the identifier code filter.
+*/
+static void vcd_id_filter_dealloc() { PROFILE(VCD_ID_FILTER_DEALLOC);
+
+  free_safe( vcd_id_hashes, (sizeof( unsigned int ) * vcd_id_hash_size) );
+  vcd_id_hashes    = NULL;
+  vcd_id_hash_num  = 0;
+  vcd_id_hash_size = 0;
+
+  free_safe( vcd_id_filter, (vcd_id_filter_bits / 8) );
+  vcd_id_filter      = NULL;
+  vcd_id_filter_bits = 0;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE if the given identifier code may be used by the design; otherwise, returns FALSE.
+*/
+static bool vcd_id_used(
+  const char* sym  /*!< VCD identifier code of value change */
+) { PROFILE(VCD_ID_USED);
+
+  unsigned int bit    = vcd_id_hash( sym ) & (vcd_id_filter_bits - 1);
+  bool         retval = (vcd_id_filter[bit >> 3] & (1 << (bit & 0x7))) != 0;
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
 /*!
  Reads up to the next 32 Kb from the dumpfile, adjusts the buffer pointers and returns the next character.
 */
@@ -137,6 +292,8 @@ static int vcd_getch_fetch(
 
   if( !feof( vcd ) ) {
 
+    vcd_rdbuf_pos += (vcd_rdbuf_end - vcd_rdbuf_start);
+
     rd = fread( vcd_rdbuf_start, sizeof( char ), VCD_BUFSIZE, vcd );
     vcd_rdbuf_end = (vcd_rdbuf_cur = vcd_rdbuf_start) + rd;
 
@@ -326,7 +483,17 @@ static void vcd_parse_def_var(
   }
 
   /* For now we will let any type and size slide */
-  db_assign_symbol( ref, id_code, msb, lsb );
+  if( db_assign_symbol( ref, id_code, msb, lsb ) ) {
+
+    /* Remember the identifier code for the value change filter */
+    if( vcd_id_hash_num == vcd_id_hash_size ) {
+      unsigned int new_size = (vcd_id_hash_size == 0) ? 256 : (vcd_id_hash_size * 2);
+      vcd_id_hashes    = (unsigned int*)realloc_safe_nolimit( vcd_id_hashes, (sizeof( unsigned int ) * vcd_id_hash_size), (sizeof( unsigned int ) * new_size) );
+      vcd_id_hash_size = new_size;
+    }
+    vcd_id_hashes[vcd_id_hash_num++] = vcd_id_hash( id_code );
+
+  }
 
   PROFILE_END;
 
@@ -417,6 +584,9 @@ static void vcd_parse_def(
   /* Check to see that at least one instance was found */
   db_check_dumpfile_scopes();
 
+  /* Build the filter for value changes of identifier codes that are not used by the design */
+  vcd_id_filter_build();
+
   PROFILE_END;
 
 }
@@ -436,7 +606,9 @@ static void vcd_parse_sim_vector(
 
   if( vcd_append_token( vcd, sym_start ) == T_EOF ) { Throw 0; }
 
-  db_set_symbol_string( (vcd_yytext + sym_start), (vcd_yytext + 1) );
+  if( vcd_id_used( vcd_yytext + sym_start ) ) {
+    db_set_symbol_string( (vcd_yytext + sym_start), (vcd_yytext + 1) );
+  }
 
   PROFILE_END;
 
@@ -446,38 +618,197 @@ static void vcd_parse_sim_vector(
  \throws anonymous Throw
 
  Reads the next token from the file and calls the appropriate database storage
- function for this signal change.
+ function for this signal change.  The value is converted to a double here so that
+ it is passed on in binary form.
 */
 static void vcd_parse_sim_real(
   FILE* vcd  /*!< File handle of opened VCD file */
 ) { PROFILE(VCD_PARSE_SIM_REAL);
 
-  int tok;
-  int sym_start;
+  int    tok;
+  int    sym_start;
+  double real;
 
   if( vcd_append_token( vcd, sym_start ) == T_EOF ) { Throw 0; }
 
-  db_set_symbol_string( (vcd_yytext + sym_start), (vcd_yytext + 1) );
+  if( vcd_id_used( vcd_yytext + sym_start ) ) {
+    if( convert_str_to_real( (vcd_yytext + 1), &real ) ) {
+      db_set_symbol_real( (vcd_yytext + sym_start), real );
+    } else {
+      db_set_symbol_string( (vcd_yytext + sym_start), (vcd_yytext + 1) );
+    }
+  }
 
   PROFILE_END;
 
 }
 
 /*!
- \throws anonymous db_do_timestep db_do_timestep vcd_parse_sim_vector Throw vcd_parse_sim_ignore
+ \return Returns TRUE if a timestep marker was found; otherwise, returns FALSE.
 
- Parses all lines that occur in the simulation portion of the VCD file.
+ Reads the VCD file from its current position up to the next timestep marker at the start of a line,
+ storing its time in the given value.
 */
-static void vcd_parse_sim(
+static bool vcd_shard_find_time(
+  FILE*   vcd,  /*!< File handle of opened VCD file */
+  uint64* time  /*!< Pointer to storage of the found time */
+) { PROFILE(VCD_SHARD_FIND_TIME);
+
+  bool found = FALSE;
+  int  prev  = 0;
+  int  ch;
+
+  /* The position is somewhere within a line so a marker at the position itself is not accepted */
+  while( !found && ((ch = getc( vcd )) != EOF) ) {
+    if( (ch == '#') && (prev == '\n') ) {
+      uint64 value  = 0;
+      bool   digits = FALSE;
+      while( ((ch = getc( vcd )) >= '0') && (ch <= '9') ) {
+        value  = (value * 10) + (ch - '0');
+        digits = TRUE;
+      }
+      if( digits ) {
+        *time = value;
+        found = TRUE;
+      }
+    }
+    prev = ch;
+  }
+
+  PROFILE_END;
+
+  return( found );
+
+}
+
+/*!
+ \throws anonymous Throw
+
+ Splits the simulation section of the VCD file, which starts at the current read position, into the number of
+ time windows given by the -vcd-shards option.  The windows are split at the first timestep marker after evenly
+ spaced file offsets, so each shard has about the same number of value changes to simulate.  Split points that
+ are outside of the scored time window or that do not advance the time are dropped.  The read position is
+ restored afterwards.
+*/
+static void vcd_shard_index(
   FILE* vcd  /*!< File handle of opened VCD file */
+) { PROFILE(VCD_SHARD_INDEX);
+
+  uint64       start_pos = vcd_rdbuf_pos + (vcd_rdbuf_cur - vcd_rdbuf_start);
+  uint64       size;
+  unsigned int i;
+
+  vcd_shard_num  = 0;
+  vcd_shard_next = 0;
+
+  if( (fseeko( vcd, 0, SEEK_END ) != 0) || ((size = (uint64)ftello( vcd )) < start_pos) ) {
+    print_output( "Unable to split the specified VCD file into shards", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  for( i=1; i<vcd_shards; i++ ) {
+    uint64 time;
+    if( (fseeko( vcd, (off_t)(start_pos + (((size - start_pos) / vcd_shards) * i)), SEEK_SET ) == 0) &&
+        vcd_shard_find_time( vcd, &time ) &&
+        (time > score_start_time) && (time <= score_end_time) &&
+        ((vcd_shard_num == 0) || (time > vcd_shard_times[vcd_shard_num - 1])) ) {
+      vcd_shard_times = (uint64*)realloc_safe( vcd_shard_times, (sizeof( uint64 ) * vcd_shard_num), (sizeof( uint64 ) * (vcd_shard_num + 1)) );
+      vcd_shard_times[vcd_shard_num++] = time;
+    }
+  }
+
+  if( fseeko( vcd, (off_t)start_pos, SEEK_SET ) != 0 ) {
+    print_output( "Unable to split the specified VCD file into shards", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  vcd_rdbuf_end = vcd_rdbuf_cur = vcd_rdbuf_start;
+  vcd_rdbuf_pos = start_pos;
+
+  PROFILE_END;
+
+}
+
+/*!
+ \return Returns TRUE in the new shard process; otherwise, returns FALSE.
+
+ \throws anonymous shard_fork Throw
+
+ Starts the process that scores the next shard time window from the current read position.  The shard process
+ opens the VCD file again at the current read position, since the file offset of the inherited file handle is
+ shared with this process, and only scores its own time window.
+*/
+static bool vcd_shard_start(
+  FILE** vcd,     /*!< Pointer to file handle of opened VCD file */
+  bool   overlap  /*!< Set to TRUE if the shard will simulate the last timestep of the previous shard again */
+) { PROFILE(VCD_SHARD_START);
+
+  unsigned int index      = vcd_shard_next++;
+  uint64       start_time = (index == 0) ? vcd_shard_start_time : vcd_shard_times[index - 1];
+  uint64       end_time   = (index == vcd_shard_num) ? vcd_shard_end_time : (vcd_shard_times[index] - 1);
+  bool         child;
+
+  if( (child = shard_fork( start_time, end_time, overlap )) ) {
+
+    uint64 pos = vcd_rdbuf_pos + (vcd_rdbuf_cur - vcd_rdbuf_start);
+    FILE*  handle;
+
+    if( ((handle = fopen( vcd_shard_file, "r" )) == NULL) || (fseeko( handle, (off_t)pos, SEEK_SET ) != 0) ) {
+      if( handle != NULL ) {
+        (void)fclose( handle );
+      }
+      print_output( "Unable to open specified VCD file", FATAL, __FILE__, __LINE__ );
+      Throw 0;
+    }
+
+    /* The inherited handle is not closed so that its shared file offset is left alone */
+    *vcd          = handle;
+    vcd_rdbuf_end = vcd_rdbuf_cur = vcd_rdbuf_start;
+    vcd_rdbuf_pos = pos;
+
+    /* A shard process does not start any other shards */
+    free_safe( vcd_shard_times, (sizeof( uint64 ) * vcd_shard_num) );
+    vcd_shard_times = NULL;
+    vcd_shard_num   = 0;
+
+  }
+
+  PROFILE_END;
+
+  return( child );
+
+}
+
+/*!
+ \throws anonymous db_do_timestep db_do_timestep vcd_parse_sim_vector Throw vcd_parse_sim_ignore vcd_shard_start vcd_shard_start
+
+ Parses all lines that occur in the simulation portion of the VCD file.  When the dumpfile is scored in shards,
+ this process only reads the value changes up to the start of the last shard, starting each shard process on
+ the way, and the shard processes continue the parse from there.
+*/
+static void vcd_parse_sim(
+  void* arg  /*!< Pointer to file handle of opened VCD file */
 ) { PROFILE(VCD_PARSE_SIM);
 
+  FILE** handle            = (FILE**)arg;  /* Pointer to file handle of opened VCD file */
+  FILE*  vcd               = *handle;      /* File handle of opened VCD file */
   uint64 last_timestep     = 0;      /* Value of last timestamp from file */
   bool   use_last_timestep = FALSE;  /* Specifies if timestep has been encountered */
   bool   simulate          = TRUE;   /* Specifies if we should continue to simulate */
  
   int tok;
 
+  /* When resuming from a checkpoint, the file position is just after the timestep that follows the checkpoint */
+  if( checkpoint_resumed ) {
+    last_timestep     = checkpoint_resume_next_time;
+    use_last_timestep = TRUE;
+  }
+
+  /* The first shard starts at the beginning of the simulation section */
+  if( (vcd_shard_num > 0) && vcd_shard_start( handle, FALSE ) ) {
+    vcd = *handle;
+  }
+
   for(;;) {
 
     /* We ignore all other tokens besides value changes */
@@ -493,11 +824,26 @@ static void vcd_parse_sim(
           vcd_parse_sim_real( vcd );
           break;
         case '#' :
-          if( use_last_timestep ) {
-            simulate = db_do_timestep( last_timestep, FALSE );
+          {
+            uint64 next_timestep = ato64( vcd_yytext + 1 );
+            /* Start the next shard once its time window is reached, stopping after the last one */
+            if( (vcd_shard_num > 0) && (next_timestep >= vcd_shard_times[vcd_shard_next - 1]) ) {
+              bool last = (vcd_shard_next == vcd_shard_num);
+              if( vcd_shard_start( handle, use_last_timestep ) ) {
+                vcd = *handle;
+              } else if( last ) {
+                simulate = FALSE;
+                break;
+              }
+            }
+            if( use_last_timestep ) {
+              simulate = db_do_dump_timestep( last_timestep, next_timestep, (vcd_rdbuf_pos + (vcd_rdbuf_cur - vcd_rdbuf_start)) );
+            } else if( next_timestep > score_end_time ) {
+              simulate = FALSE;
+            }
+            last_timestep = next_timestep;
+            use_last_timestep = TRUE;
           }
-          last_timestep = ato64( vcd_yytext + 1 );
-          use_last_timestep = TRUE;
           break;
         case '0' :
         case '1' :
@@ -505,7 +851,9 @@ static void vcd_parse_sim(
         case 'X' :
         case 'z' :
         case 'Z' :
-          db_set_symbol_char( (vcd_yytext + 1), vcd_yytext[0] );
+          if( vcd_id_used( vcd_yytext + 1 ) ) {
+            db_set_symbol_char( (vcd_yytext + 1), vcd_yytext[0] );
+          }
           break;
         default  :
           {
@@ -522,11 +870,16 @@ static void vcd_parse_sim(
 
     }
 
+    /* Stop reading once simulation has finished or the end of the scored time window has been passed */
+    if( !simulate ) {
+      break;
+    }
+
   }
 
-  /* Simulate the last timestep now */
-  if( use_last_timestep && simulate ) {
-    (void)db_do_timestep( last_timestep, FALSE );
+  /* Simulate the last timestep now (unless this process only started the shards) */
+  if( use_last_timestep && simulate && (vcd_shard_num == 0) ) {
+    (void)db_do_dump_timestep( last_timestep, 0xffffffffffffffffLL, 0 );
   }
 
   PROFILE_END;
@@ -534,7 +887,7 @@ static void vcd_parse_sim(
 }
 
 /*!
- \throws anonymous Throw Throw vcd_parse_def vcd_parse_sim
+ \throws anonymous Throw Throw vcd_parse_def dumppipe_run
 
  Reads specified VCD file for relevant information and calls the database
  functions when appropriate to store this information.  This replaces the
@@ -557,34 +910,83 @@ void vcd_parse(
 
       /* Allocate memory for read buffer */
       vcd_rdbuf_start = vcd_rdbuf_end = vcd_rdbuf_cur = (char*)malloc_safe( VCD_BUFSIZE );
+      vcd_rdbuf_pos   = 0;
 
       /* Allocate memory for vcd_yytext */
       vcd_yytext = (char*)malloc_safe( (vcd_yytext_size = 1024) );
 
       vcd_parse_def( vcd_handle );
 
+      /* Skip the value changes that were simulated before the checkpoint we are resuming from */
+      if( checkpoint_resumed ) {
+        if( fseeko( vcd_handle, (off_t)checkpoint_resume_offset, SEEK_SET ) != 0 ) {
+          print_output( "Unable to find the checkpoint position in the specified VCD file", FATAL, __FILE__, __LINE__ );
+          Throw 0;
+        }
+        vcd_rdbuf_end = vcd_rdbuf_cur = vcd_rdbuf_start;
+        vcd_rdbuf_pos = checkpoint_resume_offset;
+      }
+
+      /* Split the simulation portion of the file into shards to be scored by separate processes */
+      vcd_shard_num = 0;
+      if( vcd_shards > 1 ) {
+        vcd_shard_file = vcd_file;
+        vcd_shard_index( vcd_handle );
+      }
+
       /* Create timestep symbol table array */
       if( vcd_symtab_size > 0 ) {
         timestep_tab = malloc_safe_nolimit( sizeof( symtable*) * vcd_symtab_size );
       }
     
-      vcd_parse_sim( vcd_handle );
+      if( vcd_shard_num > 0 ) {
+
+        rv = snprintf( user_msg, USER_MSG_LENGTH, "Scoring the VCD dumpfile in %u shards...", (vcd_shard_num + 1) );
+        assert( rv < USER_MSG_LENGTH );
+        print_output( user_msg, NORMAL, __FILE__, __LINE__ );
+
+        /* This process only reads the value changes, without simulating them, to start each shard */
+        vcd_shard_start_time = score_start_time;
+        vcd_shard_end_time   = score_end_time;
+        score_start_time     = 0xffffffffffffffffLL;
+        score_end_time       = 0xffffffffffffffffLL;
+
+        vcd_parse_sim( &vcd_handle );
+
+        /* Restore the scored time window, unless this is a shard process */
+        if( vcd_shard_num > 0 ) {
+          score_start_time = vcd_shard_start_time;
+          score_end_time   = vcd_shard_end_time;
+        }
+
+      } else {
+
+        /* Parse the simulation portion of the file, simulating each timestep as it is read */
+        dumppipe_run( vcd_parse_sim, &vcd_handle );
+
+      }
 
     } Catch_anonymous {
+      free_safe( vcd_shard_times, (sizeof( uint64 ) * vcd_shard_num) );
+      vcd_shard_times = NULL;
       symtable_dealloc( vcd_symtab );
       free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
       free_safe( vcd_rdbuf_start, VCD_BUFSIZE );
       free_safe( vcd_yytext, vcd_yytext_size );
+      vcd_id_filter_dealloc();
       rv = fclose( vcd_handle );
       assert( rv == 0 );
       Throw 0;
     }
 
     /* Deallocate memory */
+    free_safe( vcd_shard_times, (sizeof( uint64 ) * vcd_shard_num) );
+    vcd_shard_times = NULL;
     symtable_dealloc( vcd_symtab );
     free_safe( timestep_tab, (sizeof( symtable*) * vcd_symtab_size) );
     free_safe( vcd_rdbuf_start, VCD_BUFSIZE );
     free_safe( vcd_yytext, vcd_yytext_size );
+    vcd_id_filter_dealloc();
 
     /* Close VCD file */
     rv = fclose( vcd_handle );
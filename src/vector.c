@@ -38,6 +38,7 @@
 #include <mpatrol.h>
 #endif
 
+#include "checkpoint.h"
 #include "defines.h"
 #include "vector.h"
 #include "util.h"
@@ -58,10 +59,65 @@
 /*! Contains the structure sizes for the various vector types (vector "type" supplemental field is the index to this array */
 static const unsigned int vector_type_sizes[4] = {VTYPE_INDEX_VAL_NUM, VTYPE_INDEX_SIG_NUM, VTYPE_INDEX_EXP_NUM, VTYPE_INDEX_MEM_NUM};
 
+/*!
+ Row of zero values that every word of a newly created memory vector refers to.  A word only receives its own
+ storage when it is first modified (see \ref vector_get_writable_row), so large sparsely accessed memories
+ do not need storage for the words that are never written or read.  This row must never be modified.
+*/
+static ulong vector_mem_zero_row[VTYPE_INDEX_MEM_NUM];
+
+/*!
+ Decoded value of each VCD value character, indexed by the character.  The low byte holds the VALL bit and the
+ high byte holds the VALH bit, so the values of eight characters that are shifted into place and OR'ed together
+ hold the packed VALL and VALH bits of all eight.  Any character other than '1', 'x' or 'z' is decoded as a 0.
+*/
+static const unsigned short vector_vcd_bits[256] = {
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x100, 0x000, 0x101, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000
+};
+
 extern char   user_msg[USER_MSG_LENGTH];
 extern isuppl info_suppl;
 
 
+/*!
+ \return Returns a pointer to the value row of the given word of the specified vector that may be modified.
+
+ If the word still refers to the shared zero row of a memory vector, storage for the word is allocated and
+ placed in the vector's value array (which is also seen by any expression sharing the array) first.
+*/
+ulong* vector_get_writable_row(
+  vector*      vec,   /*!< Pointer to vector containing the word to modify */
+  unsigned int index  /*!< Index of the word to retrieve */
+) { PROFILE(VECTOR_GET_WRITABLE_ROW);
+
+  ulong* row = vec->value.ul[index];
+
+  if( row == vector_mem_zero_row ) {
+    row = (ulong*)calloc_safe( VTYPE_INDEX_MEM_NUM, sizeof( ulong ) );
+    vec->value.ul[index] = row;
+  }
+
+  PROFILE_END;
+
+  return( row );
+
+}
+
 /*!
  Initializes the specified vector with the contents of width
  and value (if value != NULL).  If value != NULL, initializes all contents 
@@ -79,6 +135,7 @@ void vector_init_ulong(
 
   vec->width                = width;
   vec->suppl.all            = 0;
+  vec->two_state            = 0;
   vec->suppl.part.type      = type;
   vec->suppl.part.data_type = VDATA_UL;
   vec->suppl.part.owns_data = owns_value & (width > 0);
@@ -93,18 +150,27 @@ void vector_init_ulong(
 
     assert( width > 0 );
 
-    for( i=0; i<(size - 1); i++ ) {
-      vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l;
-      vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h;
+    /* Memory vector words that refer to the shared zero row are already initialized */
+    if( value[0] == vector_mem_zero_row ) {
+
+      assert( (data_l == 0) && (data_h == 0) );
+
+    } else {
+
+      for( i=0; i<(size - 1); i++ ) {
+        vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l;
+        vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h;
+        for( j=2; j<num; j++ ) {
+          vec->value.ul[i][j] = 0x0;
+        }
+      }
+
+      vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l & lmask;
+      vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h & lmask;
       for( j=2; j<num; j++ ) {
         vec->value.ul[i][j] = 0x0;
       }
-    }
 
-    vec->value.ul[i][VTYPE_INDEX_VAL_VALL] = data_l & lmask;
-    vec->value.ul[i][VTYPE_INDEX_VAL_VALH] = data_h & lmask;
-    for( j=2; j<num; j++ ) {
-      vec->value.ul[i][j] = 0x0;
     }
 
   } else {
@@ -132,6 +198,7 @@ void vector_init_r64(
 
   vec->width                = 64;
   vec->suppl.all            = 0;
+  vec->two_state            = 0;
   vec->suppl.part.type      = type;
   vec->suppl.part.data_type = VDATA_R64;
   vec->suppl.part.owns_data = owns_value;
@@ -167,6 +234,7 @@ void vector_init_r32(
 
   vec->width                = 32;
   vec->suppl.all            = 0;
+  vec->two_state            = 0;
   vec->suppl.part.type      = type;
   vec->suppl.part.data_type = VDATA_R32;
   vec->suppl.part.owns_data = owns_value;
@@ -212,8 +280,14 @@ vector* vector_create(
           unsigned int size = UL_SIZE(width);
           unsigned int i;
           value = (ulong**)malloc_safe( sizeof( ulong* ) * size );
-          for( i=0; i<size; i++ ) {
-            value[i] = (ulong*)malloc_safe( sizeof( ulong ) * num );
+          if( type == VTYPE_MEM ) {
+            for( i=0; i<size; i++ ) {
+              value[i] = vector_mem_zero_row;
+            }
+          } else {
+            for( i=0; i<size; i++ ) {
+              value[i] = (ulong*)malloc_safe( sizeof( ulong ) * num );
+            }
           }
         }
         vector_init_ulong( new_vec, value, 0x0, 0x0, (value != NULL), width, type );
@@ -267,8 +341,11 @@ void vector_copy(
         unsigned int size      = UL_SIZE( from_vec->width );
         unsigned int type_size = (from_vec->suppl.part.type != to_vec->suppl.part.type) ? 2 : vector_type_sizes[to_vec->suppl.part.type];
         for( i=0; i<size; i++ ) {
-          for( j=0; j<type_size; j++ ) {
-            to_vec->value.ul[i][j] = from_vec->value.ul[i][j];
+          if( (from_vec->value.ul[i] != vector_mem_zero_row) || (to_vec->value.ul[i] != vector_mem_zero_row) ) {
+            ulong* entry = vector_get_writable_row( to_vec, i );
+            for( j=0; j<type_size; j++ ) {
+              entry[j] = from_vec->value.ul[i][j];
+            }
           }
         }
       }
@@ -315,11 +392,12 @@ void vector_copy_range(
           unsigned int my_index     = UL_DIV(i);
           unsigned int their_index  = UL_DIV(i + lsb);
           unsigned int their_offset = UL_MOD(i + lsb);
+          ulong*       entry        = vector_get_writable_row( to_vec, my_index );
           for( j=0; j<vector_type_sizes[to_vec->suppl.part.type]; j++ ) {
             if( UL_MOD(i) == 0 ) {
-              to_vec->value.ul[my_index][j] = 0;
+              entry[j] = 0;
             }
-            to_vec->value.ul[my_index][j] |= (((from_vec->value.ul[their_index][j] >> their_offset) & 0x1) << i);
+            entry[j] |= (((from_vec->value.ul[their_index][j] >> their_offset) & 0x1) << i);
           }
         }
       }
@@ -503,8 +581,12 @@ void vector_db_read(
 #else
 #error "Unsupported long size"
 #endif
-                    if( sscanf( *line, "%lx%n", &((*vec)->value.ul[i][j]), &chars_read ) == 1 ) {
+                    ulong val;
+                    if( sscanf( *line, "%lx%n", &val, &chars_read ) == 1 ) {
                       *line += chars_read;
+                      if( val != 0 ) {
+                        vector_get_writable_row( *vec, i )[j] = val;
+                      }
                     } else {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
                       Throw 0;
@@ -516,10 +598,12 @@ void vector_db_read(
                     uint32 val;
                     if( sscanf( *line, "%x%n", &val, &chars_read ) == 1 ) {
                       *line += chars_read;
-                      if( i == 0 ) {
-                        (*vec)->value.ul[i/2][j] = (ulong)val;
-                      } else {
-                        (*vec)->value.ul[i/2][j] |= ((ulong)val << 32);
+                      if( val != 0 ) {
+                        if( i == 0 ) {
+                          vector_get_writable_row( *vec, (i/2) )[j] = (ulong)val;
+                        } else {
+                          vector_get_writable_row( *vec, (i/2) )[j] |= ((ulong)val << 32);
+                        }
                       }
                     } else {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
@@ -534,8 +618,12 @@ void vector_db_read(
                     if( sscanf( *line, "%llx%n", &val, &chars_read ) == 1 ) {
                     /*@=duplicatequals =ignorequals@*/
                       *line += chars_read;
-                      (*vec)->value.ul[(i*2)+0][j] = (ulong)(val & 0xffffffffLL);
-                      (*vec)->value.ul[(i*2)+1][j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      if( (val & 0xffffffffLL) != 0 ) {
+                        vector_get_writable_row( *vec, ((i*2)+0) )[j] = (ulong)(val & 0xffffffffLL);
+                      }
+                      if( ((val >> 32) & 0xffffffffLL) != 0 ) {
+                        vector_get_writable_row( *vec, ((i*2)+1) )[j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      }
                     } else {
                       print_output( "Unable to parse vector information in database file.  Unable to read.", FATAL, __FILE__, __LINE__ );
                       Throw 0;
@@ -708,8 +796,8 @@ void vector_db_merge(
                   ulong val;
                   if( sscanf( *line, "%lx%n", &val, &chars_read ) == 1 ) {
                     *line += chars_read;
-                    if( j >= 2 ) {
-                      base->value.ul[i][j] |= val;
+                    if( (j >= 2) && (val != 0) ) {
+                      vector_get_writable_row( base, i )[j] |= val;
                     }
                   } else {
                     print_output( "Unable to parse vector information in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
@@ -723,10 +811,14 @@ void vector_db_merge(
                   if( sscanf( *line, "%x%n", &val, &chars_read ) == 1 ) {
                     *line += chars_read;
                     if( j >= 2 ) {
-                      if( i == 0 ) {
-                        base->value.ul[i/2][j] = (ulong)val;
-                      } else {
-                        base->value.ul[i/2][j] |= ((ulong)val << 32);
+                      if( val != 0 ) {
+                        if( i == 0 ) {
+                          vector_get_writable_row( base, (i/2) )[j] = (ulong)val;
+                        } else {
+                          vector_get_writable_row( base, (i/2) )[j] |= ((ulong)val << 32);
+                        }
+                      } else if( (i == 0) && (base->value.ul[i/2] != vector_mem_zero_row) ) {
+                        base->value.ul[i/2][j] = 0;
                       }
                     }
                   } else {
@@ -743,8 +835,17 @@ void vector_db_merge(
                   /*@=duplicatequals =ignorequals@*/
                     *line += chars_read;
                     if( j >= 2 ) {
-                      base->value.ul[(i*2)+0][j] = (ulong)(val & 0xffffffffLL);
-                      base->value.ul[(i*2)+1][j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      /* Words that are still the shared zero row already hold a zero */
+                      if( (val & 0xffffffffLL) != 0 ) {
+                        vector_get_writable_row( base, ((i*2)+0) )[j] = (ulong)(val & 0xffffffffLL);
+                      } else if( base->value.ul[(i*2)+0] != vector_mem_zero_row ) {
+                        base->value.ul[(i*2)+0][j] = 0;
+                      }
+                      if( ((val >> 32) & 0xffffffffLL) != 0 ) {
+                        vector_get_writable_row( base, ((i*2)+1) )[j] = (ulong)((val >> 32) & 0xffffffffLL);
+                      } else if( base->value.ul[(i*2)+1] != vector_mem_zero_row ) {
+                        base->value.ul[(i*2)+1][j] = 0;
+                      }
                     }
                   } else {
                     print_output( "Unable to parse vector information in database file.  Unable to merge.", FATAL, __FILE__, __LINE__ );
@@ -819,8 +920,11 @@ void vector_merge(
     switch( base->suppl.part.data_type ) {
       case VDATA_UL :
         for( i=0; i<UL_SIZE(base->width); i++ ) {
-          for( j=2; j<vector_type_sizes[base->suppl.part.type]; j++ ) {
-            base->value.ul[i][j] |= other->value.ul[i][j];
+          if( other->value.ul[i] != vector_mem_zero_row ) {
+            ulong* entry = vector_get_writable_row( base, i );
+            for( j=2; j<vector_type_sizes[base->suppl.part.type]; j++ ) {
+              entry[j] |= other->value.ul[i][j];
+            }
           }
         }
         break;
@@ -837,6 +941,120 @@ void vector_merge(
 
 }
 
+#ifndef RUNLIB
+#ifndef VPI_ONLY
+/*!
+ \throws anonymous checkpoint_write_data
+
+ Writes the value and all coverage planes of the given vector to a simulation checkpoint file.  Unlike the
+ CDD writer, no planes are masked off so that the vector can be restored exactly as it is.  Memory words that
+ still refer to the shared zero row are only marked as such.
+*/
+void vector_checkpoint_write(
+  const vector* vec,  /*!< Pointer to vector to write */
+  FILE*         file  /*!< Pointer to checkpoint file to write to */
+) { PROFILE(VECTOR_CHECKPOINT_WRITE);
+
+  checkpoint_write_data( file, &(vec->width), sizeof( vec->width ) );
+  checkpoint_write_data( file, &(vec->suppl.all), sizeof( vec->suppl.all ) );
+
+  /* Only write our data if we own it */
+  if( vec->suppl.part.owns_data == 1 ) {
+
+    switch( vec->suppl.part.data_type ) {
+      case VDATA_UL :
+        if( vec->value.ul != NULL ) {
+          unsigned int i;
+          unsigned int num = vector_type_sizes[vec->suppl.part.type];
+          for( i=0; i<UL_SIZE(vec->width); i++ ) {
+            char owned = (vec->value.ul[i] != vector_mem_zero_row) ? 1 : 0;
+            checkpoint_write_data( file, &owned, 1 );
+            if( owned ) {
+              checkpoint_write_data( file, vec->value.ul[i], (sizeof( ulong ) * num) );
+            }
+          }
+        }
+        break;
+      case VDATA_R64 :
+        checkpoint_write_data( file, &(vec->value.r64->val), sizeof( real64 ) );
+        break;
+      case VDATA_R32 :
+        checkpoint_write_data( file, &(vec->value.r32->val), sizeof( real32 ) );
+        break;
+      default :  assert( 0 );  break;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ \throws anonymous checkpoint_read_data checkpoint_read_data checkpoint_read_data Throw
+
+ Restores the value and all coverage planes of the given vector from a simulation checkpoint file.  The stored
+ vector must have the same size and type as the given vector.
+*/
+void vector_checkpoint_read(
+  vector* vec,  /*!< Pointer to vector to restore */
+  FILE*   file  /*!< Pointer to checkpoint file to read from */
+) { PROFILE(VECTOR_CHECKPOINT_READ);
+
+  unsigned int width;
+  vsuppl       suppl;
+
+  checkpoint_read_data( file, &width, sizeof( width ) );
+  checkpoint_read_data( file, &(suppl.all), sizeof( suppl.all ) );
+
+  if( (width != vec->width) ||
+      (suppl.part.type      != vec->suppl.part.type) ||
+      (suppl.part.data_type != vec->suppl.part.data_type) ||
+      (suppl.part.owns_data != vec->suppl.part.owns_data) ) {
+    print_output( "Checkpoint file does not match the design being scored", FATAL, __FILE__, __LINE__ );
+    Throw 0;
+  }
+
+  vec->suppl.all = suppl.all;
+
+  /* Only read our data if we own it */
+  if( vec->suppl.part.owns_data == 1 ) {
+
+    switch( vec->suppl.part.data_type ) {
+      case VDATA_UL :
+        if( vec->value.ul != NULL ) {
+          unsigned int i, j;
+          unsigned int num = vector_type_sizes[vec->suppl.part.type];
+          for( i=0; i<UL_SIZE(vec->width); i++ ) {
+            char owned;
+            checkpoint_read_data( file, &owned, 1 );
+            if( owned ) {
+              checkpoint_read_data( file, vector_get_writable_row( vec, i ), (sizeof( ulong ) * num) );
+            } else if( vec->value.ul[i] != vector_mem_zero_row ) {
+              for( j=0; j<num; j++ ) {
+                vec->value.ul[i][j] = 0;
+              }
+            }
+          }
+        }
+        break;
+      case VDATA_R64 :
+        checkpoint_read_data( file, &(vec->value.r64->val), sizeof( real64 ) );
+        break;
+      case VDATA_R32 :
+        checkpoint_read_data( file, &(vec->value.r32->val), sizeof( real32 ) );
+        break;
+      default :  assert( 0 );  break;
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+#endif
+#endif
+
 /*!
  \return Returns eval_a coverage information for specified vector and bit position.
 */
@@ -1426,9 +1644,12 @@ void vector_toggle_count(
     switch( vec->suppl.part.data_type ) {
       case VDATA_UL :
         for( i=0; i<UL_SIZE(vec->width); i++ ) {
-          for( j=0; j<UL_BITS; j++ ) {
-            *tog01_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG01] >> j) & 0x1);
-            *tog10_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG10] >> j) & 0x1);
+          /* Memory words that were never accessed have not toggled */
+          if( vec->value.ul[i] != vector_mem_zero_row ) {
+            for( j=0; j<UL_BITS; j++ ) {
+              *tog01_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG01] >> j) & 0x1);
+              *tog10_cnt += ((vec->value.ul[i][VTYPE_INDEX_SIG_TOG10] >> j) & 0x1);
+            }
           }
         }
         break;
@@ -1466,12 +1687,15 @@ void vector_mem_rw_count(
           lmask &= hmask;
         }
         for( i=UL_DIV(lsb); i<=UL_DIV(msb); i++ ) {
-          ulong mask = (i == UL_DIV(lsb)) ? lmask : ((i == UL_DIV(msb)) ? hmask : UL_SET);
-          ulong wr   = vec->value.ul[i][VTYPE_INDEX_MEM_WR] & mask;
-          ulong rd   = vec->value.ul[i][VTYPE_INDEX_MEM_RD] & mask;
-          for( j=0; j<UL_BITS; j++ ) {
-            *wr_cnt += (wr >> j) & 0x1;
-            *rd_cnt += (rd >> j) & 0x1;
+          /* Memory words that were never accessed have not been written or read */
+          if( vec->value.ul[i] != vector_mem_zero_row ) {
+            ulong mask = (i == UL_DIV(lsb)) ? lmask : ((i == UL_DIV(msb)) ? hmask : UL_SET);
+            ulong wr   = vec->value.ul[i][VTYPE_INDEX_MEM_WR] & mask;
+            ulong rd   = vec->value.ul[i][VTYPE_INDEX_MEM_RD] & mask;
+            for( j=0; j<UL_BITS; j++ ) {
+              *wr_cnt += (wr >> j) & 0x1;
+              *rd_cnt += (rd >> j) & 0x1;
+            }
           }
         }
       }
@@ -1579,32 +1803,56 @@ bool vector_set_coverage_and_assign_ulong(
       break;
     case VTYPE_SIG :
       prev_set = vec->suppl.part.set;
-      for( i=lindex; i<=hindex; i++ ) {
-        ulong* entry = vec->value.ul[i];
-        ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
-        ulong  fvall = scratchl[i] & mask;
-        ulong  fvalh = scratchh[i] & mask;
-        ulong  tvall = entry[VTYPE_INDEX_SIG_VALL];
-        ulong  tvalh = entry[VTYPE_INDEX_SIG_VALH];
-        if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
-          ulong tvalx = tvalh & ~tvall & entry[VTYPE_INDEX_SIG_MISC];
-          ulong xval  = entry[VTYPE_INDEX_SIG_XHOLD];
-          ulong xmask = mask & ~tvalh;
-          if( prev_set == 1 ) {
-            entry[VTYPE_INDEX_SIG_TOG01] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & mask;
-            entry[VTYPE_INDEX_SIG_TOG10] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & mask;
+      if( vec->two_state == 1 ) {
+        /*
+         2-state signals are assigned X/Z values as 0, so once a bit is assigned it never holds an X/Z value again and
+         no X-transition tracking is needed.  The bits still start out as X, so the first assignment clears VALH.
+        */
+        for( i=lindex; i<=hindex; i++ ) {
+          ulong* entry = vec->value.ul[i];
+          ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
+          ulong  fvall = scratchl[i] & ~scratchh[i] & mask;
+          ulong  tvall = entry[VTYPE_INDEX_SIG_VALL];
+          ulong  tvalh = entry[VTYPE_INDEX_SIG_VALH];
+          if( (fvall != (tvall & mask)) || ((tvalh & mask) != 0) ) {
+            if( prev_set == 1 ) {
+              entry[VTYPE_INDEX_SIG_TOG01] |= ~tvalh & ~tvall &  fvall;
+              entry[VTYPE_INDEX_SIG_TOG10] |= ~tvalh &  tvall & ~fvall & mask;
+            }
+            entry[VTYPE_INDEX_SIG_VALL]  = (tvall & ~mask) | fvall;
+            entry[VTYPE_INDEX_SIG_VALH]  = tvalh & ~mask;
+            entry[VTYPE_INDEX_SIG_MISC] |= mask;
+            changed = TRUE;
+          }
+        }
+      } else {
+        for( i=lindex; i<=hindex; i++ ) {
+          ulong* entry = vec->value.ul[i];
+          ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
+          ulong  fvall = scratchl[i] & mask;
+          ulong  fvalh = scratchh[i] & mask;
+          ulong  tvall = entry[VTYPE_INDEX_SIG_VALL];
+          ulong  tvalh = entry[VTYPE_INDEX_SIG_VALH];
+          if( (fvall != (tvall & mask)) || (fvalh != (tvalh & mask)) ) {
+            ulong tvalx = tvalh & ~tvall & entry[VTYPE_INDEX_SIG_MISC];
+            ulong xval  = entry[VTYPE_INDEX_SIG_XHOLD];
+            ulong xmask = mask & ~tvalh;
+            if( prev_set == 1 ) {
+              entry[VTYPE_INDEX_SIG_TOG01] |= ((~tvalh & ~tvall) | (tvalx & ~xval)) & (~fvalh &  fvall) & mask;
+              entry[VTYPE_INDEX_SIG_TOG10] |= ((~tvalh &  tvall) | (tvalx &  xval)) & (~fvalh & ~fvall) & mask;
+            }
+            entry[VTYPE_INDEX_SIG_VALL]  = (tvall & ~mask)  | fvall;
+            entry[VTYPE_INDEX_SIG_VALH]  = (tvalh & ~mask)  | fvalh;
+            entry[VTYPE_INDEX_SIG_XHOLD] = (xval  & ~xmask) | (tvall & xmask);
+            entry[VTYPE_INDEX_SIG_MISC] |= ~fvalh & mask;
+            changed = TRUE;
           }
-          entry[VTYPE_INDEX_SIG_VALL]  = (tvall & ~mask)  | fvall;
-          entry[VTYPE_INDEX_SIG_VALH]  = (tvalh & ~mask)  | fvalh;
-          entry[VTYPE_INDEX_SIG_XHOLD] = (xval  & ~xmask) | (tvall & xmask);
-          entry[VTYPE_INDEX_SIG_MISC] |= ~fvalh & mask;
-          changed = TRUE;
         }
       }
       break;
     case VTYPE_MEM :
       for( i=lindex; i<=hindex; i++ ) {
-        ulong* entry = vec->value.ul[i];
+        ulong* entry = vector_get_writable_row( vec, i );
         ulong  mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
         ulong  fvall = scratchl[i] & mask;
         ulong  fvalh = scratchh[i] & mask;
@@ -2011,14 +2259,14 @@ void vector_set_mem_rd_ulong(
 
   if( vec->suppl.part.type == VTYPE_MEM ) {
     if( UL_DIV(msb) == UL_DIV(lsb) ) {
-      vec->value.ul[UL_DIV(lsb)][VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb) & UL_LMASK(lsb);
+      vector_get_writable_row( vec, UL_DIV(lsb) )[VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb) & UL_LMASK(lsb);
     } else {
       int i;
-      vec->value.ul[UL_DIV(lsb)][VTYPE_INDEX_MEM_RD] |= UL_LMASK(lsb);
+      vector_get_writable_row( vec, UL_DIV(lsb) )[VTYPE_INDEX_MEM_RD] |= UL_LMASK(lsb);
       for( i=(UL_DIV(lsb) + 1); i<UL_DIV(msb); i++ ) {
-        vec->value.ul[UL_DIV(msb)][VTYPE_INDEX_MEM_RD] = UL_SET;
+        vector_get_writable_row( vec, i )[VTYPE_INDEX_MEM_RD] = UL_SET;
       }
-      vec->value.ul[UL_DIV(msb)][VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb);
+      vector_get_writable_row( vec, UL_DIV(msb) )[VTYPE_INDEX_MEM_RD] |= UL_HMASK(msb);
     } 
   }
 
@@ -3194,6 +3442,78 @@ void vector_from_string(
 
 }
 
+/*!
+ Finds the lowest and highest bits of the given range of a signal vector whose value differs from the value
+ in the scratch arrays, before the scratch arrays are assigned to the vector.  For other vector types the
+ whole range is returned.  The returned range is only meaningful if some bit differs.
+*/
+static void vector_changed_range(
+  const vector* vec,          /*!< Pointer to vector that is about to be assigned */
+  const ulong*  scratchl,     /*!< Pointer to scratch array containing new lower data */
+  const ulong*  scratchh,     /*!< Pointer to scratch array containing new upper data */
+  int           lsb,          /*!< Least-significant bit of assigned range */
+  int           msb,          /*!< Most-significant bit of assigned range */
+  int*          changed_lsb,  /*!< Set to the lowest bit that differs */
+  int*          changed_msb   /*!< Set to the highest bit that differs */
+) { PROFILE(VECTOR_CHANGED_RANGE);
+
+  *changed_lsb = lsb;
+  *changed_msb = msb;
+
+  if( vec->suppl.part.type == VTYPE_SIG ) {
+
+    unsigned int lindex = UL_DIV(lsb);
+    unsigned int hindex = UL_DIV(msb);
+    ulong        lmask  = UL_LMASK(lsb);
+    ulong        hmask  = UL_HMASK(msb);
+    ulong        ldiff  = 0;  /* Differing bits of the lowest differing element */
+    ulong        hdiff  = 0;  /* Differing bits of the highest differing element */
+    unsigned int lfound = 0;
+    unsigned int hfound = 0;
+    unsigned int i;
+
+    if( lindex == hindex ) {
+      lmask &= hmask;
+    }
+
+    for( i=lindex; i<=hindex; i++ ) {
+      const ulong* entry = vec->value.ul[i];
+      ulong        mask  = (i==lindex) ? lmask : (i==hindex ? hmask : UL_SET);
+      ulong        diff;
+      if( vec->two_state == 1 ) {
+        diff = (((scratchl[i] & ~scratchh[i]) ^ entry[VTYPE_INDEX_SIG_VALL]) | entry[VTYPE_INDEX_SIG_VALH]) & mask;
+      } else {
+        diff = ((scratchl[i] ^ entry[VTYPE_INDEX_SIG_VALL]) | (scratchh[i] ^ entry[VTYPE_INDEX_SIG_VALH])) & mask;
+      }
+      if( diff != 0 ) {
+        if( ldiff == 0 ) {
+          ldiff  = diff;
+          lfound = i;
+        }
+        hdiff  = diff;
+        hfound = i;
+      }
+    }
+
+    if( ldiff != 0 ) {
+      unsigned int bit = 0;
+      while( ((ldiff >> bit) & 1) == 0 ) {
+        bit++;
+      }
+      *changed_lsb = (int)((lfound << UL_DIV_VAL) + bit);
+      bit = UL_BITS - 1;
+      while( ((hdiff >> bit) & 1) == 0 ) {
+        bit--;
+      }
+      *changed_msb = (int)((hfound << UL_DIV_VAL) + bit);
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  \return Returns TRUE if assigned value differs from the original value; otherwise,
          returns FALSE.
@@ -3203,12 +3523,16 @@ void vector_from_string(
  Iterates through specified value string, setting the specified vector value to
  this value.  Performs a VCD-specific bit-fill if the value size is not the size
  of the vector.  The specified value string is assumed to be in binary format.
+ If changed_lsb and changed_msb are specified, they are set to the lowest and
+ highest bits whose value changed (the whole vector for real values).
 */
 bool vector_vcd_assign(
-  vector*     vec,    /*!< Pointer to vector to set value to */
-  const char* value,  /*!< String version of VCD value */
-  int         msb,    /*!< Most significant bit to assign to */
-  int         lsb     /*!< Least significant bit to assign to */
+  vector*     vec,          /*!< Pointer to vector to set value to */
+  const char* value,        /*!< String version of VCD value */
+  int         msb,          /*!< Most significant bit to assign to */
+  int         lsb,          /*!< Least significant bit to assign to */
+  int*        changed_lsb,  /*!< Set to the lowest changed bit if the value changed (may be NULL) */
+  int*        changed_msb   /*!< Set to the highest changed bit if the value changed (may be NULL) */
 ) { PROFILE(VECTOR_VCD_ASSIGN);
 
   bool        retval = FALSE;  /* Return value for this function */
@@ -3222,32 +3546,46 @@ bool vector_vcd_assign(
   assert( value != NULL );
   assert( msb <= vec->width );
 
-  /* Set pointer to LSB */
-  ptr = (value + strlen( value )) - 1;
-  i   = lsb;
+  i = lsb;
 
   switch( vec->suppl.part.data_type ) {
     case VDATA_UL :
       {
-        ulong scratchl[UL_DIV(MAX_BIT_WIDTH)];
-        ulong scratchh[UL_DIV(MAX_BIT_WIDTH)];
+        ulong                scratchl[UL_DIV(MAX_BIT_WIDTH)];
+        ulong                scratchh[UL_DIV(MAX_BIT_WIDTH)];
+        const unsigned char* str  = (const unsigned char*)value;
+        unsigned int         left = strlen( value );  /* Number of characters that remain to be decoded */
         scratchl[UL_DIV(i)] = 0;
         scratchh[UL_DIV(i)] = 0;
-        while( ptr >= value ) {
-          unsigned int index  = UL_DIV(i);
+        /* Decode the value string from the LSB, one vector word at a time */
+        while( left > 0 ) {
           unsigned int offset = UL_MOD(i);
-          ulong        bit    = ((ulong)1 << offset);
-          if( offset == 0 ) {
-            scratchl[index] = 0;
-            scratchh[index] = 0;
+          unsigned int num    = ((UL_BITS - offset) < left) ? (UL_BITS - offset) : left;
+          unsigned int j;
+          ulong        vall   = 0;
+          ulong        valh   = 0;
+          /* Eight characters per step are combined into packed VALL and VALH bytes */
+          for( j=0; (j + 8)<=num; j+=8 ) {
+            const unsigned char* chars = str + (left - j - 8);
+            unsigned int         bits  = (vector_vcd_bits[chars[0]] << 7) | (vector_vcd_bits[chars[1]] << 6) |
+                                         (vector_vcd_bits[chars[2]] << 5) | (vector_vcd_bits[chars[3]] << 4) |
+                                         (vector_vcd_bits[chars[4]] << 3) | (vector_vcd_bits[chars[5]] << 2) |
+                                         (vector_vcd_bits[chars[6]] << 1) |  vector_vcd_bits[chars[7]];
+            vall |= (ulong)(bits & 0xff) << j;
+            valh |= (ulong)(bits >> 8)   << j;
           }
-          scratchl[index] |= ((*ptr == '1') || (*ptr == 'z')) ? bit : 0;
-          scratchh[index] |= ((*ptr == 'x') || (*ptr == 'z')) ? bit : 0;
-          ptr--;
-          i++;
+          for( ; j<num; j++ ) {
+            unsigned int bits = vector_vcd_bits[str[left - j - 1]];
+            vall |= (ulong)(bits & 0xff) << j;
+            valh |= (ulong)(bits >> 8)   << j;
+          }
+          scratchl[UL_DIV(i)] = vall << offset;
+          scratchh[UL_DIV(i)] = valh << offset;
+          left -= num;
+          i    += num;
         }
-        ptr++;
         /* Bit-fill */
+        ptr = value;
         for( ; i<=msb; i++ ) {
           unsigned int index  = UL_DIV(i);
           unsigned int offset = UL_MOD(i);
@@ -3259,13 +3597,16 @@ bool vector_vcd_assign(
           scratchl[index] |= (*ptr == 'z') ? bit : 0;
           scratchh[index] |= ((*ptr == 'x') || (*ptr == 'z')) ? bit : 0;
         }
+        if( changed_lsb != NULL ) {
+          vector_changed_range( vec, scratchl, scratchh, lsb, msb, changed_lsb, changed_msb );
+        }
         retval = vector_set_coverage_and_assign_ulong( vec, scratchl, scratchh, lsb, msb );
       }
       break;
     case VDATA_R64 :
       {
         double real;
-        if( sscanf( value, "%lf", &real ) == 1 ) {
+        if( convert_str_to_real( value, &real ) ) {
           retval = !DEQ( vec->value.r64->val, real );
           vec->value.r64->val = real;
         }
@@ -3273,16 +3614,67 @@ bool vector_vcd_assign(
       break;
     case VDATA_R32 :
       {
-        float real;
-        if( sscanf( value, "%f", &real ) != 1 ) {
-          retval = !FEQ( vec->value.r32->val, real );
-          vec->value.r32->val = real;
+        double real;
+        if( convert_str_to_real( value, &real ) ) {
+          retval = !FEQ( vec->value.r32->val, (float)real );
+          vec->value.r32->val = (float)real;
         }
       }
       break;
     default :  assert( 0 );  break;
   }
 
+  /* A real value change changes the whole vector */
+  if( (changed_lsb != NULL) && (vec->suppl.part.data_type != VDATA_UL) ) {
+    *changed_lsb = 0;
+    *changed_msb = vec->width - 1;
+  }
+
+  /* Set the set bit to indicate that this vector has been evaluated */
+  vec->suppl.part.set = 1;
+
+  PROFILE_END;
+
+  return( retval );
+
+}
+
+/*!
+ \return Returns TRUE if assigned value differs from the original value; otherwise,
+         returns FALSE.
+
+ \throws anonymous vector_vcd_assign
+
+ Assigns a real value that was delivered by the dumpfile reader in binary form to the
+ specified vector.  A vector that does not store a real value is assigned the string
+ form of the value, as if it had been read from a VCD file.
+*/
+bool vector_vcd_assign_real(
+  vector* vec,   /*!< Pointer to vector to set value to */
+  double  value  /*!< Real value to assign */
+) { PROFILE(VECTOR_VCD_ASSIGN_REAL);
+
+  bool retval = FALSE;  /* Return value for this function */
+
+  switch( vec->suppl.part.data_type ) {
+    case VDATA_R64 :
+      retval = !DEQ( vec->value.r64->val, value );
+      vec->value.r64->val = value;
+      break;
+    case VDATA_R32 :
+      retval = !FEQ( vec->value.r32->val, (float)value );
+      vec->value.r32->val = (float)value;
+      break;
+    default :
+      {
+        char         str[350];
+        unsigned int rv = snprintf( str, 350, "%.16f", value );
+        assert( rv < 350 );
+        retval = vector_vcd_assign( vec, str, (vec->width - 1), 0, NULL, NULL );
+      }
+      break;
+  }
+
   /* Set the set bit to indicate that this vector has been evaluated */
   vec->suppl.part.set = 1;
 
@@ -3313,19 +3705,19 @@ bool vector_vcd_assign2(
 
     char* ptr = value + (value_size - vec1->width);
 
-    retval |= vector_vcd_assign( vec1, ptr, (vec1->width - 1), 0 );
+    retval |= vector_vcd_assign( vec1, ptr, (vec1->width - 1), 0, NULL, NULL );
     *ptr = '\0';
-    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0 );
+    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0, NULL, NULL );
 
   /* Otherwise, assign the low-order vector as normal and assign the high-order vector with only the first character of the value string */
   } else {
 
-    retval |= vector_vcd_assign( vec1, value, (vec1->width - 1), 0 );
+    retval |= vector_vcd_assign( vec1, value, (vec1->width - 1), 0, NULL, NULL );
     if( value[0] == '1' ) {
       value[0] = '0';
     }
     value[1] = '\0';
-    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0 );
+    retval |= vector_vcd_assign( vec2, value, (vec2->width - 1), 0, NULL, NULL );
 
   }
 
@@ -3983,6 +4375,36 @@ bool vector_ceq_ulong(
 
 }
 
+/*!
+ \return Returns a hash value for the given vector that is consistent with vector_ceq_ulong.
+
+ Since vector_ceq_ulong compares the sign/zero extended values of two vectors, only the lowest ulong
+ of the extended value is used to calculate the hash value.  Two vectors that are case equal will
+ always have the same hash value.
+*/
+unsigned int vector_hash_ulong(
+  const vector* vec  /*!< Pointer to vector to calculate hash value for */
+) { PROFILE(VECTOR_HASH_ULONG);
+
+  unsigned int msb        = (vec->width - 1);
+  bool         msb_is_one = (((vec->value.ul[UL_DIV(msb)][VTYPE_INDEX_VAL_VALL] >> UL_MOD(msb)) & 1) == 1);
+  ulong        vall;
+  ulong        valh;
+  ulong        hash;
+
+  vector_copy_val_and_sign_extend_ulong( vec, 0, msb_is_one, &vall, &valh );
+
+  hash = (vall * 0x9e3779b1) ^ (valh * 0x85ebca6b);
+#if SIZEOF_LONG == 8
+  hash ^= (hash >> 32);
+#endif
+
+  PROFILE_END;
+
+  return( (unsigned int)hash );
+
+}
+
 /*!
  \return Returns TRUE if the assigned value differs from the original value; otherwise, returns FALSE.
 
@@ -5370,7 +5792,9 @@ void vector_dealloc_value(
         unsigned int size = UL_SIZE( vec->width );
 
         for( i=0; i<size; i++ ) {
-          free_safe( vec->value.ul[i], (sizeof( ulong ) * vector_type_sizes[vec->suppl.part.type]) );
+          if( vec->value.ul[i] != vector_mem_zero_row ) {
+            free_safe( vec->value.ul[i], (sizeof( ulong ) * vector_type_sizes[vec->suppl.part.type]) );
+          }
         }
         free_safe( vec->value.ul, (sizeof( ulong* ) * size) );
         vec->value.ul = NULL;
@@ -59,6 +59,12 @@ void vector_init_r32(
             int     type
 );
 
+/*! \brief Returns a modifiable pointer to the value row of the given vector word. */
+ulong* vector_get_writable_row(
+  vector*      vec,
+  unsigned int index
+);
+
 /*! \brief Creates and initializes new vector */
 vector* vector_create(
   int  width,
@@ -116,6 +122,22 @@ void vector_merge(
   vector* other
 );
 
+#ifndef RUNLIB
+#ifndef VPI_ONLY
+/*! \brief Writes the given vector to a simulation checkpoint file. */
+void vector_checkpoint_write(
+  const vector* vec,
+  FILE*         file
+);
+
+/*! \brief Restores the given vector from a simulation checkpoint file. */
+void vector_checkpoint_read(
+  vector* vec,
+  FILE*   file
+);
+#endif
+#endif
+
 /*! \brief Returns the value of the eval_a for the given bit index. */
 int vector_get_eval_a(
   vector* vec,
@@ -341,7 +363,15 @@ bool vector_vcd_assign(
   vector*     vec,
   const char* value,
   int         msb,
-  int         lsb
+  int         lsb,
+  int*        changed_lsb,
+  int*        changed_msb
+);
+
+/*! \brief Assigns specified real value from the dumpfile to specified vector. */
+bool vector_vcd_assign_real(
+  vector* vec,
+  double  value
 );
 
 /*! \brief Assigns specified VCD value to specified vectors. */
@@ -440,6 +470,11 @@ bool vector_ceq_ulong(
   const vector* right
 );
 
+/*! \brief Calculates a hash value for the given vector that is consistent with vector_ceq_ulong. */
+unsigned int vector_hash_ulong(
+  const vector* vec
+);
+
 /*! \brief Performs case equal comparison of two vectors. */
 bool vector_op_ceq(
   vector*       tgt,
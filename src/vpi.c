@@ -33,6 +33,7 @@
 #include "binding.h"
 #include "db.h"
 #include "defines.h"
+#include "func_unit.h"
 #include "instance.h"
 #include "link.h"
 #include "obfuscate.h"
@@ -278,8 +279,6 @@ PLI_INT32 covered_value_change_real(
   p_cb_data cb  /*!< Pointer to callback data structure from vpi_user.h */
 ) { PROFILE(COVERED_VALUE_CHANGE_REAL);
 
-  char real_str[64];
-
 #ifndef NOIV
   s_vpi_value value;
 
@@ -317,8 +316,7 @@ PLI_INT32 covered_value_change_real(
   last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
 
   /* Set symbol value */
-  snprintf( real_str, 64, "%.16f", value.value.real );
-  db_set_symbol_string( cb->user_data, real_str );
+  db_set_symbol_real( cb->user_data, value.value.real );
 #else
 #ifdef DEBUG_MODE
   if( debug_mode ) {
@@ -350,8 +348,7 @@ PLI_INT32 covered_value_change_real(
   last_time = ((uint64)cb->time->high << 32) | (uint64)cb->time->low;
 
   /* Set symbol value */
-  snprintf( real_str, 64, "%.16f", cb->value->value.real );
-  db_set_symbol_string( cb->user_data, real_str );
+  db_set_symbol_real( cb->user_data, cb->value->value.real );
 #endif
 
   PROFILE_END;
@@ -493,7 +490,7 @@ void covered_create_value_change_cb(
 
   /* Only add the signal if it is in our database and needs to be assigned from the simulator */
   if( (curr_instance->funit != NULL) &&
-      (((((vsig = sig_link_find( name, curr_instance->funit->sigs, curr_instance->funit->sig_size )) != NULL) ||
+      (((((vsig = funit_lookup_signal( name, curr_instance->funit )) != NULL) ||
          scope_find_signal( name, curr_instance->funit, &vsig, &found_funit, 0 )) &&
         (((vsig != NULL) && (vsig->suppl.part.assigned == 0)) || info_suppl.part.inlined)) ||
        (info_suppl.part.inlined &&
@@ -517,9 +514,9 @@ void covered_create_value_change_cb(
 
     /* Add signal/symbol to symtab database */
     if( vsig != NULL ) {
-      db_assign_symbol( name, symbol, ((vsig->value->width + vsig->dim[0].lsb) - 1), vsig->dim[0].lsb ); 
+      (void)db_assign_symbol( name, symbol, ((vsig->value->width + vsig->dim[0].lsb) - 1), vsig->dim[0].lsb ); 
     } else {
-      db_assign_symbol( name, symbol, (vpi_get( vpiSize, sig ) - 1), 0 );
+      (void)db_assign_symbol( name, symbol, (vpi_get( vpiSize, sig ) - 1), 0 );
     }
 
     /* Get initial value of this signal and store it for later retrieval */
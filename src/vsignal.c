@@ -73,6 +73,12 @@ static void vsignal_init(
   sig->line            = line;
   sig->exps            = NULL;
   sig->exp_size        = 0;
+  sig->fanouts         = NULL;
+  sig->fanout_size     = 0;
+  sig->paths           = NULL;
+  sig->path_size       = 0;
+  sig->changed_lsb     = 0;
+  sig->changed_msb     = 0;
 
   PROFILE_END;
 
@@ -118,6 +124,24 @@ vsignal* vsignal_create(
 
 }
 
+/*!
+ Deallocates the precomputed expression fan-out of the given signal.
+*/
+static void vsignal_dealloc_fanouts(
+  vsignal* sig  /*!< Pointer to signal to deallocate fan-out for */
+) { PROFILE(VSIGNAL_DEALLOC_FANOUTS);
+
+  free_safe( sig->fanouts, (sizeof( exp_fanout ) * sig->fanout_size) );
+  free_safe( sig->paths, (sizeof( exp_path ) * sig->path_size) );
+  sig->fanouts     = NULL;
+  sig->fanout_size = 0;
+  sig->paths       = NULL;
+  sig->path_size   = 0;
+
+  PROFILE_END;
+
+}
+
 #ifndef RUNLIB
 /*!
  \throws anonymous expression_set_value
@@ -210,8 +234,14 @@ vsignal* vsignal_duplicate(
   new_sig->udim_num  = sig->udim_num;
   new_sig->dim       = NULL;
   new_sig->line      = sig->line;
-  new_sig->exps      = NULL;
-  new_sig->exp_size  = 0;
+  new_sig->exps        = NULL;
+  new_sig->exp_size    = 0;
+  new_sig->fanouts     = NULL;
+  new_sig->fanout_size = 0;
+  new_sig->paths       = NULL;
+  new_sig->path_size   = 0;
+  new_sig->changed_lsb = 0;
+  new_sig->changed_msb = 0;
 
   /* Copy the dimension information */
   if( (sig->pdim_num + sig->udim_num) > 0 ) {
@@ -468,6 +498,172 @@ void vsignal_merge(
 
 }
 
+/*!
+ Narrows the bit range of the given fan-out to the bits of the signal that its expression reads.  Only
+ single-dimension bit and part selects with constant indices are narrowed; all other expressions read
+ the whole signal (the range is left unchanged).
+*/
+static void vsignal_fanout_range(
+  const vsignal* sig,    /*!< Pointer to signal being read */
+  expression*    exp,    /*!< Pointer to expression reading the signal */
+  exp_fanout*    fanout  /*!< Pointer to fan-out to set the bit range of */
+) { PROFILE(VSIGNAL_FANOUT_RANGE);
+
+  bool sbit = (exp->op == EXP_OP_SBIT_SEL) && (exp->left->op == EXP_OP_STATIC);
+  bool mbit = (exp->op == EXP_OP_MBIT_SEL) && (exp->left->op == EXP_OP_STATIC) && (exp->right->op == EXP_OP_STATIC);
+
+  if( (sbit || mbit) && (sig->udim_num == 0) &&
+      ((ESUPPL_IS_ROOT( exp->suppl ) == 1) || (exp->parent->expr->op != EXP_OP_DIM)) ) {
+
+    exp_dim* dim = (exp->suppl.part.nba == 0) ? exp->elem.dim : exp->elem.dim_nba->dim;
+
+    if( (dim != NULL) && dim->last ) {
+
+      int intval = (vector_to_int( ((sbit || dim->dim_be) ? exp->left : exp->right)->value ) - dim->dim_lsb) * dim->dim_width;
+      int lsb    = dim->dim_be ? ((int)sig->value->width - (intval + (int)exp->value->width)) : intval;
+      int msb    = (lsb + (int)exp->value->width) - 1;
+
+      /* Out-of-range selects read no signal bits but are left to be woken on any change */
+      if( (lsb >= 0) && (msb < (int)sig->value->width) ) {
+        fanout->lsb = lsb;
+        fanout->msb = msb;
+      }
+
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+ Precomputes the fan-out of a value change of the given signal to each expression of its expression
+ list.  For each expression, the path up to its root expression is recorded as the changed bits to set
+ in each parent expression (see \ref sim_expr_changed), so that propagating a change no longer needs to
+ find out on which side of its parent each expression is.  Function call and port assignment expressions
+ do not get a path since changes are not propagated to them.
+*/
+static void vsignal_create_fanouts(
+  vsignal* sig  /*!< Pointer to signal to create fan-out for */
+) { PROFILE(VSIGNAL_CREATE_FANOUTS);
+
+  unsigned int i;
+  unsigned int steps = 0;
+
+  vsignal_dealloc_fanouts( sig );
+
+  /* Count the path steps of all expressions */
+  for( i=0; i<sig->exp_size; i++ ) {
+    expression* exp = sig->exps[i];
+    if( (exp->op != EXP_OP_FUNC_CALL) && (exp->op != EXP_OP_PASSIGN) ) {
+      while( ESUPPL_IS_ROOT( exp->suppl ) == 0 ) {
+        exp = exp->parent->expr;
+        steps++;
+      }
+    }
+  }
+
+  sig->fanouts     = (exp_fanout*)malloc_safe_nolimit( sizeof( exp_fanout ) * sig->exp_size );
+  sig->fanout_size = sig->exp_size;
+  if( steps > 0 ) {
+    sig->paths     = (exp_path*)malloc_safe_nolimit( sizeof( exp_path ) * steps );
+    sig->path_size = steps;
+  }
+
+  steps = 0;
+  for( i=0; i<sig->exp_size; i++ ) {
+
+    exp_fanout* fanout = &(sig->fanouts[i]);
+    expression* exp    = sig->exps[i];
+
+    fanout->expr  = NULL;
+    fanout->path  = sig->paths + steps;
+    fanout->depth = 0;
+    fanout->stmt  = NULL;
+    fanout->lsb   = 0;
+    fanout->msb   = sig->value->width - 1;
+
+    if( (exp->op != EXP_OP_FUNC_CALL) && (exp->op != EXP_OP_PASSIGN) ) {
+
+      fanout->expr = exp;
+
+      vsignal_fanout_range( sig, exp, fanout );
+
+      while( ESUPPL_IS_ROOT( exp->suppl ) == 0 ) {
+
+        expression* parent = exp->parent->expr;
+        exp_path*   step   = &(sig->paths[steps]);
+        esuppl      test;
+        esuppl      set;
+
+        test.all = 0;
+        set.all  = 0;
+
+        /* A left child sets the left changed bit (and the right one of a conditional), otherwise the right one is set */
+        if( (parent->left != NULL) && (parent->left->id == exp->id) ) {
+          test.part.left_changed = 1;
+          set.part.left_changed  = 1;
+          if( parent->op == EXP_OP_COND ) {
+            set.part.right_changed = 1;
+          }
+        } else {
+          test.part.right_changed = 1;
+          set.part.right_changed  = 1;
+        }
+
+        step->expr = parent;
+        step->test = test.all;
+        step->set  = set.all;
+        fanout->depth++;
+        steps++;
+
+        exp = parent;
+
+      }
+
+      fanout->stmt = exp->parent->stmt;
+
+    }
+
+  }
+
+  PROFILE_END;
+
+}
+
+/*!
+  When the specified signal in the parameter list has changed values, this function
+  is called to propagate the value change to the simulator to cause any statements
+  waiting on this value change to be resimulated.  Only the expressions that read
+  one or more bits within the given changed bit range are propagated to.  The fan-out
+  to the expressions is computed when the signal first changes during simulation,
+  once the design is complete.
+*/
+void vsignal_propagate_range(
+  vsignal*        sig,  /*!< Pointer to signal to propagate change information from */
+  unsigned int    lsb,  /*!< Lowest bit of the signal that changed */
+  unsigned int    msb,  /*!< Highest bit of the signal that changed */
+  const sim_time* time  /*!< Current simulation time when signal changed */
+) { PROFILE(VSIGNAL_PROPAGATE_RANGE);
+
+  unsigned int i;
+
+  if( sig->fanout_size != sig->exp_size ) {
+    vsignal_create_fanouts( sig );
+  }
+
+  /* Add the statements of the RHS expressions to the simulation queue */
+  for( i=0; i<sig->fanout_size; i++ ) {
+    if( (sig->fanouts[i].expr != NULL) && (sig->fanouts[i].msb >= lsb) && (sig->fanouts[i].lsb <= msb) ) {
+      sim_fanout_changed( &(sig->fanouts[i]), time );
+    }
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
   When the specified signal in the parameter list has changed values, this function
   is called to propagate the value change to the simulator to cause any statements
@@ -478,21 +674,37 @@ void vsignal_propagate(
   const sim_time* time  /*!< Current simulation time when signal changed */
 ) { PROFILE(VSIGNAL_PROPAGATE);
 
-  unsigned int i;
+  vsignal_propagate_range( sig, 0, (sig->value->width - 1), time );
 
-  /* Iterate through vsignal's expression list */
-  for( i=0; i<sig->exp_size; i++ ) {
+  PROFILE_END;
 
-    expression* exp = sig->exps[i];
+}
 
-    /* Add to simulation queue if expression is a RHS, not a function call and not a port assignment */
-    if( (exp->op != EXP_OP_FUNC_CALL) &&
-        (exp->op != EXP_OP_PASSIGN) ) {
-      sim_expr_changed( exp, time );
+/*!
+ Marks the given signal as changed by the dumpfile in the current timestep, adding the given bit range to the
+ range of bits that changed in this timestep.  The signal is propagated once all of the dumpfile values for the
+ timestep have been assigned (see \ref vsignal_propagate_range).
+*/
+static void vsignal_mark_changed(
+  vsignal* sig,  /*!< Pointer to changed signal */
+  int      lsb,  /*!< Lowest bit that changed */
+  int      msb   /*!< Highest bit that changed */
+) { PROFILE(VSIGNAL_MARK_CHANGED);
+
+  if( sig->suppl.part.vcd_changed == 0 ) {
+    sig->changed_lsb = lsb;
+    sig->changed_msb = msb;
+  } else {
+    if( (unsigned int)lsb < sig->changed_lsb ) {
+      sig->changed_lsb = lsb;
+    }
+    if( (unsigned int)msb > sig->changed_msb ) {
+      sig->changed_msb = msb;
     }
-
   }
 
+  sig->suppl.part.vcd_changed = 1;
+
   PROFILE_END;
 
 }
@@ -500,19 +712,20 @@ void vsignal_propagate(
 /*!
  \throws anonymous vector_vcd_assign vector_vcd_assign
 
- Assigns the associated value to the specified vsignal's vector.  After this, it
- iterates through its expression list, setting the TRUE and FALSE bits accordingly.
- Finally, calls the simulator expr_changed function for each expression.
+ Assigns the associated value to the specified vsignal's vector.  If the value changed, the
+ signal is marked as changed so that the caller can propagate the change to the signal's
+ expressions once all of the dumpfile values for the current timestep have been assigned.
 */
 void vsignal_vcd_assign(
   vsignal*        sig,    /*!< Pointer to vsignal to assign VCD value to */
   const char*     value,  /*!< String version of VCD value */
   unsigned int    msb,    /*!< Most significant bit to assign to */
-  unsigned int    lsb,    /*!< Least significant bit to assign to */
-  const sim_time* time    /*!< Current simulation time signal is being assigned */
+  unsigned int    lsb     /*!< Least significant bit to assign to */
 ) { PROFILE(VSIGNAL_VCD_ASSIGN);
 
   bool vec_changed;  /* Specifies if assigned value differed from original value */
+  int  changed_lsb;  /* Lowest bit that changed */
+  int  changed_msb;  /* Highest bit that changed */
 
   assert( sig != NULL );
   assert( sig->value != NULL );
@@ -542,16 +755,16 @@ void vsignal_vcd_assign(
 
   /* Set vsignal value to specified value */
   if( lsb > 0 ) {
-    vec_changed = vector_vcd_assign( sig->value, value, (msb - sig->dim[0].lsb), (lsb - sig->dim[0].lsb) );
+    vec_changed = vector_vcd_assign( sig->value, value, (msb - sig->dim[0].lsb), (lsb - sig->dim[0].lsb), &changed_lsb, &changed_msb );
   } else {
-    vec_changed = vector_vcd_assign( sig->value, value, msb, lsb );
+    vec_changed = vector_vcd_assign( sig->value, value, msb, lsb, &changed_lsb, &changed_msb );
   }
 
   /* Don't go through the hassle of updating expressions if value hasn't changed */
   if( vec_changed && !info_suppl.part.inlined ) {
 
-    /* Propagate signal changes to rest of design */
-    vsignal_propagate( sig, time );
+    /* Mark the signal so that it is propagated once for this timestep */
+    vsignal_mark_changed( sig, changed_lsb, changed_msb );
 
   } 
 
@@ -559,6 +772,38 @@ void vsignal_vcd_assign(
 
 }
 
+/*!
+ \throws anonymous vector_vcd_assign_real
+
+ Assigns a real value that was delivered by the dumpfile reader in binary form to the
+ specified vsignal.
+*/
+void vsignal_vcd_assign_real(
+  vsignal* sig,   /*!< Pointer to vsignal to assign real value to */
+  double   value  /*!< Real value from the dumpfile */
+) { PROFILE(VSIGNAL_VCD_ASSIGN_REAL);
+
+  assert( sig != NULL );
+  assert( sig->value != NULL );
+  assert( sig->udim_num == 0 );
+
+#ifdef DEBUG_MODE
+  if( debug_mode ) {
+    unsigned int rv = snprintf( user_msg, USER_MSG_LENGTH, "Assigning vsignal %s to real value %.17g", obf_sig( sig->name ), value );
+    assert( rv < USER_MSG_LENGTH );
+    print_output( user_msg, DEBUG, __FILE__, __LINE__ );
+  }
+#endif
+
+  /* Set vsignal value to specified value and mark the signal so that it is propagated once for this timestep */
+  if( vector_vcd_assign_real( sig->value, value ) && !info_suppl.part.inlined ) {
+    vsignal_mark_changed( sig, 0, (sig->value->width - 1) );
+  }
+
+  PROFILE_END;
+
+}
+
 /*!
  Adds the specified expression to the end of this vsignal's expression
  list.
@@ -775,6 +1020,8 @@ void vsignal_dealloc(
     sig->exps     = NULL;
     sig->exp_size = 0;
 
+    vsignal_dealloc_fanouts( sig );
+
     /* Finally free up the memory for this vsignal */
     free_safe( sig, sizeof( vsignal ) );
 
@@ -72,6 +72,14 @@ void vsignal_merge(
   vsignal* other
 );
 
+/*! \brief Propagates specified signal information to the expressions reading the given bit range. */
+void vsignal_propagate_range(
+  vsignal*        sig,
+  unsigned int    lsb,
+  unsigned int    msb,
+  const sim_time* time
+);
+
 /*! \brief Propagates specified signal information to rest of design. */
 void vsignal_propagate(
   vsignal*        sig,
@@ -83,8 +91,13 @@ void vsignal_vcd_assign(
   vsignal*        sig,
   const char*     value,
   unsigned int    msb,
-  unsigned int    lsb,
-  const sim_time* time
+  unsigned int    lsb
+);
+
+/*! \brief Assigns specified real value from the dumpfile to specified vsignal. */
+void vsignal_vcd_assign_real(
+  vsignal* sig,
+  double   value
 );
 
 /*! \brief Adds an expression to the vsignal list. */